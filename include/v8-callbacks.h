@@ -215,6 +215,10 @@ using CreateHistogramCallback = void* (*)(const char* name, int min, int max,
 
 using AddHistogramSampleCallback = void (*)(void* histogram, int sample);
 
+using RuntimeCallStatsCallback = void (*)(const char* name, int64_t count,
+                                          int64_t time_in_microseconds,
+                                          void* data);
+
 // --- Exceptions ---
 
 using FatalErrorCallback = void (*)(const char* location, const char* message);
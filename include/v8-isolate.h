@@ -39,6 +39,7 @@ class ScriptOrModule;
 class SharedArrayBuffer;
 
 namespace internal {
+class IsolateGroup;
 class MicrotaskQueue;
 class ThreadLocalTop;
 }  // namespace internal
@@ -154,6 +155,15 @@ class V8_EXPORT ResourceConstraints {
     initial_young_generation_size_ = initial_size;
   }
 
+  /**
+   * The NUMA node that the memory backing heap pages should preferably be
+   * allocated on, or -1 for no preference. Useful when the isolate's threads
+   * are pinned to one socket. This is only a hint and is ignored on platforms
+   * without NUMA memory policy support.
+   */
+  int numa_node_preference() const { return numa_node_preference_; }
+  void set_numa_node_preference(int node) { numa_node_preference_ = node; }
+
  private:
   static constexpr size_t kMB = 1048576u;
   size_t code_range_size_ = 0;
@@ -162,6 +172,7 @@ class V8_EXPORT ResourceConstraints {
   size_t initial_old_generation_size_ = 0;
   size_t initial_young_generation_size_ = 0;
   uint32_t* stack_limit_ = nullptr;
+  int numa_node_preference_ = -1;
 };
 
 /**
@@ -201,6 +212,57 @@ enum class MemoryPressureLevel { kNone, kModerate, kCritical };
  */
 using StackState = cppgc::EmbedderStackState;
 
+/**
+ * A group of isolates that share a pointer compression cage, and with it a
+ * heap size limit. Without multiple pointer compression cages, all isolates
+ * of the process are in a single group.
+ *
+ * Sharing a cage does not make it legal to use the objects of one isolate in
+ * another isolate of the same group. Objects must still only be used in the
+ * isolate that created them.
+ *
+ * A moved-from IsolateGroup is empty and must not be used to create isolates.
+ */
+class V8_EXPORT IsolateGroup {
+ public:
+  /**
+   * Creates a new isolate group with its own pointer compression cage.
+   * Isolates created in different groups have separate heap limits, so a
+   * process with pointer compression can use more than 4 GB of JS heap in
+   * total. The embedded builtins stay shared between all groups.
+   *
+   * Must only be called if CanCreateNewGroups() returns true.
+   */
+  static IsolateGroup Create();
+
+  /**
+   * Whether this build supports creating new isolate groups, which is the
+   * case if it was built with multiple pointer compression cages. Otherwise
+   * all isolates are in a single process-wide group.
+   */
+  static bool CanCreateNewGroups();
+
+  IsolateGroup(const IsolateGroup& other);
+  IsolateGroup& operator=(const IsolateGroup& other);
+  IsolateGroup(IsolateGroup&& other);
+  IsolateGroup& operator=(IsolateGroup&& other);
+  ~IsolateGroup();
+
+  bool operator==(const IsolateGroup& other) const {
+    return isolate_group_ == other.isolate_group_;
+  }
+  bool operator!=(const IsolateGroup& other) const {
+    return !operator==(other);
+  }
+
+ private:
+  friend class Isolate;
+
+  explicit IsolateGroup(internal::IsolateGroup* isolate_group);
+
+  internal::IsolateGroup* isolate_group_;
+};
+
 /**
  * Isolate represents an isolated instance of the V8 engine.  V8 isolates have
  * completely separate states.  Objects from one isolate must not be used in
@@ -599,6 +661,12 @@ class V8_EXPORT Isolate {
    */
   static Isolate* Allocate();
 
+  /**
+   * Like Allocate(), but allocates the isolate in |group| rather than in the
+   * group that Allocate() would pick. |group| must not be empty.
+   */
+  static Isolate* Allocate(const IsolateGroup& group);
+
   /**
    * Initialize an Isolate previously allocated by Isolate::Allocate().
    */
@@ -615,6 +683,11 @@ class V8_EXPORT Isolate {
    */
   static Isolate* New(const CreateParams& params);
 
+  /**
+   * Creates a new isolate in |group|. See Allocate(const IsolateGroup&).
+   */
+  static Isolate* New(const IsolateGroup& group, const CreateParams& params);
+
   /**
    * Returns the entered isolate for the current thread or NULL in
    * case there is no current isolate.
@@ -711,6 +784,16 @@ class V8_EXPORT Isolate {
    */
   void MemoryPressureNotification(MemoryPressureLevel level);
 
+  /**
+   * Optional continuous signal for the memory pressure of the environment the
+   * isolate runs in, e.g. derived from cgroup pressure stall information.
+   * |pressure| ranges from 0 (no pressure) to 1 (memory exhausted). Unlike
+   * MemoryPressureNotification() this does not trigger garbage collections but
+   * lets heap limit heuristics shrink the headroom above the live heap size.
+   * It is allowed to call this function from another thread.
+   */
+  void SetEnvironmentMemoryPressure(double pressure);
+
   /**
    * Optional request from the embedder to tune v8 towards energy efficiency
    * rather than speed if `battery_saver_mode_enabled` is true, because the
@@ -759,6 +842,17 @@ class V8_EXPORT Isolate {
    */
   void DumpAndResetStats();
 
+  /**
+   * Appends the basic block counts of the builtins collected so far to
+   * |file_name| and resets them. The format is the one written by
+   * --turbo-profiling-output; logs from many processes can be concatenated
+   * and passed to tools/builtins-pgo/get_hints.py, whose output mksnapshot
+   * uses to optimize and reorder the builtins. Returns false if there is no
+   * profile data, i.e. V8 wasn't built with v8_enable_builtins_profiling, or
+   * if the file can't be written.
+   */
+  bool WriteBuiltinsProfile(const char* file_name);
+
   /**
    * Discards all V8 thread-specific data for the Isolate. Should be used
    * if a thread is terminating and it has used an Isolate that will outlive
@@ -828,6 +922,19 @@ class V8_EXPORT Isolate {
   bool GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
                               size_t index);
 
+  /**
+   * Get the free list of a space in the heap, bucketed by size class.
+   *
+   * \param index The index of the space, as for GetHeapSpaceStatistics().
+   * \param size_classes Filled with the statistics of the smallest size
+   *   classes of the space's free list, in increasing order of block size.
+   * \returns the number of size classes of the space's free list, which may
+   *   be larger than size_classes.size(). Spaces without a free list have
+   *   none.
+   */
+  size_t GetHeapSpaceFreeListStatistics(
+      size_t index, MemorySpan<HeapFreeListStatistics> size_classes);
+
   /**
    * Returns the number of types of objects tracked in the heap at GC.
    */
@@ -836,6 +943,10 @@ class V8_EXPORT Isolate {
   /**
    * Get statistics about objects in the heap.
    *
+   * This requires --track-gc-object-stats, or --track-gc-instance-type-stats
+   * for the instance types alone, which are counted while marking instead of
+   * by an extra pass over the heap.
+   *
    * \param object_statistics The HeapObjectStatistics object to fill in
    *   statistics of objects of given type, which were live in the previous GC.
    * \param type_index The index of the type of object to fill details about,
@@ -854,6 +965,16 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Moves the inline cache transitions sampled since the last call into
+   * |samples|, oldest first. Sampling is enabled with
+   * --ic-transition-sampling-interval; only the most recent samples are kept
+   * if they are not taken in time.
+   *
+   * \returns the number of samples written to |samples|.
+   */
+  size_t TakeICTransitionSamples(MemorySpan<ICTransitionSample> samples);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -1363,6 +1484,16 @@ class V8_EXPORT Isolate {
   void SetCreateHistogramFunction(CreateHistogramCallback);
   void SetAddHistogramSampleFunction(AddHistogramSampleCallback);
 
+  /**
+   * Reports the runtime call stats collected on the main thread and on
+   * worker threads so far, calling |callback| once for every counter that
+   * was entered. This is a no-op unless V8 was built with runtime call stats
+   * and they were enabled with --runtime-call-stats or through tracing.
+   * With --runtime-call-stats-sampling-rate=N, the values cover about one
+   * in N top-level scopes.
+   */
+  void GetRuntimeCallStats(RuntimeCallStatsCallback callback, void* data);
+
   /**
    * Enables the host application to provide a mechanism for recording
    * event based metrics. In order to use this interface
@@ -1428,11 +1559,28 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Sets how many times a regular expression created from now on is run by
+   * the regexp interpreter before it is compiled to native code. A higher
+   * value saves native code for patterns that are only used a few times.
+   * Only has an effect if regexp tier-up is enabled.
+   */
+  void SetRegExpTierUpTicks(int ticks);
+
   /**
    * Update load start time of the RAIL mode
    */
   void UpdateLoadStartTime();
 
+  /**
+   * Optional hint for latency sensitive embedders. Caps the duration of every
+   * main-thread incremental marking step to |budget_in_ms| milliseconds and
+   * shifts the remaining marking work to concurrent marking threads. Atomic
+   * pauses that exceed the budget are reported through GC tracing. Passing a
+   * non-positive value removes the budget.
+   */
+  void SetGCPauseBudget(double budget_in_ms);
+
   /**
    * Optional notification to tell V8 the current isolate is used for debugging
    * and requires higher heap limit.
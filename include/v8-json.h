@@ -6,11 +6,14 @@
 #define INCLUDE_V8_JSON_H_
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class Object;
+class OutputStream;
 class Value;
 class String;
 
@@ -30,6 +33,18 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Registers the shape of |object| with the JSON shape cache of the isolate.
+   * Objects parsed later in |context| with the same property names, in the
+   * same order, are then allocated directly with the map of |object|. The
+   * cache holds shapes weakly and may evict them at any time.
+   *
+   * \param context The context in which objects with this shape are parsed.
+   * \param object An object whose shape should be used by the parser.
+   * \return true if |object| has a shape that the parser can produce.
+   */
+  static bool RegisterShape(Local<Context> context, Local<Object> object);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -40,6 +55,24 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Stringifies |json_object| like Stringify, but writes the result to
+   * |stream| as UTF-8 chunks while it is produced instead of building the
+   * complete string. Chunks are at most |stream->GetChunkSize()| bytes long.
+   * The stream can stop serialization by returning kAbort. EndOfStream is
+   * only called once the complete result has been written. The stream must
+   * not call into V8.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream that receives the result.
+   * \return Just(true) if the complete result was written, Just(false) if
+   * |json_object| has no JSON representation or the stream aborted, and
+   * Nothing if an exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
 };
 
 }  // namespace v8
@@ -160,6 +160,34 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+enum class JavaScriptTier { kSparkplug, kMaglev, kTurbofan };
+
+struct JavaScriptFunctionCompiled {
+  JavaScriptTier tier = JavaScriptTier::kSparkplug;
+  bool concurrent = false;
+  bool osr = false;
+  size_t bytecode_size_in_bytes = 0;
+  // Time a concurrent job spent waiting to be compiled or installed.
+  int64_t wait_duration_in_us = -1;
+  int64_t compile_duration_in_us = -1;
+  int64_t install_duration_in_us = -1;
+};
+
+struct JavaScriptFunctionDeoptimized {
+  JavaScriptTier tier = JavaScriptTier::kTurbofan;
+  bool lazy = false;
+  size_t bytecode_size_in_bytes = 0;
+  // The deopt site: the function, given by its script id and source position,
+  // the bytecode offset and the reason, which is a static string.
+  int script_id = 0;
+  int function_position = -1;
+  int bytecode_offset = -1;
+  const char* reason = nullptr;
+  // How often the site has deoptimized so far, including this time. Sites
+  // that keep deoptimizing are likely to be stuck in a deopt loop.
+  int site_deopt_count = 0;
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -212,6 +240,8 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(JavaScriptFunctionCompiled)
+  ADD_MAIN_THREAD_EVENT(JavaScriptFunctionDeoptimized)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
@@ -262,6 +292,27 @@ struct V8_EXPORT LongTaskStats {
   int64_t v8_execute_us = 0;
 };
 
+/**
+ * A deoptimization site, as in JavaScriptFunctionDeoptimized, and how often it
+ * has deoptimized. The number of sites V8 tracks is bounded; when the table
+ * is full, the sites with the lowest counts are dropped first.
+ *
+ * This API is experimental and may be removed/changed in the future.
+ */
+struct V8_EXPORT DeoptHotspot {
+  /**
+   * Returns the deoptimization sites tracked for the isolate, in no
+   * particular order.
+   */
+  static std::vector<DeoptHotspot> Get(Isolate* isolate);
+
+  int script_id = 0;
+  int function_position = -1;
+  int bytecode_offset = -1;
+  const char* reason = nullptr;
+  int deopt_count = 0;
+};
+
 }  // namespace metrics
 }  // namespace v8
 
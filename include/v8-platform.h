@@ -565,6 +565,22 @@ class PageAllocator {
     return false;
   }
 
+  /**
+   * Hints that the physical memory backing the given pages should preferably
+   * be allocated on NUMA node |node|. Only affects pages that have not been
+   * accessed yet. Returns true if the hint was applied.
+   */
+  virtual bool SetPreferredNumaNode(void* address, size_t length, int node) {
+    return false;
+  }
+
+  /**
+   * Hints that the given pages should be backed by huge pages (e.g.
+   * transparent huge pages on Linux) where the range covers complete, aligned
+   * huge pages. Returns true if the hint was applied.
+   */
+  virtual bool AdviseHugePages(void* address, size_t length) { return false; }
+
   /**
    * INTERNAL ONLY: This interface has not been stabilised and may change
    * without notice from one release to another without being deprecated first.
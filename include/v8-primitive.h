@@ -498,6 +498,17 @@ class V8_EXPORT String : public Name {
    */
   bool MakeExternal(ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new string from the UTF-8 data defined in the given resource.
+   * If the data is all ASCII, it is also valid one-byte data, and the result
+   * is an external string that uses the resource without copying, exactly as
+   * with NewExternalOneByte. Otherwise the data is transcoded into a regular
+   * string and the resource is disposed before this function returns. Either
+   * way the caller must not otherwise delete or modify the resource.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalFromUtf8(
+      Isolate* isolate, ExternalOneByteStringResource* resource);
+
   /**
    * Returns true if this string can be made external, given the encoding for
    * the external string resource.
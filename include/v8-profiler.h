@@ -210,7 +210,8 @@ class V8_EXPORT OutputStream {
 class V8_EXPORT CpuProfile {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,  // See format description near 'Serialize' method.
+    kPprof = 1  // Binary, uncompressed pprof profile.proto message.
   };
   /** Returns CPU profile title. */
   Local<String> GetTitle() const;
@@ -281,6 +282,10 @@ class V8_EXPORT CpuProfile {
    *    timeDeltas: [numbers array]
    *  }
    *
+   * For the pprof format, the chunks form a single profile.proto message
+   * with "samples/count" and "cpu/nanoseconds" sample values, one sample
+   * per call tree node that has ticks. Chunks contain binary data and may
+   * be gzipped by the embedder to produce a file readable by pprof.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -961,6 +966,13 @@ class V8_EXPORT HeapProfiler {
     kSamplingForceGC = 1 << 0,
     kSamplingIncludeObjectsCollectedByMajorGC = 1 << 1,
     kSamplingIncludeObjectsCollectedByMinorGC = 1 << 2,
+    /**
+     * Attribute samples to the source position each function on the stack
+     * was at when the object was allocated, instead of to the start of the
+     * function. Nodes are then split per allocation and call site, and their
+     * line and column numbers point at that site.
+     */
+    kSamplingIncludeAllocationPositions = 1 << 3,
   };
 
   /**
@@ -1109,6 +1121,20 @@ class V8_EXPORT HeapProfiler {
       ObjectNameResolver* global_object_name_resolver = nullptr,
       bool hide_internals = true, bool capture_numeric_value = false);
 
+  /**
+   * Takes a heap snapshot and serializes it to |stream| in JSON format, see
+   * `HeapSnapshot::Serialize`. The snapshot is not retained by the profiler.
+   * The whole snapshot is generated before serialization starts. Its nodes
+   * and edges are released once they have been written, before the remaining
+   * sections, and the rest of it when serialization is done, without waiting
+   * for `HeapSnapshot::Delete`.
+   *
+   * \returns false if the snapshot could not be taken.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream,
+      const HeapSnapshotOptions& options = HeapSnapshotOptions());
+
   /**
    * Obtains list of Detached JS Wrapper Objects. This functon calls garbage
    * collection, then iterates over traced handles in the isolate
@@ -538,7 +538,8 @@ class V8_EXPORT ScriptCompiler {
      * function will be called on a background thread, so it's OK to block and
      * wait for the data, if the embedder doesn't have data yet. Returns the
      * length of the data returned. When the data ends, GetMoreData should
-     * return 0. Caller takes ownership of the data.
+     * return 0. Caller takes ownership of the data, see
+     * TransfersChunkOwnership().
      *
      * When streaming UTF-8 data, V8 handles multi-byte characters split between
      * two data chunks, but doesn't handle multi-byte characters split between
@@ -555,6 +556,15 @@ class V8_EXPORT ScriptCompiler {
      * V8 has parsed the data it received so far.
      */
     virtual size_t GetMoreData(const uint8_t** src) = 0;
+
+    /**
+     * By default V8 takes ownership of the chunks returned by GetMoreData and
+     * frees them with delete[]. An embedder whose source is immutable and
+     * outlives the Isolate, such as a memory-mapped file, can return false
+     * here and hand out pointers straight into it instead of copying every
+     * chunk into a separate allocation.
+     */
+    virtual bool TransfersChunkOwnership() const { return true; }
   };
 
   /**
@@ -749,6 +759,11 @@ class V8_EXPORT ScriptCompiler {
    *
    * This API allows to start the streaming with as little data as possible, and
    * the remaining data (for example, the ScriptOrigin) is passed to Compile.
+   *
+   * Tasks for different sources are independent, so the modules of a module
+   * graph can be streamed in parallel by starting one task per module with
+   * ScriptType::kModule and running them on separate background threads.
+   * Each result is then finalized on the main thread with CompileModule.
    */
   static ScriptStreamingTask* StartStreaming(
       Isolate* isolate, StreamedSource* source,
@@ -188,6 +188,12 @@ class V8_EXPORT HeapSpaceStatistics {
   size_t space_used_size() { return space_used_size_; }
   size_t space_available_size() { return space_available_size_; }
   size_t physical_space_size() { return physical_space_size_; }
+  /**
+   * The part of space_available_size() that is on the space's free list, i.e.
+   * in gaps between live objects. A large value relative to
+   * space_used_size() indicates fragmentation.
+   */
+  size_t space_free_list_size() { return space_free_list_size_; }
 
  private:
   const char* space_name_;
@@ -195,6 +201,25 @@ class V8_EXPORT HeapSpaceStatistics {
   size_t space_used_size_;
   size_t space_available_size_;
   size_t physical_space_size_;
+  size_t space_free_list_size_;
+
+  friend class Isolate;
+};
+
+/**
+ * The free memory of a heap space in free list blocks of at least
+ * min_block_size() bytes and less than the min_block_size() of the next size
+ * class.
+ */
+class V8_EXPORT HeapFreeListStatistics {
+ public:
+  HeapFreeListStatistics();
+  size_t min_block_size() { return min_block_size_; }
+  size_t free_size() { return free_size_; }
+
+ private:
+  size_t min_block_size_;
+  size_t free_size_;
 
   friend class Isolate;
 };
@@ -223,16 +248,51 @@ class V8_EXPORT HeapCodeStatistics {
   size_t bytecode_and_metadata_size() { return bytecode_and_metadata_size_; }
   size_t external_script_source_size() { return external_script_source_size_; }
   size_t cpu_profiler_metadata_size() { return cpu_profiler_metadata_size_; }
+  /**
+   * The part of code_and_metadata_size() that is taken up by the
+   * deoptimization data of optimized code, including its frame translations.
+   */
+  size_t deoptimization_data_size() { return deoptimization_data_size_; }
 
  private:
   size_t code_and_metadata_size_;
   size_t bytecode_and_metadata_size_;
   size_t external_script_source_size_;
   size_t cpu_profiler_metadata_size_;
+  size_t deoptimization_data_size_;
 
   friend class Isolate;
 };
 
+/**
+ * An inline cache transition to a polymorphic or megamorphic state, or one
+ * involving a deprecated map, recorded by --ic-transition-sampling-interval.
+ */
+struct ICTransitionSample {
+  /**
+   * The kind of access, e.g. "LoadIC" or "StoreGlobalIC". The string is
+   * statically allocated.
+   */
+  const char* ic_type;
+  /** Whether the access is keyed, i.e. o[k] rather than o.k. */
+  bool is_keyed;
+  /**
+   * The states before and after the transition, using the marks of
+   * --log-ic: '0' uninitialized, '1' monomorphic, 'P' polymorphic,
+   * 'N' megamorphic, 'D' megadom, 'G' generic.
+   */
+  char old_state;
+  char new_state;
+  /** Whether the map of the receiver was deprecated. */
+  bool is_deprecated_map;
+  /** The id of the script containing the access, or -1 if unknown. */
+  int script_id;
+  /** The source position of the access, or -1 if unknown. */
+  int position;
+  /** The start position of the enclosing function, or -1 if unknown. */
+  int function_position;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
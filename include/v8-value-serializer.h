@@ -18,6 +18,7 @@
 namespace v8 {
 
 class ArrayBuffer;
+class BackingStore;
 class Isolate;
 class Object;
 class SharedArrayBuffer;
@@ -112,6 +113,28 @@ class V8_EXPORT ValueSerializer {
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
 
+    /**
+     * Called when the ValueSerializer is going to copy the contents of a
+     * non-shared ArrayBuffer that was not passed to TransferArrayBuffer. To
+     * pass its backing store out of band instead, the embedder keeps a
+     * reference to array_buffer->GetBackingStore(), stores an ID for it in
+     * |backing_store_id| and returns Just(true). When deserializing, this ID
+     * will be passed to ValueDeserializer::Delegate::GetBackingStoreFromId.
+     * Returning Just(false) copies the contents as usual.
+     *
+     * Both ArrayBuffers then share the same memory. For move semantics, the
+     * embedder can detach |array_buffer| once serialization has finished.
+     *
+     * Resizable ArrayBuffers and those backing a WebAssembly.Memory are always
+     * copied.
+     *
+     * If the object cannot be serialized, an exception should be thrown and
+     * Nothing<bool>() returned.
+     */
+    virtual Maybe<bool> GetBackingStoreId(Isolate* isolate,
+                                          Local<ArrayBuffer> array_buffer,
+                                          uint32_t* backing_store_id);
+
     /**
      * Called when the first shared value is serialized. All subsequent shared
      * values will use the same conveyor.
@@ -190,6 +213,18 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Indicate whether to write the property keys of plain objects only once
+   * per shape (hidden class), and only the property values for every further
+   * object with that shape. This makes arrays of records considerably smaller
+   * and faster to deserialize, but the output can only be read by versions of
+   * V8 that understand it, so it should not be used for data that is
+   * persisted or sent to older peers.
+   *
+   * The default is to write the keys of every object.
+   */
+  void SetUseObjectShapes(bool mode);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -239,6 +274,15 @@ class V8_EXPORT ValueDeserializer {
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
 
+    /**
+     * Get the backing store of a non-shared ArrayBuffer given an ID previously
+     * provided by ValueSerializer::Delegate::GetBackingStoreId. A new
+     * ArrayBuffer is created for it. If the backing store is not available,
+     * an exception should be thrown and nullptr returned.
+     */
+    virtual std::shared_ptr<BackingStore> GetBackingStoreFromId(
+        Isolate* isolate, uint32_t backing_store_id);
+
     /**
      * Get the SharedValueConveyor previously provided by
      * ValueSerializer::Delegate::AdoptSharedValueConveyor.
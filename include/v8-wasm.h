@@ -53,6 +53,20 @@ class V8_EXPORT CompiledWasmModule {
    */
   MemorySpan<const uint8_t> GetWireBytesRef();
 
+  /**
+   * Get a profile of which functions were executed and which were tiered up
+   * so far. The profile can be stored by the embedder and passed to
+   * |ApplyTieringProfile| on a later compilation of the same wire bytes.
+   */
+  OwnedBuffer GetTieringProfile();
+
+  /**
+   * Schedule background compilation of the functions that were hot according
+   * to a profile returned by |GetTieringProfile|. Returns false, and does
+   * nothing, if the profile is malformed or belongs to other wire bytes.
+   */
+  bool ApplyTieringProfile(MemorySpan<const uint8_t> profile);
+
   const std::string& source_url() const { return source_url_; }
 
  private:
@@ -52,6 +52,7 @@
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/date/date.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deopt-hotspots.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/embedder-state.h"
 #include "src/execution/execution.h"
@@ -66,9 +67,12 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles-inl.h"
+#include "src/heap/free-list.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-stats.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
 #include "src/init/startup-data-util.h"
@@ -140,6 +144,7 @@
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
 #include "src/trap-handler/trap-handler.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-engine.h"
@@ -284,6 +289,12 @@ void i::V8::FatalProcessOutOfMemory(i::Isolate* i_isolate, const char* location,
   heap_stats.os_error = &os_error;
   heap_stats.last_few_messages = last_few_messages;
   heap_stats.js_stacktrace = js_stacktrace;
+  size_t old_to_new_pages;
+  heap_stats.old_to_new_pages = &old_to_new_pages;
+  size_t old_to_new_buckets;
+  heap_stats.old_to_new_buckets = &old_to_new_buckets;
+  size_t old_to_new_slots;
+  heap_stats.old_to_new_slots = &old_to_new_slots;
   intptr_t end_marker;
   heap_stats.end_marker = &end_marker;
   if (i_isolate->heap()->HasBeenSetUp()) {
@@ -3357,6 +3368,16 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+bool JSON::RegisterShape(Local<Context> context, Local<Object> object) {
+  auto native_context = Utils::OpenDirectHandle(*context);
+  i::Isolate* i_isolate = native_context->GetIsolate();
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  auto receiver = Utils::OpenDirectHandle(*object);
+  if (!i::IsJSObject(*receiver)) return false;
+  return i::JsonShapeCache::Register(i_isolate, native_context,
+                                     i::Cast<i::JSObject>(receiver));
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3377,6 +3398,22 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToStream(Local<Context> context,
+                                    Local<Value> json_object,
+                                    OutputStream* stream, Local<String> gap) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, StringifyToStream, i::HandleScope);
+  auto object = Utils::OpenHandle(*json_object);
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToStream(i_isolate, object, gap_string, stream);
+  has_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -3430,6 +3467,12 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<bool> ValueSerializer::Delegate::GetBackingStoreId(
+    Isolate* v8_isolate, Local<ArrayBuffer> array_buffer,
+    uint32_t* backing_store_id) {
+  return Just(false);
+}
+
 bool ValueSerializer::Delegate::AdoptSharedValueConveyor(
     Isolate* v8_isolate, SharedValueConveyor&& conveyor) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -3472,6 +3515,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetUseObjectShapes(bool mode) {
+  private_->serializer.SetUseObjectShapes(mode);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -3537,6 +3584,16 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return MaybeLocal<SharedArrayBuffer>();
 }
 
+std::shared_ptr<BackingStore>
+ValueDeserializer::Delegate::GetBackingStoreFromId(Isolate* v8_isolate,
+                                                   uint32_t backing_store_id) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->Throw(*i_isolate->factory()->NewError(
+      i_isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return nullptr;
+}
+
 const SharedValueConveyor* ValueDeserializer::Delegate::GetSharedValueConveyor(
     Isolate* v8_isolate) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -5950,21 +6007,46 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
         current_write += copy_length;
         read_index = up_to;
       } else {
-        for (; read_index < up_to; read_index++) {
+        while (read_index < up_to) {
+          // Copy ASCII runs in one go and encode the rest one by one.
+          int ascii_length = i::NonAsciiStart(
+              reinterpret_cast<const uint8_t*>(read_start + read_index),
+              up_to - read_index);
+          memcpy(current_write, read_start + read_index, ascii_length);
+          current_write += ascii_length;
+          read_index += ascii_length;
+          if (read_index == up_to) break;
           current_write += unibrow::Utf8::EncodeOneByte(
               current_write, static_cast<uint8_t>(read_start[read_index]));
+          read_index++;
           DCHECK(write_capacity == -1 ||
                  (current_write - write_start) <= write_capacity);
         }
       }
     } else {
-      for (; read_index < up_to; read_index++) {
-        uint16_t character = read_start[read_index];
-        current_write += unibrow::Utf8::Encode(current_write, character,
-                                               prev_char, replace_invalid_utf8);
-        prev_char = character;
-        DCHECK(write_capacity == -1 ||
-               (current_write - write_start) <= write_capacity);
+      while (read_index < up_to) {
+        // Narrow ASCII runs in one go. ASCII never combines with a previous
+        // surrogate, so only prev_char needs to be kept up to date.
+        int ascii_length = i::NonAsciiStart(
+            reinterpret_cast<const uint16_t*>(read_start + read_index),
+            up_to - read_index);
+        if (ascii_length > 0) {
+          i::CopyChars(reinterpret_cast<uint8_t*>(current_write),
+                       read_start + read_index, ascii_length);
+          current_write += ascii_length;
+          read_index += ascii_length;
+          prev_char = read_start[read_index - 1];
+        }
+        for (; read_index < up_to &&
+               read_start[read_index] > unibrow::Utf8::kMaxOneByteChar;
+             read_index++) {
+          uint16_t character = read_start[read_index];
+          current_write += unibrow::Utf8::Encode(
+              current_write, character, prev_char, replace_invalid_utf8);
+          prev_char = character;
+          DCHECK(write_capacity == -1 ||
+                 (current_write - write_start) <= write_capacity);
+        }
       }
     }
   }
@@ -6602,7 +6684,11 @@ HeapSpaceStatistics::HeapSpaceStatistics()
       space_size_(0),
       space_used_size_(0),
       space_available_size_(0),
-      physical_space_size_(0) {}
+      physical_space_size_(0),
+      space_free_list_size_(0) {}
+
+HeapFreeListStatistics::HeapFreeListStatistics()
+    : min_block_size_(0), free_size_(0) {}
 
 HeapObjectStatistics::HeapObjectStatistics()
     : object_type_(nullptr),
@@ -6614,7 +6700,8 @@ HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0),
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0),
-      cpu_profiler_metadata_size_(0) {}
+      cpu_profiler_metadata_size_(0),
+      deoptimization_data_size_(0) {}
 
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
@@ -7394,6 +7481,23 @@ metrics::LongTaskStats metrics::LongTaskStats::Get(v8::Isolate* v8_isolate) {
   return *i_isolate->GetCurrentLongTaskStats();
 }
 
+std::vector<metrics::DeoptHotspot> metrics::DeoptHotspot::Get(
+    v8::Isolate* v8_isolate) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  std::vector<DeoptHotspot> result;
+  i_isolate->deopt_hotspots()->ForEach(
+      [&](const i::DeoptHotspots::Site& site, int count) {
+        DeoptHotspot hotspot;
+        hotspot.script_id = site.script_id;
+        hotspot.function_position = site.function_position;
+        hotspot.bytecode_offset = site.bytecode_offset;
+        hotspot.reason = i::DeoptimizeReasonToString(site.reason);
+        hotspot.deopt_count = count;
+        result.push_back(hotspot);
+      });
+  return result;
+}
+
 namespace {
 i::Address* GetSerializedDataFromFixedArray(i::Isolate* i_isolate,
                                             i::Tagged<i::FixedArray> list,
@@ -7711,6 +7815,41 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewExternalFromUtf8(
+    Isolate* v8_isolate, v8::String::ExternalOneByteStringResource* resource) {
+  CHECK_NOT_NULL(resource);
+  if (resource->length() > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewExternalFromUtf8);
+  if (resource->length() == 0) {
+    // The resource isn't going to be used, free it immediately.
+    resource->Dispose();
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  CHECK_NOT_NULL(resource->data());
+  int length = static_cast<int>(resource->length());
+  if (i::String::IsAscii(resource->data(), length)) {
+    // ASCII is valid one-byte data, so the buffer can be used as is.
+    i::Handle<i::String> string = i_isolate->factory()
+                                      ->NewExternalStringFromOneByte(resource)
+                                      .ToHandleChecked();
+    return Utils::ToLocal(string);
+  }
+  // UTF-8 never takes fewer bytes than UTF-16 code units, so this can't
+  // exceed the maximum string length.
+  i::Handle<i::String> string =
+      i_isolate->factory()
+          ->NewStringFromUtf8(
+              base::Vector<const char>(resource->data(), length))
+          .ToHandleChecked();
+  // The transcoded string doesn't refer to the resource.
+  resource->Dispose();
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::DisallowGarbageCollection no_gc;
 
@@ -8864,6 +9003,37 @@ MemorySpan<const uint8_t> CompiledWasmModule::GetWireBytesRef() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+OwnedBuffer CompiledWasmModule::GetTieringProfile() {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.GetTieringProfile");
+  base::OwnedVector<uint8_t> profile = i::wasm::GetTieringProfile(
+      native_module_->module(), native_module_->wire_bytes(),
+      native_module_->tiering_budget_array());
+  size_t size = profile.size();
+  return {profile.ReleaseData(), size};
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
+bool CompiledWasmModule::ApplyTieringProfile(
+    MemorySpan<const uint8_t> profile) {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.ApplyTieringProfile");
+  // Without a JIT there is nothing to compile ahead of time.
+  if (i::v8_flags.wasm_jitless) return false;
+  std::unique_ptr<i::wasm::ProfileInformation> pgo_info =
+      i::wasm::RestoreTieringProfile(native_module_->module(),
+                                     native_module_->wire_bytes(),
+                                     {profile.data(), profile.size()});
+  if (!pgo_info) return false;
+  native_module_->compilation_state()->ApplyPgoInfo(pgo_info.get());
+  return true;
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 Local<ArrayBuffer> v8::WasmMemoryObject::Buffer() {
 #if V8_ENABLE_WEBASSEMBLY
   auto obj = Utils::OpenDirectHandle(this);
@@ -9797,6 +9967,13 @@ Isolate* Isolate::Allocate() {
   return reinterpret_cast<Isolate*>(i::Isolate::New());
 }
 
+// static
+Isolate* Isolate::Allocate(const IsolateGroup& group) {
+  Utils::ApiCheck(group.isolate_group_ != nullptr, "v8::Isolate::Allocate",
+                  "The isolate group is empty, e.g. it was moved from");
+  return reinterpret_cast<Isolate*>(i::Isolate::New(group.isolate_group_));
+}
+
 Isolate::CreateParams::CreateParams() = default;
 
 Isolate::CreateParams::~CreateParams() = default;
@@ -9905,6 +10082,62 @@ Isolate* Isolate::New(const Isolate::CreateParams& params) {
   return v8_isolate;
 }
 
+// static
+Isolate* Isolate::New(const IsolateGroup& group,
+                      const Isolate::CreateParams& params) {
+  Isolate* v8_isolate = Allocate(group);
+  Initialize(v8_isolate, params);
+  return v8_isolate;
+}
+
+// static
+IsolateGroup IsolateGroup::Create() {
+  Utils::ApiCheck(CanCreateNewGroups(), "v8::IsolateGroup::Create",
+                  "Creating isolate groups requires multiple pointer "
+                  "compression cages");
+  // The new group starts with the reference that this handle owns.
+  return IsolateGroup(i::IsolateGroup::New());
+}
+
+// static
+bool IsolateGroup::CanCreateNewGroups() {
+  return COMPRESS_POINTERS_IN_MULTIPLE_CAGES_BOOL;
+}
+
+IsolateGroup::IsolateGroup(i::IsolateGroup* isolate_group)
+    : isolate_group_(isolate_group) {}
+
+IsolateGroup::IsolateGroup(const IsolateGroup& other)
+    : isolate_group_(other.isolate_group_ ? other.isolate_group_->Acquire()
+                                          : nullptr) {}
+
+IsolateGroup& IsolateGroup::operator=(const IsolateGroup& other) {
+  if (this != &other) {
+    if (isolate_group_) isolate_group_->Release();
+    isolate_group_ =
+        other.isolate_group_ ? other.isolate_group_->Acquire() : nullptr;
+  }
+  return *this;
+}
+
+IsolateGroup::IsolateGroup(IsolateGroup&& other)
+    : isolate_group_(other.isolate_group_) {
+  other.isolate_group_ = nullptr;
+}
+
+IsolateGroup& IsolateGroup::operator=(IsolateGroup&& other) {
+  if (this != &other) {
+    if (isolate_group_) isolate_group_->Release();
+    isolate_group_ = other.isolate_group_;
+    other.isolate_group_ = nullptr;
+  }
+  return *this;
+}
+
+IsolateGroup::~IsolateGroup() {
+  if (isolate_group_) isolate_group_->Release();
+}
+
 void Isolate::Dispose() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   if (!Utils::ApiCheck(!i_isolate->IsInUse(), "v8::Isolate::Dispose()",
@@ -9927,6 +10160,12 @@ void Isolate::DumpAndResetStats() {
   i_isolate->DumpAndResetStats();
 }
 
+bool Isolate::WriteBuiltinsProfile(const char* file_name) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  CHECK_NOT_NULL(file_name);
+  return i_isolate->WriteAndResetBuiltinsProfileData(file_name, "a");
+}
+
 void Isolate::DiscardThreadSpecificMetadata() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->DiscardPerThreadDataForThisThread();
@@ -10162,12 +10401,14 @@ bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
       space_statistics->space_used_size_ = 0;
       space_statistics->space_available_size_ = 0;
       space_statistics->physical_space_size_ = 0;
+      space_statistics->space_free_list_size_ = 0;
     } else {
       i::ReadOnlySpace* space = heap->read_only_space();
       space_statistics->space_size_ = space->CommittedMemory();
       space_statistics->space_used_size_ = space->Size();
       space_statistics->space_available_size_ = 0;
       space_statistics->physical_space_size_ = space->CommittedPhysicalMemory();
+      space_statistics->space_free_list_size_ = 0;
     }
   } else {
     i::Space* space = heap->space(static_cast<int>(index));
@@ -10176,10 +10417,41 @@ bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
     space_statistics->space_available_size_ = space ? space->Available() : 0;
     space_statistics->physical_space_size_ =
         space ? space->CommittedPhysicalMemory() : 0;
+    i::FreeList* free_list = space ? space->free_list() : nullptr;
+    space_statistics->space_free_list_size_ =
+        free_list ? free_list->Available() : 0;
   }
   return true;
 }
 
+size_t Isolate::GetHeapSpaceFreeListStatistics(
+    size_t index, MemorySpan<HeapFreeListStatistics> size_classes) {
+  i::AllocationSpace allocation_space = static_cast<i::AllocationSpace>(index);
+  if (!i::Heap::IsValidAllocationSpace(allocation_space) ||
+      allocation_space == i::RO_SPACE) {
+    return 0;
+  }
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Heap* heap = i_isolate->heap();
+  // Linear allocation areas are returned to the free list, as for the
+  // space's statistics.
+  heap->FreeMainThreadLinearAllocationAreas();
+
+  i::Space* space = heap->space(static_cast<int>(index));
+  i::FreeList* free_list = space ? space->free_list() : nullptr;
+  if (!free_list) return 0;
+  const size_t number_of_categories =
+      static_cast<size_t>(free_list->number_of_categories());
+  for (size_t i = 0; i < std::min(number_of_categories, size_classes.size());
+       i++) {
+    const auto type = static_cast<i::FreeListCategoryType>(i);
+    size_classes[i].min_block_size_ = free_list->CategoryMinSize(type);
+    size_classes[i].free_size_ = free_list->AvailableInCategory(type);
+  }
+  return number_of_categories;
+}
+
 size_t Isolate::NumberOfTrackedHeapObjectTypes() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = i_isolate->heap();
@@ -10189,7 +10461,10 @@ size_t Isolate::NumberOfTrackedHeapObjectTypes() {
 bool Isolate::GetHeapObjectStatisticsAtLastGC(
     HeapObjectStatistics* object_statistics, size_t type_index) {
   if (!object_statistics) return false;
-  if (V8_LIKELY(!i::TracingFlags::is_gc_stats_enabled())) return false;
+  if (V8_LIKELY(!i::TracingFlags::is_gc_stats_enabled() &&
+                !i::v8_flags.track_gc_instance_type_stats)) {
+    return false;
+  }
 
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = i_isolate->heap();
@@ -10228,10 +10503,18 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
       i_isolate->external_script_source_size();
   code_statistics->cpu_profiler_metadata_size_ =
       i::CpuProfiler::GetAllProfilersMemorySize(i_isolate);
+  code_statistics->deoptimization_data_size_ =
+      i_isolate->deoptimization_data_size();
 
   return true;
 }
 
+size_t Isolate::TakeICTransitionSamples(
+    MemorySpan<ICTransitionSample> samples) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  return i_isolate->ic_transition_sampler()->Take(samples);
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -10408,6 +10691,23 @@ void Isolate::SetAddHistogramSampleFunction(
       ->SetAddHistogramSampleFunction(callback);
 }
 
+void Isolate::GetRuntimeCallStats(RuntimeCallStatsCallback callback,
+                                  void* data) {
+#ifdef V8_RUNTIME_CALL_STATS
+  if (!i::TracingFlags::is_runtime_stats_enabled()) return;
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::RuntimeCallStats* stats = i_isolate->counters()->runtime_call_stats();
+  i_isolate->counters()->worker_thread_runtime_call_stats()->AddToMainTable(
+      stats);
+  for (int i = 0; i < i::RuntimeCallStats::kNumberOfCounters; i++) {
+    i::RuntimeCallCounter* counter = stats->GetCounter(i);
+    if (counter->count() == 0) continue;
+    callback(counter->name(), counter->count(),
+             counter->time().InMicroseconds(), data);
+  }
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
 void Isolate::SetMetricsRecorder(
     const std::shared_ptr<metrics::Recorder>& metrics_recorder) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -10482,6 +10782,11 @@ void Isolate::MemoryPressureNotification(MemoryPressureLevel level) {
   i_isolate->heap()->MemoryPressureNotification(level, on_isolate_thread);
 }
 
+void Isolate::SetEnvironmentMemoryPressure(double pressure) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetEnvironmentMemoryPressure(pressure);
+}
+
 void Isolate::SetBatterySaverMode(bool battery_saver_mode_enabled) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->set_battery_saver_mode_enabled(battery_saver_mode_enabled);
@@ -10499,6 +10804,15 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   return i_isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetGCPauseBudget(double budget_in_ms) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  std::optional<base::TimeDelta> budget;
+  if (budget_in_ms > 0) {
+    budget = base::TimeDelta::FromMillisecondsD(budget_in_ms);
+  }
+  i_isolate->heap()->tracer()->SetPauseBudget(budget);
+}
+
 void Isolate::UpdateLoadStartTime() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->UpdateLoadStartTime();
@@ -10522,6 +10836,12 @@ void Isolate::SetJitCodeEventHandler(JitCodeEventOptions options,
   i_isolate->v8_file_logger()->SetCodeEventHandler(options, event_handler);
 }
 
+void Isolate::SetRegExpTierUpTicks(int ticks) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  CHECK_GE(ticks, 0);
+  i_isolate->set_regexp_tier_up_ticks(ticks);
+}
+
 void Isolate::SetStackLimit(uintptr_t stack_limit) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   CHECK(stack_limit);
@@ -11204,10 +11524,15 @@ static i::CpuProfile* ToInternal(const CpuProfile* profile) {
 
 void CpuProfile::Serialize(OutputStream* stream,
                            CpuProfile::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::CpuProfile::Serialize",
-                  "Unknown serialization format");
+  Utils::ApiCheck(format == kJSON || format == kPprof,
+                  "v8::CpuProfile::Serialize", "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::CpuProfile::Serialize",
                   "Invalid stream chunk size");
+  if (format == kPprof) {
+    i::CpuProfilePprofSerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::CpuProfileJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -11581,6 +11906,12 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(ActivityControl* control,
   return TakeHeapSnapshot(options);
 }
 
+bool HeapProfiler::TakeHeapSnapshotToStream(
+    OutputStream* stream, const HeapSnapshotOptions& options) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      options, stream);
+}
+
 std::vector<v8::Local<v8::Value>> HeapProfiler::GetDetachedJSWrapperObjects() {
   return reinterpret_cast<i::HeapProfiler*>(this)
       ->GetDetachedJSWrapperObjects();
@@ -12031,10 +12362,14 @@ void InvokeFinalizationRegistryCleanupFromTask(
   Local<v8::Context> api_context = Utils::ToLocal(native_context);
   CallDepthScope<true> call_depth_scope(i_isolate, api_context);
   VMState<OTHER> state(i_isolate);
-  Handle<Object> argv[] = {callback};
-  USE(Execution::CallBuiltin(i_isolate,
-                             i_isolate->finalization_registry_cleanup_some(),
-                             finalization_registry, arraysize(argv), argv));
+  // Run a bounded number of callbacks; the task reposts itself if cells remain.
+  int max_cells = v8_flags.finalization_registry_cleanup_batch_size;
+  if (max_cells <= 0) max_cells = -1;
+  Handle<Object> argv[] = {callback,
+                           handle(Smi::FromInt(max_cells), i_isolate)};
+  USE(Execution::CallBuiltin(
+      i_isolate, i_isolate->finalization_registry_cleanup_from_task(),
+      finalization_registry, arraysize(argv), argv));
 }
 
 template <>
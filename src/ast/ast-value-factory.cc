@@ -27,11 +27,14 @@
 
 #include "src/ast/ast-value-factory.h"
 
+#include <vector>
+
 #include "src/base/hashmap-entry.h"
 #include "src/base/logging.h"
 #include "src/common/globals.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/objects/string-table.h"
 #include "src/objects/string.h"
 #include "src/strings/string-hasher.h"
 #include "src/utils/utils-inl.h"
@@ -372,12 +375,52 @@ template <typename IsolateT>
 void AstValueFactory::Internalize(IsolateT* isolate) {
   // Strings need to be internalized before values, because values refer to
   // strings.
+  //
+  // The strings are internalized in two batches, one per encoding, so that the
+  // string table's write lock is taken at most once per batch instead of once
+  // per string. The raw hash fields were already computed by the scanner.
+  std::vector<AstRawString*> one_byte_strings;
+  std::vector<AstRawString*> two_byte_strings;
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (current->literal_bytes_.empty()) {
+      current->set_string(isolate->factory()->empty_string());
+    } else if (current->is_one_byte()) {
+      one_byte_strings.push_back(current);
+    } else {
+      two_byte_strings.push_back(current);
+    }
     current = next;
   }
 
+  auto internalize_batch = [isolate](std::vector<AstRawString*>& strings,
+                                     auto make_key) {
+    if (strings.empty()) return;
+    using Key = decltype(make_key(strings[0]));
+    std::vector<Key> keys;
+    std::vector<Key*> key_pointers;
+    keys.reserve(strings.size());
+    key_pointers.reserve(strings.size());
+    for (AstRawString* string : strings) {
+      keys.push_back(make_key(string));
+      key_pointers.push_back(&keys.back());
+    }
+    std::vector<Handle<String>> results(strings.size());
+    isolate->string_table()->LookupOrInsertMany(
+        isolate, base::VectorOf(key_pointers), base::VectorOf(results));
+    for (size_t i = 0; i < strings.size(); ++i) {
+      strings[i]->set_string(results[i]);
+    }
+  };
+  internalize_batch(one_byte_strings, [](AstRawString* string) {
+    return OneByteStringKey(string->raw_hash_field_, string->literal_bytes_);
+  });
+  internalize_batch(two_byte_strings, [](AstRawString* string) {
+    return TwoByteStringKey(
+        string->raw_hash_field_,
+        base::Vector<const uint16_t>::cast(string->literal_bytes_));
+  });
+
   ResetStrings();
 }
 template EXPORT_TEMPLATE_DEFINE(
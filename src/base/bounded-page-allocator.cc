@@ -248,6 +248,15 @@ bool BoundedPageAllocator::SealPages(void* address, size_t size) {
   return page_allocator_->SealPages(address, size);
 }
 
+bool BoundedPageAllocator::SetPreferredNumaNode(void* address, size_t size,
+                                                int node) {
+  return page_allocator_->SetPreferredNumaNode(address, size, node);
+}
+
+bool BoundedPageAllocator::AdviseHugePages(void* address, size_t size) {
+  return page_allocator_->AdviseHugePages(address, size);
+}
+
 const char* BoundedPageAllocator::AllocationStatusToString(
     AllocationStatus allocation_status) {
   switch (allocation_status) {
@@ -121,6 +121,10 @@ class V8_BASE_EXPORT BoundedPageAllocator : public v8::PageAllocator {
 
   bool SealPages(void* address, size_t size) override;
 
+  bool SetPreferredNumaNode(void* address, size_t size, int node) override;
+
+  bool AdviseHugePages(void* address, size_t size) override;
+
   AllocationStatus get_last_allocation_status() const {
     return allocation_status_;
   }
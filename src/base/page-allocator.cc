@@ -166,5 +166,14 @@ bool PageAllocator::SealPages(void* address, size_t size) {
   return base::OS::SealPages(address, size);
 }
 
+bool PageAllocator::SetPreferredNumaNode(void* address, size_t size,
+                                         int node) {
+  return base::OS::SetPreferredNumaNode(address, size, node);
+}
+
+bool PageAllocator::AdviseHugePages(void* address, size_t size) {
+  return base::OS::AdviseHugePages(address, size);
+}
+
 }  // namespace base
 }  // namespace v8
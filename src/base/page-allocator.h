@@ -54,6 +54,10 @@ class V8_BASE_EXPORT PageAllocator
 
   bool SealPages(void* address, size_t size) override;
 
+  bool SetPreferredNumaNode(void* address, size_t size, int node) override;
+
+  bool AdviseHugePages(void* address, size_t size) override;
+
  private:
   friend class v8::base::SharedMemory;
 
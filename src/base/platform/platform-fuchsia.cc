@@ -323,6 +323,14 @@ bool OS::DecommitPages(void* address, size_t size) {
 // static
 bool OS::SealPages(void* address, size_t size) { return false; }
 
+// static
+bool OS::SetPreferredNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
@@ -272,6 +272,16 @@ std::vector<OS::SharedLibraryAddress> GetSharedLibraryAddresses(FILE* fp) {
   return result;
 }
 
+std::optional<uint64_t> GetFileOffsetOfAddress(const void* address) {
+  uintptr_t address_addr = reinterpret_cast<uintptr_t>(address);
+  MemoryRegion enclosing_region = FindEnclosingMapping(address_addr, 0);
+  if (!enclosing_region.start || enclosing_region.pathname.empty()) {
+    return {};
+  }
+  return static_cast<uint64_t>(enclosing_region.offset) +
+         (address_addr - enclosing_region.start);
+}
+
 // static
 std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   return ::v8::base::GetSharedLibraryAddresses(nullptr);
@@ -36,6 +36,11 @@ struct V8_BASE_EXPORT MemoryRegion {
 V8_BASE_EXPORT std::vector<OS::SharedLibraryAddress> GetSharedLibraryAddresses(
     FILE* fp);
 
+// Returns the offset of |address| in the file backing its mapping, or nothing
+// if |address| is not in a file-backed mapping.
+V8_BASE_EXPORT std::optional<uint64_t> GetFileOffsetOfAddress(
+    const void* address);
+
 }  // namespace base
 }  // namespace v8
 
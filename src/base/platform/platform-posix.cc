@@ -635,6 +635,35 @@ bool OS::SealPages(void* address, size_t size) {
 #endif
 }
 
+// static
+bool OS::SetPreferredNumaNode(void* address, size_t size, int node) {
+#if V8_OS_LINUX && defined(__NR_mbind)
+  // MPOL_PREFERRED from <linux/mempolicy.h>, which is not available in all
+  // sysroots.
+  static constexpr int kMpolPreferred = 1;
+  static constexpr int kMaxNumaNodes = 1024;
+  static constexpr int kBitsPerWord = sizeof(unsigned long) * CHAR_BIT;
+  if (node < 0 || node >= kMaxNumaNodes) return false;
+  unsigned long node_mask[kMaxNumaNodes / kBitsPerWord] = {};
+  node_mask[node / kBitsPerWord] |= 1UL << (node % kBitsPerWord);
+  // The kernel only looks at the first |maxnode - 1| bits of the mask.
+  long ret = syscall(__NR_mbind, address, size, kMpolPreferred, node_mask,
+                     kMaxNumaNodes + 1, 0);
+  return ret == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
@@ -1195,6 +1224,40 @@ static void SetThreadName(const char* name) {
 #endif
 }
 
+#if V8_OS_LINUX && defined(__NR_sched_setattr)
+// Sets the utilization clamps of the calling thread (Linux 5.3+). On hosts
+// with heterogeneous cores the scheduler uses them for placement: a high
+// minimum keeps the thread off the efficiency cores, a low maximum keeps it
+// off the performance cores. Values are in [0, 1024]. Failures (older
+// kernels, restricted cgroups) are ignored since this is only a hint.
+static void SetThreadUtilClamp(uint32_t util_min, uint32_t util_max) {
+  // Not every libc declares struct sched_attr, so mirror the kernel's
+  // SCHED_ATTR_SIZE_VER1 layout.
+  struct {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+    uint32_t sched_util_min;
+    uint32_t sched_util_max;
+  } attr = {};
+  constexpr uint64_t kSchedFlagKeepPolicy = 0x08;
+  constexpr uint64_t kSchedFlagKeepParams = 0x10;
+  constexpr uint64_t kSchedFlagUtilClampMin = 0x20;
+  constexpr uint64_t kSchedFlagUtilClampMax = 0x40;
+  attr.size = sizeof(attr);
+  attr.sched_flags = kSchedFlagKeepPolicy | kSchedFlagKeepParams |
+                     kSchedFlagUtilClampMin | kSchedFlagUtilClampMax;
+  attr.sched_util_min = util_min;
+  attr.sched_util_max = util_max;
+  syscall(__NR_sched_setattr, 0, &attr, 0);
+}
+#endif
+
 static void* ThreadEntry(void* arg) {
   Thread* thread = reinterpret_cast<Thread*>(arg);
   // We take the lock here to make sure that pthread_create finished first since
@@ -1220,12 +1283,18 @@ static void* ThreadEntry(void* arg) {
   switch (thread->priority()) {
     case Thread::Priority::kBestEffort:
       setpriority(PRIO_PROCESS, 0, 10);
+#if V8_OS_LINUX && defined(__NR_sched_setattr)
+      SetThreadUtilClamp(0, 256);
+#endif
       break;
     case Thread::Priority::kUserVisible:
       setpriority(PRIO_PROCESS, 0, 1);
       break;
     case Thread::Priority::kUserBlocking:
       setpriority(PRIO_PROCESS, 0, 0);
+#if V8_OS_LINUX && defined(__NR_sched_setattr)
+      SetThreadUtilClamp(512, 1024);
+#endif
       break;
     case Thread::Priority::kDefault:
       break;
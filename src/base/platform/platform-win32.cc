@@ -1124,6 +1124,14 @@ bool OS::DecommitPages(void* address, size_t size) {
 // static
 bool OS::SealPages(void* address, size_t size) { return false; }
 
+// static
+bool OS::SetPreferredNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::CanReserveAddressSpace() {
   return VirtualAlloc2 != nullptr && MapViewOfFile3 != nullptr &&
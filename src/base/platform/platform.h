@@ -366,6 +366,7 @@ class V8_BASE_EXPORT OS {
   friend class v8::base::PageAllocator;
   friend class v8::base::VirtualAddressSpace;
   friend class v8::base::VirtualAddressSubspace;
+  FRIEND_TEST(OS, GetFileOffsetOfAddress);
   FRIEND_TEST(OS, RemapPages);
 
   static size_t AllocatePageSize();
@@ -410,6 +411,18 @@ class V8_BASE_EXPORT OS {
 
   V8_WARN_UNUSED_RESULT static bool SealPages(void* address, size_t size);
 
+  // Sets the preferred NUMA node for the physical pages backing the given
+  // range. Only affects pages that are not yet faulted in. Returns false if the
+  // platform does not support NUMA memory policies.
+  V8_WARN_UNUSED_RESULT static bool SetPreferredNumaNode(void* address,
+                                                         size_t size, int node);
+
+  // Advises the OS to back the given range with huge pages. Only the parts of
+  // the range that cover complete, aligned huge pages can benefit. Returns
+  // false if the platform does not support huge page advice.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+
   V8_WARN_UNUSED_RESULT static bool CanReserveAddressSpace();
 
   V8_WARN_UNUSED_RESULT static std::optional<AddressSpaceReservation>
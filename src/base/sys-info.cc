@@ -18,6 +18,12 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <sched.h>
+#include <stdio.h>
+#endif
+
+#include <algorithm>
 #include <limits>
 
 #include "src/base/logging.h"
@@ -61,6 +67,53 @@ int SysInfo::NumberOfProcessors() {
 #endif
 }
 
+#if V8_OS_LINUX
+namespace {
+
+// Returns the CPU bandwidth quota of the cgroup of this process in
+// (rounded up) processors, or 0 if there is none.
+int CgroupCpuQuota() {
+  long long quota = -1;   // NOLINT(runtime/int)
+  long long period = -1;  // NOLINT(runtime/int)
+  // cgroup v2: "<quota> <period>", where the quota may be "max".
+  if (FILE* f = fopen("/sys/fs/cgroup/cpu.max", "r")) {
+    if (fscanf(f, "%lld %lld", &quota, &period) != 2) quota = -1;
+    fclose(f);
+  } else {
+    // cgroup v1: a quota of -1 means no limit.
+    if (FILE* q = fopen("/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "r")) {
+      if (fscanf(q, "%lld", &quota) != 1) quota = -1;
+      fclose(q);
+    }
+    if (FILE* p = fopen("/sys/fs/cgroup/cpu/cpu.cfs_period_us", "r")) {
+      if (fscanf(p, "%lld", &period) != 1) period = -1;
+      fclose(p);
+    }
+  }
+  if (quota <= 0 || period <= 0) return 0;
+  long long cpus = (quota + period - 1) / period;  // NOLINT(runtime/int)
+  return static_cast<int>(
+      std::min<long long>(cpus, std::numeric_limits<int>::max()));
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
+// static
+int SysInfo::NumberOfAvailableProcessors() {
+  int result = NumberOfProcessors();
+#if V8_OS_LINUX
+  cpu_set_t cpu_set;
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    int affinity = CPU_COUNT(&cpu_set);
+    if (affinity > 0) result = std::min(result, affinity);
+  }
+  int quota = CgroupCpuQuota();
+  if (quota > 0) result = std::min(result, quota);
+#endif
+  return std::max(result, 1);
+}
+
 
 // static
 int64_t SysInfo::AmountOfPhysicalMemory() {
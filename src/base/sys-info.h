@@ -18,6 +18,13 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of logical processors/core on the current machine.
   static int NumberOfProcessors();
 
+  // Returns the number of processors this process can actually use. On Linux
+  // this takes the CPU affinity mask and the cgroup CPU quota into account, so
+  // that processes sharing a host or running in a container do not size their
+  // thread pools for the whole machine. Elsewhere this is the same as
+  // NumberOfProcessors().
+  static int NumberOfAvailableProcessors();
+
   // Returns the number of bytes of physical memory on the current machine.
   static int64_t AmountOfPhysicalMemory();
 
@@ -6,14 +6,18 @@
 
 #include <algorithm>
 
+#include "src/base/platform/elapsed-timer.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
+#include "src/debug/debug.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/heap/safepoint.h"
+#include "src/logging/counters.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/locked-queue-inl.h"
@@ -41,19 +45,25 @@ class BaselineCompilerTask {
   BaselineCompilerTask(BaselineCompilerTask&&) V8_NOEXCEPT = default;
 
   // Executed in the background thread.
-  void Compile(LocalIsolate* local_isolate) {
+  void Compile(LocalIsolate* local_isolate, bool install_off_thread,
+               const BaselineBatchCompiler* batch_compiler) {
     RCS_SCOPE(local_isolate, RuntimeCallCounterId::kCompileBackgroundBaseline);
-    base::ScopedTimer timer(v8_flags.log_function_events ? &time_taken_
-                                                         : nullptr);
-    BaselineCompiler compiler(local_isolate, shared_function_info_, bytecode_);
-    compiler.GenerateCode();
-    maybe_code_ =
-        local_isolate->heap()->NewPersistentMaybeHandle(compiler.Build());
+    {
+      base::ScopedTimer timer(v8_flags.log_function_events ? &time_taken_
+                                                           : nullptr);
+      BaselineCompiler compiler(local_isolate, shared_function_info_,
+                                bytecode_);
+      compiler.GenerateCode();
+      maybe_code_ =
+          local_isolate->heap()->NewPersistentMaybeHandle(compiler.Build());
+    }
+    if (install_off_thread) TryInstallOffThread(local_isolate, batch_compiler);
   }
 
   // Executed in the main thread.
   void Install(Isolate* isolate) {
     shared_function_info_->set_is_sparkplug_compiling(false);
+    if (installed_off_thread_) return;
     Handle<Code> code;
     if (!maybe_code_.ToHandle(&code)) return;
     if (v8_flags.print_code) {
@@ -87,17 +97,46 @@ class BaselineCompilerTask {
   }
 
  private:
+  // Publishes the code right after compiling it. The thread is unparked, so
+  // no GC (and hence no bytecode flushing or debugger heap walk discarding
+  // baseline code) can happen between the checks and the store.
+  //
+  // The checks mirror CanCompileWithBaseline(). The flag and isolate checks
+  // cannot change after the batch was created on the main thread. The
+  // debugger checks read main-thread state; instead of racing on it, the
+  // debugger disables off-thread install, at a safepoint, before it first
+  // changes any of that state.
+  void TryInstallOffThread(LocalIsolate* local_isolate,
+                           const BaselineBatchCompiler* batch_compiler) {
+    DCHECK(v8_flags.concurrent_sparkplug_off_thread_install);
+    DCHECK(!local_isolate->heap()->IsParked());
+    Handle<Code> code;
+    if (!maybe_code_.ToHandle(&code)) return;
+    if (batch_compiler->off_thread_install_disabled()) return;
+    Tagged<SharedFunctionInfo> shared = *shared_function_info_;
+    if (shared->HasBaselineCode() || !shared->HasBytecodeArray()) return;
+    // The bytecode may have been flushed and recompiled since compiling.
+    if (shared->GetBytecodeArray(local_isolate) != *bytecode_) return;
+    if (!shared->PassesFilter(v8_flags.sparkplug_filter)) return;
+    shared->set_baseline_code(*code, kReleaseStore);
+    shared->set_age(0);
+    installed_off_thread_ = true;
+  }
+
   Handle<SharedFunctionInfo> shared_function_info_;
   Handle<BytecodeArray> bytecode_;
   MaybeHandle<Code> maybe_code_;
   base::TimeDelta time_taken_;
+  bool installed_off_thread_ = false;
 };
 
 class BaselineBatchCompilerJob {
  public:
   BaselineBatchCompilerJob(Isolate* isolate,
                            DirectHandle<WeakFixedArray> task_queue,
-                           int batch_size) {
+                           int batch_size)
+      : batch_compiler_(isolate->baseline_batch_compiler()),
+        install_off_thread_(CanInstallOffThread(isolate)) {
     handles_ = isolate->NewPersistentHandles();
     tasks_.reserve(batch_size);
     for (int i = 0; i < batch_size; i++) {
@@ -123,25 +162,57 @@ class BaselineBatchCompilerJob {
 
   // Executed in the background thread.
   void Compile(LocalIsolate* local_isolate) {
+    base::ElapsedTimer timer;
+    timer.Start();
     local_isolate->heap()->AttachPersistentHandles(std::move(handles_));
     for (auto& task : tasks_) {
-      task.Compile(local_isolate);
+      task.Compile(local_isolate, install_off_thread_, batch_compiler_);
     }
     // Get the handle back since we'd need them to install the code later.
     handles_ = local_isolate->heap()->DetachPersistentHandles();
+    time_taken_to_compile_ = timer.Elapsed();
   }
 
   // Executed in the main thread.
   void Install(Isolate* isolate) {
-    HandleScope local_scope(isolate);
-    for (auto& task : tasks_) {
-      task.Install(isolate);
+    base::ElapsedTimer timer;
+    timer.Start();
+    {
+      HandleScope local_scope(isolate);
+      for (auto& task : tasks_) {
+        task.Install(isolate);
+      }
     }
+    RecordCompilationStats(isolate, timer.Elapsed());
   }
 
  private:
+  // Installing from the background thread skips the work that has to happen
+  // on the main thread, i.e. printing, tracing and logging the code.
+  static bool CanInstallOffThread(Isolate* isolate) {
+    return v8_flags.concurrent_sparkplug_off_thread_install &&
+           !v8_flags.print_code && !v8_flags.trace_baseline &&
+           !isolate->IsLoggingCodeCreation() &&
+           !isolate->baseline_batch_compiler()->off_thread_install_disabled();
+  }
+
+  void RecordCompilationStats(Isolate* isolate,
+                              base::TimeDelta time_taken_to_install) const {
+    if (tasks_.empty() || !base::TimeTicks::IsHighResolution()) return;
+    // The background time is what the main thread would have spent compiling
+    // the batch without concurrent Sparkplug.
+    Counters* const counters = isolate->counters();
+    counters->sparkplug_batch_compile_background()->AddSample(
+        static_cast<int>(time_taken_to_compile_.InMicroseconds()));
+    counters->sparkplug_batch_install()->AddSample(
+        static_cast<int>(time_taken_to_install.InMicroseconds()));
+  }
+
   std::vector<BaselineCompilerTask> tasks_;
   std::unique_ptr<PersistentHandles> handles_;
+  const BaselineBatchCompiler* const batch_compiler_;
+  const bool install_off_thread_;
+  base::TimeDelta time_taken_to_compile_;
 };
 
 class ConcurrentBaselineCompiler {
@@ -214,6 +285,8 @@ class ConcurrentBaselineCompiler {
     job_handle_->NotifyConcurrencyIncrease();
   }
 
+  bool HasBatchToInstall() const { return !outgoing_queue_.IsEmpty(); }
+
   void InstallBatch() {
     while (!outgoing_queue_.IsEmpty()) {
       std::unique_ptr<BaselineBatchCompilerJob> job;
@@ -293,6 +366,20 @@ void BaselineBatchCompiler::InstallBatch() {
   concurrent_compiler_->InstallBatch();
 }
 
+void BaselineBatchCompiler::DisableOffThreadInstall() {
+  if (!v8_flags.concurrent_sparkplug_off_thread_install) return;
+  if (off_thread_install_disabled()) return;
+  off_thread_install_disabled_.store(true, std::memory_order_release);
+  // Background threads check the bit and store the code without reaching a
+  // safepoint in between, so once they have all stopped at one, no install
+  // that saw the old value is still in flight.
+  IsolateSafepointScope safepoint_scope(isolate_->heap());
+}
+
+bool BaselineBatchCompiler::HasBatchToInstallForTesting() const {
+  return concurrent_compiler_ && concurrent_compiler_->HasBatchToInstall();
+}
+
 void BaselineBatchCompiler::EnsureQueueCapacity() {
   if (compilation_queue_.is_null()) {
     compilation_queue_ = isolate_->global_handles()->Create(
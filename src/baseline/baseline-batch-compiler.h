@@ -32,6 +32,17 @@ class BaselineBatchCompiler {
 
   void InstallBatch();
 
+  // Stops background threads from installing baseline code themselves. They
+  // cannot check the debugger state that CanCompileWithBaseline() looks at,
+  // so the debugger calls this before it first changes any of it. Waits for
+  // installs already in flight to finish.
+  void DisableOffThreadInstall();
+  bool off_thread_install_disabled() const {
+    return off_thread_install_disabled_.load(std::memory_order_acquire);
+  }
+
+  bool HasBatchToInstallForTesting() const;
+
  private:
   bool concurrent() const;
 
@@ -75,6 +86,10 @@ class BaselineBatchCompiler {
   // Batch compilation can be dynamically disabled e.g. when creating snapshots.
   bool enabled_;
 
+  // Set once the debugger may have changed state that background threads
+  // cannot check; from then on all code is installed on the main thread.
+  std::atomic<bool> off_thread_install_disabled_{false};
+
   // Handle to the background compilation jobs.
   std::unique_ptr<ConcurrentBaselineCompiler> concurrent_compiler_;
 };
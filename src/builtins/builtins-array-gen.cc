@@ -1133,7 +1133,8 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
 
   Label nan_loop(this, &index_var), not_nan_case(this),
       not_nan_loop(this, &index_var), hole_loop(this, &index_var),
-      search_notnan(this), return_found(this), return_not_found(this);
+      hole_scalar_loop(this, &index_var), search_notnan(this),
+      return_found(this), return_not_found(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
@@ -1214,6 +1215,26 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
   // Array.p.includes treats the hole as undefined.
   if (variant == kIncludes) {
     BIND(&hole_loop);
+    GotoIfNot(UniqueInt32Constant(kCanVectorize), &hole_scalar_loop);
+    {
+      Label simd_call(this);
+      Branch(UintPtrLessThan(array_length_untagged,
+                             IntPtrConstant(kSIMDThreshold)),
+             &hole_scalar_loop, &simd_call);
+      BIND(&simd_call);
+      TNode<ExternalReference> simd_function =
+          ExternalConstant(ExternalReference::array_indexof_hole_double());
+      TNode<IntPtrT> result = UncheckedCast<IntPtrT>(CallCFunction(
+          simd_function, MachineType::UintPtr(),
+          std::make_pair(MachineType::TaggedPointer(), elements),
+          std::make_pair(MachineType::UintPtr(), array_length_untagged),
+          std::make_pair(MachineType::UintPtr(), index_var.value())));
+      index_var = ReinterpretCast<IntPtrT>(result);
+      Branch(IntPtrLessThan(index_var.value(), IntPtrConstant(0)),
+             &return_not_found, &return_found);
+    }
+
+    BIND(&hole_scalar_loop);
     GotoIfNot(UintPtrLessThan(index_var.value(), array_length_untagged),
               &return_not_found);
 
@@ -1222,7 +1243,7 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
                                 MachineType::None());
 
     Increment(&index_var);
-    Goto(&hole_loop);
+    Goto(&hole_scalar_loop);
   }
 
   BIND(&return_found);
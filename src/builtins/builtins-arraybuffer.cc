@@ -235,7 +235,17 @@ static Tagged<Object> SliceHelper(BuiltinArguments args, Isolate* isolate,
 
   // * Let new be ? Construct(ctor, newLen).
   Handle<JSReceiver> new_;
-  {
+  if (!is_shared && *ctor == *constructor_fun &&
+      !array_buffer->is_resizable_by_js()) {
+    // The intrinsic constructor runs no user code, so {array_buffer} can
+    // neither be detached nor change length before the copy below, which
+    // then overwrites all of the new buffer. Skip zero-initializing it.
+    Tagged<Object> new_obj =
+        ConstructBuffer(isolate, constructor_fun, constructor_fun, new_len_obj,
+                        Handle<Object>(), InitializedFlag::kUninitialized);
+    if (IsException(new_obj, isolate)) return new_obj;
+    new_ = handle(Cast<JSReceiver>(new_obj), isolate);
+  } else {
     const int argc = 1;
 
     base::ScopedVector<Handle<Object>> argv(argc);
@@ -32,11 +32,15 @@ TNode<Object> AsyncBuiltinsAssembler::Await(TNode<Context> context,
                                             RootIndex on_reject_sfi) {
   return Await(
       context, generator, value, outer_promise,
-      [&](TNode<Context> context, TNode<NativeContext> native_context) {
+      [&](TNode<Context> context, TNode<NativeContext> native_context,
+          bool needs_reject_closure) {
         auto on_resolve = AllocateRootFunctionWithContext(
             on_resolve_sfi, context, native_context);
-        auto on_reject = AllocateRootFunctionWithContext(on_reject_sfi, context,
-                                                         native_context);
+        if (!needs_reject_closure) {
+          return std::make_pair(on_resolve, TNode<Object>(UndefinedConstant()));
+        }
+        TNode<Object> on_reject = AllocateRootFunctionWithContext(
+            on_reject_sfi, context, native_context);
         return std::make_pair(on_resolve, on_reject);
       });
 }
@@ -121,9 +125,41 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
                                       generator);
   }
 
+  TVARIABLE(Object, var_result);
+  Label if_fulfilled(this), if_general(this), done(this);
+
+  // {value} is a JSPromise at this point. Awaiting a non-promise value or an
+  // already resolved promise finds it fulfilled; then PerformPromiseThen
+  // enqueues the resolve closure right away and the reject closure could
+  // never run, so don't allocate it. Instrumentation below still gets both.
+  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
+  GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
+             promiseHookFlags),
+         &if_general);
+#ifdef V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
+  GotoIf(IsContextPromiseHookEnabled(promiseHookFlags), &if_general);
+#endif  // V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
+  {
+    const TNode<Int32T> flags =
+        LoadAndUntagToWord32ObjectField(CAST(value), JSPromise::kFlagsOffset);
+    Branch(Word32Equal(DecodeWord32<JSPromise::StatusBits>(flags),
+                       Int32Constant(v8::Promise::kFulfilled)),
+           &if_fulfilled, &if_general);
+  }
+
+  BIND(&if_fulfilled);
+  {
+    auto [on_resolve, on_reject] =
+        CreateClosures(closure_context, native_context, false);
+    var_result = CallBuiltin(Builtin::kPerformPromiseThen, native_context,
+                             value, on_resolve, on_reject, UndefinedConstant());
+    Goto(&done);
+  }
+
+  BIND(&if_general);
   // Allocate and initialize resolve and reject handlers
   auto [on_resolve, on_reject] =
-      CreateClosures(closure_context, native_context);
+      CreateClosures(closure_context, native_context, true);
 
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
@@ -131,7 +167,6 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   TVARIABLE(Object, var_throwaway, UndefinedConstant());
   Label if_instrumentation(this, Label::kDeferred),
       if_instrumentation_done(this);
-  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
   GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
              promiseHookFlags),
          &if_instrumentation);
@@ -154,8 +189,12 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   }
   BIND(&if_instrumentation_done);
 
-  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
-                     on_resolve, on_reject, var_throwaway.value());
+  var_result = CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+                           on_resolve, on_reject, var_throwaway.value());
+  Goto(&done);
+
+  BIND(&done);
+  return var_result.value();
 }
 
 TNode<JSFunction> AsyncBuiltinsAssembler::CreateUnwrapClosure(
@@ -21,9 +21,12 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
   // `on_reject` is the SharedFunctioninfo instance used to create the reject
   // closure. `on_resolve` is the SharedFunctioninfo instance used to create the
   // resolve closure. Returns the Promise-wrapped `value`.
+  // CreateClosures is called with `needs_reject_closure` false when `value`
+  // turns out to be already fulfilled; it then returns undefined instead of
+  // allocating a reject closure that could never run.
   using CreateClosures =
-      std::function<std::pair<TNode<JSFunction>, TNode<JSFunction>>(
-          TNode<Context>, TNode<NativeContext>)>;
+      std::function<std::pair<TNode<JSFunction>, TNode<Object>>(
+          TNode<Context>, TNode<NativeContext>, bool needs_reject_closure)>;
   TNode<Object> Await(TNode<Context> context,
                       TNode<JSGeneratorObject> generator, TNode<Object> value,
                       TNode<JSPromise> outer_promise,
@@ -641,9 +641,10 @@ TF_BUILTIN(AsyncGeneratorReturn, AsyncGeneratorBuiltinsAssembler) {
 
   const TNode<Smi> state = LoadGeneratorState(generator);
   auto MakeClosures = [&](TNode<Context> context,
-                          TNode<NativeContext> native_context) {
+                          TNode<NativeContext> native_context,
+                          bool needs_reject_closure) {
     TVARIABLE(JSFunction, var_on_resolve);
-    TVARIABLE(JSFunction, var_on_reject);
+    TVARIABLE(Object, var_on_reject, UndefinedConstant());
     Label closed(this), not_closed(this), done(this);
     Branch(IsGeneratorStateClosed(state), &closed, &not_closed);
 
@@ -651,18 +652,22 @@ TF_BUILTIN(AsyncGeneratorReturn, AsyncGeneratorBuiltinsAssembler) {
     var_on_resolve = AllocateRootFunctionWithContext(
         RootIndex::kAsyncGeneratorReturnClosedResolveClosureSharedFun, context,
         native_context);
-    var_on_reject = AllocateRootFunctionWithContext(
-        RootIndex::kAsyncGeneratorReturnClosedRejectClosureSharedFun, context,
-        native_context);
+    if (needs_reject_closure) {
+      var_on_reject = AllocateRootFunctionWithContext(
+          RootIndex::kAsyncGeneratorReturnClosedRejectClosureSharedFun, context,
+          native_context);
+    }
     Goto(&done);
 
     BIND(&not_closed);
     var_on_resolve = AllocateRootFunctionWithContext(
         RootIndex::kAsyncGeneratorReturnResolveClosureSharedFun, context,
         native_context);
-    var_on_reject = AllocateRootFunctionWithContext(
-        RootIndex::kAsyncGeneratorAwaitRejectClosureSharedFun, context,
-        native_context);
+    if (needs_reject_closure) {
+      var_on_reject = AllocateRootFunctionWithContext(
+          RootIndex::kAsyncGeneratorAwaitRejectClosureSharedFun, context,
+          native_context);
+    }
     Goto(&done);
 
     BIND(&done);
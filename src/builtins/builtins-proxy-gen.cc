@@ -219,14 +219,33 @@ void ProxiesCodeStubAssembler::CheckGetSetTrapResult(
   TVARIABLE(Object, var_raw_value);
 
   Label if_found_value(this), check_in_runtime(this, Label::kDeferred),
-      check_passed(this);
+      check_passed(this), check_index(this);
 
-  GotoIfNot(IsUniqueNameNoIndex(name), &check_in_runtime);
+  GotoIfNot(IsUniqueNameNoIndex(name), &check_index);
   TNode<Uint16T> instance_type = LoadInstanceType(target);
   TryGetOwnProperty(context, target, target, map, instance_type, name,
                     &if_found_value, &var_value, &var_details, &var_raw_value,
                     &check_passed, &check_in_runtime, kReturnAccessorPair);
 
+  BIND(&check_index);
+  {
+    // Elements of plain objects and arrays in a fast elements kind are
+    // always configurable, so indexed accesses on such targets (e.g. proxies
+    // wrapping arrays) can skip the runtime descriptor lookup. The raw hash
+    // field is tested directly: the name need not be internalized, and an
+    // empty hash or a forwarding index both set bits in the mask, so those
+    // names go to the runtime as well.
+    GotoIf(IsSetWord32(LoadNameRawHashField(name),
+                       Name::kDoesNotContainCachedArrayIndexMask),
+           &check_in_runtime);
+    TNode<Uint16T> target_type = LoadMapInstanceType(map);
+    GotoIfNot(Word32Or(InstanceTypeEqual(target_type, JS_OBJECT_TYPE),
+                       InstanceTypeEqual(target_type, JS_ARRAY_TYPE)),
+              &check_in_runtime);
+    Branch(IsFastElementsKind(LoadMapElementsKind(map)), &check_passed,
+           &check_in_runtime);
+  }
+
   BIND(&if_found_value);
   {
     Label throw_non_configurable_data(this, Label::kDeferred),
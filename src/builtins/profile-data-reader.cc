@@ -9,6 +9,7 @@
 #include <unordered_map>
 
 #include "src/base/lazy-instance.h"
+#include "src/base/once.h"
 #include "src/flags/flags.h"
 #include "src/utils/utils.h"
 
@@ -43,15 +44,10 @@ class ProfileDataFromFileInternal : public ProfileDataFromFile {
   bool hash_has_value_ = false;
 };
 
-const std::unordered_map<std::string, ProfileDataFromFileInternal>&
-EnsureInitProfileData() {
-  static base::LeakyObject<
-      std::unordered_map<std::string, ProfileDataFromFileInternal>>
-      data;
-  static bool initialized = false;
+using ProfileDataMap =
+    std::unordered_map<std::string, ProfileDataFromFileInternal>;
 
-  if (initialized) return *data.get();
-  initialized = true;
+void ReadProfileData(ProfileDataMap* data) {
 #ifdef LOG_BUILTIN_BLOCK_COUNT
   if (v8_flags.turbo_log_builtins_count_input) {
     std::ifstream raw_count_file(
@@ -81,7 +77,7 @@ EnsureInitProfileData() {
             strtoul(executed_count_str.c_str(), &end, 10));
         CHECK(errno == 0 && end != token.c_str());
         std::getline(line_stream, token, '\t');
-        ProfileDataFromFileInternal& block_count = (*data.get())[builtin_name];
+        ProfileDataFromFileInternal& block_count = (*data)[builtin_name];
         block_count.AddBlockExecutionCount(block_id, executed_count);
         CHECK(line_stream.eof());
       } else if (token == ProfileDataFromFileConstants::kBuiltinHashMarker) {
@@ -95,7 +91,7 @@ EnsureInitProfileData() {
         char* end = nullptr;
         int hash = static_cast<int>(strtol(token.c_str(), &end, 0));
         CHECK(errno == 0 && end != token.c_str());
-        ProfileDataFromFileInternal& block_count = (*data.get())[builtin_name];
+        ProfileDataFromFileInternal& block_count = (*data)[builtin_name];
         CHECK_IMPLIES(block_count.hash_has_value(), block_count.hash() == hash);
         block_count.set_hash(hash);
       }
@@ -103,7 +99,7 @@ EnsureInitProfileData() {
   }
 #endif
   const char* filename = v8_flags.turbo_profiling_input;
-  if (filename == nullptr) return *data.get();
+  if (filename == nullptr) return;
   std::ifstream file(filename);
   CHECK_WITH_MSG(file.good(), "Can't read log file");
   for (std::string line; std::getline(file, line);) {
@@ -129,7 +125,7 @@ EnsureInitProfileData() {
       CHECK(line_stream.eof());
       uint64_t hint = strtoul(token.c_str(), &end, 10);
       CHECK(errno == 0 && end != token.c_str());
-      ProfileDataFromFileInternal& hints_and_hash = (*data.get())[builtin_name];
+      ProfileDataFromFileInternal& hints_and_hash = (*data)[builtin_name];
       // Only the first hint for each branch will be used.
       hints_and_hash.AddHintToBlock(true_id, false_id, hint);
       CHECK(line_stream.eof());
@@ -144,7 +140,7 @@ EnsureInitProfileData() {
       char* end = nullptr;
       int hash = static_cast<int>(strtol(token.c_str(), &end, 0));
       CHECK(errno == 0 && end != token.c_str());
-      ProfileDataFromFileInternal& hints_and_hash = (*data.get())[builtin_name];
+      ProfileDataFromFileInternal& hints_and_hash = (*data)[builtin_name];
       // We allow concatenating data from several Isolates, but expect them all
       // to be running the same build. Any file with mismatched hashes for a
       // function is considered ill-formed.
@@ -153,10 +149,18 @@ EnsureInitProfileData() {
       hints_and_hash.set_hash(hash);
     }
   }
-  for (const auto& pair : *data.get()) {
+  for (const auto& pair : *data) {
     // Every function is required to have a hash in the log.
     CHECK(pair.second.hash_has_value());
   }
+}
+
+// With --turbo-profile-guided-js the profile is first needed by a concurrent
+// compile job, so it has to be read exactly once across threads.
+const ProfileDataMap& EnsureInitProfileData() {
+  static base::LeakyObject<ProfileDataMap> data;
+  static base::OnceType once = V8_ONCE_INIT;
+  base::CallOnce(&once, [] { ReadProfileData(data.get()); });
   return *data.get();
 }
 
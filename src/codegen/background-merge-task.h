@@ -89,6 +89,10 @@ class V8_EXPORT_PRIVATE BackgroundMergeTask {
   };
   std::vector<NewCompiledDataForCachedSfi> new_compiled_data_for_cached_sfis_;
 
+  // The number of SharedFunctionInfos that existed in both scripts, for the
+  // code_merge_* counters.
+  int cached_sfis_found_ = 0;
+
   enum State {
     kNotStarted,
     kPendingBackgroundWork,
@@ -13429,6 +13429,8 @@ void CodeStubAssembler::TransitionElementsKind(TNode<JSObject> object,
 
     GrowElementsCapacity(object, elements, from_kind, to_kind, array_length,
                          elements_length, bailout);
+    IncrementCounter(isolate()->counters()->elements_kind_transition_copies(),
+                     1);
     Goto(&done);
     BIND(&done);
   }
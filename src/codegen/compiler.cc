@@ -19,6 +19,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/codegen/pending-optimization-table.h"
+#include "src/codegen/process-wide-code-cache.h"
 #include "src/codegen/script-details.h"
 #include "src/codegen/unoptimized-compilation-info.h"
 #include "src/common/assert-scope.h"
@@ -40,6 +41,7 @@
 #include "src/handles/handles.h"
 #include "src/handles/maybe-handles.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/heap/local-heap-inl.h"
@@ -48,6 +50,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/js-function-inl.h"
@@ -568,6 +571,27 @@ void TurbofanCompilationJob::RecordCompilationStats(ConcurrencyMode mode,
   // http://g/chrome-metrics-team/NwwJEyL8odU/discussion for more details.
   if (!base::TimeTicks::IsHighResolution()) return;
 
+  if (isolate->metrics_recorder()->HasEmbedderRecorder()) {
+    v8::metrics::JavaScriptFunctionCompiled event;
+    event.tier = v8::metrics::JavaScriptTier::kTurbofan;
+    event.concurrent = mode == ConcurrencyMode::kConcurrent;
+    event.osr = compilation_info()->is_osr();
+    event.bytecode_size_in_bytes =
+        compilation_info()->bytecode_array()->length();
+    base::TimeDelta compile_time =
+        time_taken_to_prepare_ + time_taken_to_execute_;
+    if (event.concurrent) {
+      event.wait_duration_in_us =
+          (ElapsedTime() - compile_time - time_taken_to_finalize_)
+              .InMicroseconds();
+    }
+    event.compile_duration_in_us = compile_time.InMicroseconds();
+    event.install_duration_in_us = time_taken_to_finalize_.InMicroseconds();
+    isolate->metrics_recorder()->AddMainThreadEvent(
+        event, isolate->GetOrRegisterRecorderContextId(direct_handle(
+                   compilation_info()->closure()->native_context(), isolate)));
+  }
+
   int elapsed_microseconds = static_cast<int>(ElapsedTime().InMicroseconds());
   Counters* const counters = isolate->counters();
   counters->turbofan_ticks()->AddSample(static_cast<int>(
@@ -2300,6 +2324,7 @@ void BackgroundMergeTask::BeginMergeInBackground(
           Cast<SharedFunctionInfo>(maybe_new_sfi.GetHeapObjectAssumeWeak());
       if (maybe_old_info.IsWeak()) {
         forwarder.set_has_shared_function_info_to_forward();
+        cached_sfis_found_++;
         // The old script and the new script both have SharedFunctionInfos for
         // this function literal.
         Tagged<SharedFunctionInfo> old_sfi =
@@ -2391,9 +2416,11 @@ Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
   ConstantPoolPointerForwarder forwarder(
       isolate, isolate->main_thread_local_heap(), old_script);
 
+  int updated_sfis = 0;
   for (const auto& new_compiled_data : new_compiled_data_for_cached_sfis_) {
     Tagged<SharedFunctionInfo> sfi = *new_compiled_data.cached_sfi;
     if (!sfi->is_compiled() && new_compiled_data.new_sfi->is_compiled()) {
+      updated_sfis++;
       // Updating existing DebugInfos is not supported, but we don't expect
       // uncompiled SharedFunctionInfos to contain DebugInfos.
       DCHECK(!new_compiled_data.cached_sfi->HasDebugInfo(isolate));
@@ -2451,6 +2478,12 @@ Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
     forwarder.IterateAndForwardPointers();
   }
 
+  isolate->counters()->code_merge_reused_sfis()->Increment(cached_sfis_found_ -
+                                                          updated_sfis);
+  isolate->counters()->code_merge_updated_sfis()->Increment(updated_sfis);
+  isolate->counters()->code_merge_new_sfis()->Increment(
+      static_cast<int>(used_new_sfis_.size()));
+
   Tagged<MaybeObject> maybe_toplevel_sfi =
       old_script->infos()->get(kFunctionLiteralIdTopLevel);
   CHECK(maybe_toplevel_sfi.IsWeak());
@@ -2849,6 +2882,13 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  // Functions only start aging once they have bytecode, and flushing keeps
+  // the age, so a non-zero age on uncompiled data means that the bytecode
+  // was flushed and is now needed again.
+  if (shared_info->HasUncompiledData() && shared_info->age() != 0) {
+    isolate->heap()->bytecode_flushing_policy()->NotifyRecompiled();
+  }
+
   Handle<Script> script(Cast<Script>(shared_info->script()), isolate);
 
   // Set up parse info.
@@ -3027,10 +3067,14 @@ bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
   CompilerTracer::TraceStartBaselineCompile(isolate, shared);
   Handle<Code> code;
   base::TimeDelta time_taken;
+  const bool record_metrics =
+      isolate->metrics_recorder()->HasEmbedderRecorder();
   {
-    base::ScopedTimer timer(
-        v8_flags.trace_baseline || v8_flags.log_function_events ? &time_taken
-                                                                : nullptr);
+    base::ScopedTimer timer(v8_flags.trace_baseline ||
+                                    v8_flags.log_function_events ||
+                                    record_metrics
+                                ? &time_taken
+                                : nullptr);
     if (!GenerateBaselineCode(isolate, shared).ToHandle(&code)) {
       // TODO(leszeks): This can only fail because of an OOM. Do we want to
       // report these somehow, or silently ignore them?
@@ -3043,6 +3087,16 @@ bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
 
   CompilerTracer::TraceFinishBaselineCompile(isolate, shared, time_taken_ms);
 
+  if (record_metrics && !isolate->context().is_null()) {
+    v8::metrics::JavaScriptFunctionCompiled event;
+    event.tier = v8::metrics::JavaScriptTier::kSparkplug;
+    event.bytecode_size_in_bytes = shared->GetBytecodeArray(isolate)->length();
+    event.compile_duration_in_us = time_taken.InMicroseconds();
+    isolate->metrics_recorder()->AddMainThreadEvent(
+        event,
+        isolate->GetOrRegisterRecorderContextId(isolate->native_context()));
+  }
+
   if (IsScript(shared->script())) {
     LogFunctionCompilation(isolate, LogEventListener::CodeTag::kFunction,
                            handle(Cast<Script>(shared->script()), isolate),
@@ -3876,6 +3930,22 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     is_compiled_scope = lookup_result.is_compiled_scope();
     if (!maybe_result.is_null()) {
       compile_timer.set_hit_isolate_cache();
+    } else if (v8_flags.process_wide_code_cache && !can_consume_code_cache &&
+               natives == NOT_NATIVES_CODE) {
+      // Then check whether another isolate already compiled this source.
+      std::unique_ptr<AlignedCachedData> shared_data =
+          ProcessWideCodeCache::Get()->Lookup(isolate, source, script_details);
+      Handle<SharedFunctionInfo> result;
+      if (shared_data &&
+          CodeSerializer::Deserialize(isolate, shared_data.get(), source,
+                                      script_details, maybe_script)
+              .ToHandle(&result)) {
+        is_compiled_scope = result->is_compiled_scope(isolate);
+        if (is_compiled_scope.is_compiled()) {
+          maybe_result = result;
+          compilation_cache->PutScript(source, language_mode, result);
+        }
+      }
     } else if (can_consume_code_cache) {
       compile_timer.set_consuming_code_cache();
       // Then check cached code provided by embedder.
@@ -3965,6 +4035,10 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (v8_flags.process_wide_code_cache && natives == NOT_NATIVES_CODE) {
+        ProcessWideCodeCache::Get()->Put(isolate, source, script_details,
+                                         result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -70,6 +70,12 @@ const char* const
         "Store StubCache::secondary_->key",
         "Store StubCache::secondary_->value",
         "Store StubCache::secondary_->map",
+        "DefineOwn StubCache::primary_->key",
+        "DefineOwn StubCache::primary_->value",
+        "DefineOwn StubCache::primary_->map",
+        "DefineOwn StubCache::secondary_->key",
+        "DefineOwn StubCache::secondary_->value",
+        "DefineOwn StubCache::secondary_->map",
         // Native code counters:
         STATS_COUNTER_NATIVE_CODE_LIST(ADD_STATS_COUNTER_NAME)
 };
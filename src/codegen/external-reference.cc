@@ -1366,6 +1366,7 @@ FUNCTION_REFERENCE(string_to_array_index_function, String::ToArrayIndex)
 FUNCTION_REFERENCE(array_indexof_includes_smi_or_object,
                    ArrayIndexOfIncludesSmiOrObject)
 FUNCTION_REFERENCE(array_indexof_includes_double, ArrayIndexOfIncludesDouble)
+FUNCTION_REFERENCE(array_indexof_hole_double, ArrayIndexOfHoleDouble)
 
 static Address LexicographicCompareWrapper(Isolate* isolate, Address smi_x,
                                            Address smi_y) {
@@ -0,0 +1,151 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/process-wide-code-cache.h"
+
+#include "src/base/lazy-instance.h"
+#include "src/codegen/script-details.h"
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles.h"
+#include "src/heap/heap.h"
+#include "src/objects/string-inl.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/tasks/cancelable-task.h"
+#include "src/tasks/task-utils.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The origin options followed by the characters of |source|, which entries
+// are compared against after a hash match since a collision would run the
+// wrong code.
+std::string KeyFor(Isolate* isolate, Handle<String> source, int origin_flags) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  std::string key;
+  key.push_back(static_cast<char>(origin_flags));
+  key.push_back(content.IsOneByte() ? 1 : 2);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.append(reinterpret_cast<const char*>(chars.begin()), chars.length());
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    key.append(reinterpret_cast<const char*>(chars.begin()),
+               chars.length() * sizeof(base::uc16));
+  }
+  return key;
+}
+
+}  // namespace
+
+// static
+ProcessWideCodeCache* ProcessWideCodeCache::Get() {
+  static base::LeakyObject<ProcessWideCodeCache> cache;
+  return cache.get();
+}
+
+ProcessWideCodeCache::EntryList::iterator ProcessWideCodeCache::Find(
+    size_t hash, const std::string& key) {
+  auto range = index_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second->key == key) return it->second;
+  }
+  return entries_.end();
+}
+
+std::unique_ptr<AlignedCachedData> ProcessWideCodeCache::Lookup(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details) {
+  std::string key =
+      KeyFor(isolate, source, script_details.origin_options.Flags());
+  size_t hash = std::hash<std::string>()(key);
+  base::MutexGuard guard(&mutex_);
+  auto it = Find(hash, key);
+  if (it == entries_.end()) return nullptr;
+  entries_.splice(entries_.begin(), entries_, it);
+  // The entry may be evicted once the lock is released, so hand out a copy.
+  int length = it->data->length;
+  uint8_t* copy = NewArray<uint8_t>(length);
+  CopyBytes(copy, it->data->data, length);
+  auto result = std::make_unique<AlignedCachedData>(copy, length);
+  result->AcquireDataOwnership();
+  return result;
+}
+
+void ProcessWideCodeCache::Put(Isolate* isolate, Handle<String> source,
+                               const ScriptDetails& script_details,
+                               Handle<SharedFunctionInfo> toplevel) {
+  int origin_flags = script_details.origin_options.Flags();
+  // Serializing is about as expensive as compiling, so it is done in a task
+  // rather than on the compile path. This also picks up the bytecode of
+  // functions that are compiled lazily before the task runs.
+  GlobalHandles* global_handles = isolate->global_handles();
+  Handle<String> global_source = global_handles->Create(*source);
+  Handle<SharedFunctionInfo> global_toplevel =
+      global_handles->Create(*toplevel);
+  auto task = MakeCancelableTask(isolate, [this, isolate, global_source,
+                                           origin_flags, global_toplevel] {
+    HandleScope scope(isolate);
+    Serialize(isolate, global_source, origin_flags, global_toplevel);
+    GlobalHandles::Destroy(global_source.location());
+    GlobalHandles::Destroy(global_toplevel.location());
+  });
+  // If the task is cancelled, the global handles go away with the isolate.
+  isolate->heap()
+      ->GetForegroundTaskRunner(TaskPriority::kBestEffort)
+      ->PostNonNestableTask(std::move(task));
+}
+
+void ProcessWideCodeCache::Serialize(Isolate* isolate, Handle<String> source,
+                                     int origin_flags,
+                                     Handle<SharedFunctionInfo> toplevel) {
+  std::string key = KeyFor(isolate, source, origin_flags);
+  size_t hash = std::hash<std::string>()(key);
+  {
+    base::MutexGuard guard(&mutex_);
+    if (Find(hash, key) != entries_.end()) return;
+  }
+  // Serialize outside of the lock. If another isolate adds the same script
+  // in the meantime, its entry is kept.
+  std::unique_ptr<ScriptCompiler::CachedData> data(
+      CodeSerializer::Serialize(isolate, toplevel));
+  if (!data) return;
+  Entry entry{hash, std::move(key), std::move(data)};
+  const size_t max_size = v8_flags.process_wide_code_cache_max_size;
+  if (entry.size() > max_size) return;
+
+  base::MutexGuard guard(&mutex_);
+  if (Find(hash, entry.key) != entries_.end()) return;
+  size_ += entry.size();
+  entries_.push_front(std::move(entry));
+  index_.emplace(hash, entries_.begin());
+  while (size_ > max_size) {
+    auto victim = std::prev(entries_.end());
+    auto range = index_.equal_range(victim->hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == victim) {
+        index_.erase(it);
+        break;
+      }
+    }
+    size_ -= victim->size();
+    entries_.erase(victim);
+  }
+}
+
+size_t ProcessWideCodeCache::size_for_testing() {
+  base::MutexGuard guard(&mutex_);
+  return size_;
+}
+
+size_t ProcessWideCodeCache::entry_count_for_testing() {
+  base::MutexGuard guard(&mutex_);
+  return entries_.size();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,77 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_PROCESS_WIDE_CODE_CACHE_H_
+#define V8_CODEGEN_PROCESS_WIDE_CODE_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "include/v8-script.h"
+#include "src/base/platform/mutex.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class AlignedCachedData;
+class SharedFunctionInfo;
+class String;
+struct ScriptDetails;
+
+// A cache, shared by all isolates in the process, of the serialized code of
+// top-level scripts (see --process-wide-code-cache). Entries are found by a
+// hash of the source text and origin options, and then compared against a
+// copy of the source. The first isolate to compile a script schedules a task
+// that adds it, including the bytecode of the functions compiled until then,
+// and other isolates that compile the same source deserialize it instead of
+// compiling it again. The least recently used entries are evicted once the
+// cache exceeds --process-wide-code-cache-max-size.
+class ProcessWideCodeCache final {
+ public:
+  static ProcessWideCodeCache* Get();
+
+  // Returns a copy of the cached data for |source|, or nullptr if there is
+  // none.
+  std::unique_ptr<AlignedCachedData> Lookup(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details);
+
+  // Posts a task to serialize |toplevel| into the cache unless the cache
+  // already has an entry for its source.
+  void Put(Isolate* isolate, Handle<String> source,
+           const ScriptDetails& script_details,
+           Handle<SharedFunctionInfo> toplevel);
+
+  size_t size_for_testing();
+  size_t entry_count_for_testing();
+
+ private:
+  struct Entry {
+    size_t hash;
+    // The origin options followed by the characters of the source.
+    std::string key;
+    std::unique_ptr<ScriptCompiler::CachedData> data;
+
+    size_t size() const { return key.size() + data->length; }
+  };
+  using EntryList = std::list<Entry>;
+
+  EntryList::iterator Find(size_t hash, const std::string& key);
+  void Serialize(Isolate* isolate, Handle<String> source, int origin_flags,
+                 Handle<SharedFunctionInfo> toplevel);
+
+  base::Mutex mutex_;
+  // Ordered from most to least recently used.
+  EntryList entries_;
+  std::unordered_multimap<size_t, EntryList::iterator> index_;
+  size_t size_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_PROCESS_WIDE_CODE_CACHE_H_
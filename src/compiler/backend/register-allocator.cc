@@ -1167,6 +1167,14 @@ void RegisterAllocationData::PhiMapValue::CommitAssignment(
   }
 }
 
+// static
+bool RegisterAllocationData::UseFastAllocation(
+    const InstructionSequence* code) {
+  int threshold = v8_flags.turbo_fast_register_allocation_threshold;
+  return threshold > 0 &&
+         code->instructions().size() >= static_cast<size_t>(threshold);
+}
+
 RegisterAllocationData::RegisterAllocationData(
     const RegisterConfiguration* config, Zone* zone, Frame* frame,
     InstructionSequence* code, TickCounter* tick_counter,
@@ -4454,6 +4462,9 @@ bool LinearScanAllocator::TryReuseSpillForPhi(TopLevelLiveRange* range) {
   DCHECK(!range->HasSpillOperand());
   // Check how many operands belong to the same bundle as the output.
   LiveRangeBundle* out_bundle = range->get_bundle();
+  // Without bundles (see --turbo-fast-register-allocation-threshold), the
+  // operands don't share a spill slot with the phi.
+  if (out_bundle == nullptr) return false;
   RegisterAllocationData::PhiMapValue* phi_map_value =
       data()->GetPhiMapValueFor(range);
   const PhiInstruction* phi = phi_map_value->phi();
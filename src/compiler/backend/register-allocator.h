@@ -205,6 +205,11 @@ class RegisterAllocationData final : public ZoneObject {
 
   static constexpr int kNumberOfFixedRangesPerRegister = 2;
 
+  // Whether allocation for |code| should skip the optional phases that mainly
+  // improve code quality (live range bundling and gap move optimization), see
+  // --turbo-fast-register-allocation-threshold.
+  static bool UseFastAllocation(const InstructionSequence* code);
+
   class PhiMapValue : public ZoneObject {
    public:
     PhiMapValue(PhiInstruction* phi, const InstructionBlock* block, Zone* zone);
@@ -1750,6 +1750,10 @@ bool FeedbackVectorRef::was_once_deoptimized() const {
   return object()->was_once_deoptimized();
 }
 
+int FeedbackVectorRef::invocation_count() const {
+  return object()->invocation_count(kRelaxedLoad);
+}
+
 OptionalObjectRef MapRef::GetStrongValue(JSHeapBroker* broker,
                                          InternalIndex descriptor_index) const {
   CHECK_LT(descriptor_index.as_int(), NumberOfOwnDescriptors());
@@ -825,6 +825,7 @@ class FeedbackVectorRef : public HeapObjectRef {
   FeedbackCellRef GetClosureFeedbackCell(JSHeapBroker* broker, int index) const;
 
   bool was_once_deoptimized() const;
+  int invocation_count() const;
 };
 
 class AccessorInfoRef : public HeapObjectRef {
@@ -149,6 +149,33 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
   return out;
 }
 
+void JSInliningHeuristic::FindColdTargets(const Candidate& candidate,
+                                          bool* is_cold_target) {
+  DCHECK_LT(1, candidate.num_functions);
+  if (v8_flags.min_polymorphic_inlining_target_share <= 0) return;
+  // The invocation counts of the targets' feedback vectors serve as a
+  // histogram of the call targets. They also count calls from elsewhere, but
+  // for dispatch functions they are usually dominated by this call site.
+  int invocation_counts[kMaxCallPolymorphism] = {0};
+  int64_t total_invocation_count = 0;
+  for (int i = 0; i < candidate.num_functions; ++i) {
+    if (!candidate.bytecode[i].has_value()) continue;
+    OptionalFeedbackVectorRef feedback_vector =
+        candidate.functions[i]->feedback_vector(broker());
+    // A target without a feedback vector has not been invoked.
+    if (!feedback_vector.has_value()) continue;
+    invocation_counts[i] = feedback_vector->invocation_count();
+    total_invocation_count += invocation_counts[i];
+  }
+  if (total_invocation_count == 0) return;
+  for (int i = 0; i < candidate.num_functions; ++i) {
+    if (!candidate.bytecode[i].has_value()) continue;
+    is_cold_target[i] = invocation_counts[i] <
+                        total_invocation_count *
+                            v8_flags.min_polymorphic_inlining_target_share;
+  }
+}
+
 Reduction JSInliningHeuristic::Reduce(Node* node) {
 #if V8_ENABLE_WEBASSEMBLY
   if (mode() == kWasmWrappersOnly || mode() == kWasmFullInlining) {
@@ -180,6 +207,11 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     return NoChange();
   }
 
+  bool is_cold_target[kMaxCallPolymorphism] = {false};
+  if (candidate.num_functions > 1) {
+    FindColdTargets(candidate, is_cold_target);
+  }
+
   bool can_inline_candidate = false, candidate_is_small = true;
   candidate.total_size = 0;
   FrameState frame_state{NodeProperties::GetFrameStateInput(node)};
@@ -190,6 +222,14 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
       candidate.can_inline_function[i] = false;
       continue;
     }
+    if (is_cold_target[i]) {
+      TRACE("Not considering target #"
+            << i << " of call site #" << node->id() << ":"
+            << node->op()->mnemonic()
+            << ", because it is rarely invoked compared to the other targets");
+      candidate.can_inline_function[i] = false;
+      continue;
+    }
 
     SharedFunctionInfoRef shared =
         candidate.functions[i].has_value()
@@ -104,6 +104,10 @@ class JSInliningHeuristic final : public AdvancedReducer {
   Node* DuplicateStateValuesAndRename(Node* state_values, Node* from, Node* to,
                                       StateCloneMode mode);
   Candidate CollectFunctions(Node* node, int functions_size);
+  // For a polymorphic {candidate}, marks the targets that account for only a
+  // small share of the invocations of all targets. These are left as calls
+  // so that the inlining budget goes to the frequent targets.
+  void FindColdTargets(const Candidate& candidate, bool* is_cold_target);
 
   CommonOperatorBuilder* common() const;
   Graph* graph() const;
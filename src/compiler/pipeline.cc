@@ -204,8 +204,8 @@ class PipelineImpl final {
   // Step D. Run the code finalization pass.
   MaybeHandle<Code> FinalizeCode(bool retire_broker = true);
 
-  // Step E. Ensure all embedded maps are non-deprecated using
-  // CheckNoDeprecatedMaps.
+  // Step E. Ensure all embedded maps are non-deprecated, and collect the
+  // retained ones, using CollectRetainedMapsIfNoneDeprecated.
 
   // Step F. Install any code dependencies.
   bool CommitDependencies(Handle<Code> code);
@@ -504,22 +504,27 @@ TurbofanPipelineStatistics* CreatePipelineStatistics(
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+int HashGraphForPGO(const turboshaft::Graph* graph);
+
 // This runs instruction selection, register allocation and code generation.
 // If {use_turboshaft_instruction_selection} is set, then instruction selection
 // will run on the Turboshaft input graph directly. Otherwise, the graph is
 // translated back to TurboFan sea-of-nodes and we run the backend on that.
+// Branch hints from {profile} are only applied with Turboshaft instruction
+// selection.
 [[nodiscard]] bool GenerateCodeFromTurboshaftGraph(
     bool use_turboshaft_instruction_selection, Linkage* linkage,
     turboshaft::Pipeline& turboshaft_pipeline,
     PipelineImpl* turbofan_pipeline = nullptr,
-    std::shared_ptr<OsrHelper> osr_helper = {}) {
+    std::shared_ptr<OsrHelper> osr_helper = {},
+    const ProfileDataFromFile* profile = nullptr) {
   DCHECK_IMPLIES(!use_turboshaft_instruction_selection, turbofan_pipeline);
 
   if (use_turboshaft_instruction_selection) {
     turboshaft::PipelineData* turboshaft_data = turboshaft_pipeline.data();
     turboshaft_data->InitializeCodegenComponent(osr_helper);
     // Run Turboshaft instruction selection.
-    turboshaft_pipeline.PrepareForInstructionSelection();
+    turboshaft_pipeline.PrepareForInstructionSelection(profile);
     if (!turboshaft_pipeline.SelectInstructions(linkage)) return false;
     // We can release the graph now.
     turboshaft_data->ClearGraphComponent();
@@ -567,6 +572,12 @@ class PipelineCompilationJob final : public TurbofanCompilationJob {
   turboshaft::PipelineData turboshaft_data_;
   PipelineImpl pipeline_;
   Linkage* linkage_;
+  // Whether to try building the Turboshaft graph from a Maglev graph before
+  // falling back to the Turbofan frontend.
+  bool try_maglev_frontend_ = false;
+  // The name under which the function's basic block profile is recorded and
+  // looked up, with --turbo-profiling-js and --turbo-profile-guided-js.
+  std::string profile_name_;
 };
 
 PipelineCompilationJob::PipelineCompilationJob(
@@ -690,14 +701,25 @@ void PrintCode(Isolate* isolate, DirectHandle<Code> code,
 // part of a CheckMaps, this check will always fail afterwards and deoptimize.
 // This in turn relies on a runtime invariant that map migrations always target
 // newly allocated maps.
-bool CheckNoDeprecatedMaps(DirectHandle<Code> code, Isolate* isolate) {
+// Checks that none of the maps embedded in |code| has been deprecated
+// concurrently, and collects the ones that |code| holds weakly into
+// |retained_maps| in the same pass over the relocation info, which saves
+// main-thread time during finalization. Returns false if a map has been
+// deprecated.
+bool CollectRetainedMapsIfNoneDeprecated(
+    DirectHandle<Code> code, Isolate* isolate,
+    GlobalHandleVector<Map>* retained_maps) {
+  DCHECK(code->is_optimized_code());
+  DisallowGarbageCollection no_gc;
+  PtrComprCageBase cage_base(isolate);
   int mode_mask = RelocInfo::EmbeddedObjectModeMask();
   for (RelocIterator it(*code, mode_mask); !it.done(); it.next()) {
     DCHECK(RelocInfo::IsEmbeddedObjectMode(it.rinfo()->rmode()));
-    Tagged<HeapObject> obj = it.rinfo()->target_object(isolate);
-    if (IsMap(obj) && Cast<Map>(obj)->is_deprecated()) {
-      return false;
-    }
+    Tagged<HeapObject> obj = it.rinfo()->target_object(cage_base);
+    if (!IsMap(obj, cage_base)) continue;
+    Tagged<Map> map = Cast<Map>(obj);
+    if (map->is_deprecated()) return false;
+    if (code->IsWeakObjectInOptimizedCode(map)) retained_maps->Push(map);
   }
   return true;
 }
@@ -781,11 +803,30 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
   data_.set_start_source_position(
       compilation_info()->shared_info()->StartPosition());
 
+  if (V8_UNLIKELY(v8_flags.turbo_profiling_js ||
+                  v8_flags.turbo_profile_guided_js)) {
+    // Debug names alone are ambiguous, so the start position is added to
+    // tell apart functions of the same name.
+    std::ostringstream name;
+    name << compilation_info()->GetDebugName().get() << '@'
+         << compilation_info()->shared_info()->StartPosition();
+    profile_name_ = name.str();
+  }
+
   linkage_ = compilation_info()->zone()->New<Linkage>(
       Linkage::ComputeIncoming(compilation_info()->zone(), compilation_info()));
 
   if (compilation_info()->is_osr()) data_.InitializeOsrHelper();
 
+  // Functions that are tiering up from Maglev code are known to be supported
+  // by the Maglev graph builder, and rebuilding the Maglev graph for them is
+  // much cheaper than going through the BytecodeGraphBuilder and the Turbofan
+  // frontend.
+  try_maglev_frontend_ =
+      v8_flags.turboshaft_from_maglev_on_tier_up &&
+      compilation_info()->closure()->HasAttachedCodeKind(isolate,
+                                                         CodeKind::MAGLEV);
+
   // InitializeHeapBroker() and CreateGraph() may already use
   // IsPendingAllocation.
   isolate->heap()->PublishMainThreadPendingAllocations();
@@ -810,11 +851,40 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
                                                    data_.dependencies());
   turboshaft::Pipeline turboshaft_pipeline(&turboshaft_data_);
 
+  bool graph_built_from_maglev = false;
   if (V8_UNLIKELY(v8_flags.turboshaft_from_maglev)) {
     if (!turboshaft_pipeline.CreateGraphWithMaglev()) {
       return AbortOptimization(BailoutReason::kGraphBuildingFailed);
     }
-  } else {
+    graph_built_from_maglev = true;
+  } else if (try_maglev_frontend_) {
+    size_t inlined_function_count =
+        compilation_info()->inlined_functions().size();
+    std::optional<BailoutReason> bailout =
+        turboshaft_pipeline.TryCreateGraphWithMaglev();
+    if (bailout.has_value()) {
+      // Fall back to the Turbofan frontend. Compilation dependencies recorded
+      // while building the Maglev graph are kept; they can only make the code
+      // more conservative.
+      if (v8_flags.trace_opt) {
+        CodeTracer::Scope tracing_scope(data_.GetCodeTracer());
+        PrintF(tracing_scope.file(),
+               "[building the Turboshaft graph from Maglev failed for %s: %s, "
+               "falling back to Turbofan]\n",
+               compilation_info()->GetDebugName().get(),
+               GetBailoutReason(bailout.value()));
+      }
+      OptimizedCompilationInfo::InlinedFunctionList& inlined_functions =
+          compilation_info()->inlined_functions();
+      inlined_functions.erase(
+          inlined_functions.begin() + inlined_function_count,
+          inlined_functions.end());
+    } else {
+      graph_built_from_maglev = true;
+    }
+  }
+
+  if (!graph_built_from_maglev) {
     if (!pipeline_.CreateGraph()) {
       return AbortOptimization(BailoutReason::kGraphBuildingFailed);
     }
@@ -840,9 +910,34 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
   bool use_turboshaft_instruction_selection = false;
 #endif
 
+  int graph_hash = 0;
+  const ProfileDataFromFile* profile = nullptr;
+  if (V8_UNLIKELY(v8_flags.turbo_profiling_js ||
+                  v8_flags.turbo_profile_guided_js)) {
+    // The graph depends on the feedback the function was optimized with, so
+    // the hash rejects profiles that were taken for a different graph.
+    graph_hash = HashGraphForPGO(&turboshaft_data_.graph());
+    if (v8_flags.turbo_profile_guided_js) {
+      profile = ProfileDataFromFile::TryRead(profile_name_.c_str());
+      if (profile != nullptr && profile->hash() != graph_hash) {
+        if (v8_flags.trace_opt_verbose) {
+          PrintF("[rejected profile data for %s due to a graph change]\n",
+                 profile_name_.c_str());
+        }
+        profile = nullptr;
+      }
+    }
+  }
+
   const bool success = GenerateCodeFromTurboshaftGraph(
       use_turboshaft_instruction_selection, linkage_, turboshaft_pipeline,
-      &pipeline_, data_.osr_helper_ptr());
+      &pipeline_, data_.osr_helper_ptr(), profile);
+  BasicBlockProfilerData* profiler_data = compilation_info()->profiler_data();
+  if (profiler_data != nullptr && !profile_name_.empty()) {
+    profiler_data->SetFunctionName(
+        std::unique_ptr<char[]>(StrDup(profile_name_.c_str())));
+    profiler_data->SetHash(graph_hash);
+  }
   return success ? SUCCEEDED : FAILED;
 }
 
@@ -854,6 +949,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
   RCS_SCOPE(isolate, RuntimeCallCounterId::kOptimizeFinalizePipelineJob);
   Handle<Code> code;
   DirectHandle<NativeContext> context;
+  GlobalHandleVector<Map> maps(isolate->heap());
 #ifdef TARGET_SUPPORTS_TURBOSHAFT_INSTRUCTION_SELECTION
   if (v8_flags.turboshaft_instruction_selection) {
     turboshaft::Pipeline turboshaft_pipeline(&turboshaft_data_);
@@ -869,7 +965,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
     if (context->IsDetached()) {
       return AbortOptimization(BailoutReason::kDetachedNativeContext);
     }
-    if (!CheckNoDeprecatedMaps(code, isolate)) {
+    if (!CollectRetainedMapsIfNoneDeprecated(code, isolate, &maps)) {
       return RetryOptimization(BailoutReason::kConcurrentMapDeprecation);
     }
     if (!turboshaft_pipeline.CommitDependencies(code)) {
@@ -889,7 +985,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
     if (context->IsDetached()) {
       return AbortOptimization(BailoutReason::kDetachedNativeContext);
     }
-    if (!CheckNoDeprecatedMaps(code, isolate)) {
+    if (!CollectRetainedMapsIfNoneDeprecated(code, isolate, &maps)) {
       return RetryOptimization(BailoutReason::kConcurrentMapDeprecation);
     }
     if (!pipeline_.CommitDependencies(code)) {
@@ -899,7 +995,6 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
   }
 #endif
   compilation_info()->SetCode(code);
-  GlobalHandleVector<Map> maps = CollectRetainedMaps(isolate, code);
   RegisterWeakObjectsInOptimizedCode(isolate, context, code, std::move(maps));
   return SUCCEEDED;
 }
@@ -3994,7 +4089,12 @@ bool PipelineImpl::AllocateRegisters(CallDescriptor* call_descriptor,
   TFPipelineData* data = this->data_;
   DCHECK_NOT_NULL(data->sequence());
 
-  data->BeginPhaseKind("V8.TFRegisterAllocation");
+  // The fast mode is accounted to a separate phase kind so that both modes
+  // can be compared with --turbo-stats.
+  data->BeginPhaseKind(
+      RegisterAllocationData::UseFastAllocation(data->sequence())
+          ? "V8.TFFastRegisterAllocation"
+          : "V8.TFRegisterAllocation");
 
   bool run_verifier = v8_flags.turbo_verify_allocation;
 
@@ -4208,12 +4308,16 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   data_->sequence()->ValidateDeferredBlockExitPaths();
 #endif
 
+  const bool fast_mode =
+      RegisterAllocationData::UseFastAllocation(data->sequence());
   data->InitializeRegisterAllocationData(config, call_descriptor);
 
   Run<MeetRegisterConstraintsPhase>();
   Run<ResolvePhisPhase>();
   Run<BuildLiveRangesPhase>();
-  Run<BuildBundlesPhase>();
+  // Bundles only serve as register hints and to share spill slots between
+  // phis and their inputs.
+  if (!fast_mode) Run<BuildBundlesPhase>();
 
   TraceSequence(info(), data, "before register allocation");
   if (verifier != nullptr) {
@@ -4256,7 +4360,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
 
   Run<PopulateReferenceMapsPhase>();
 
-  if (v8_flags.turbo_move_optimization) {
+  if (v8_flags.turbo_move_optimization && !fast_mode) {
     Run<OptimizeMovesPhase>();
   }
 
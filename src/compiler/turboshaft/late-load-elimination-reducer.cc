@@ -413,6 +413,18 @@ void LateLoadEliminationAnalyzer::ProcessCall(OpIndex op_idx,
         memory_.Invalidate(op.arguments()[0], OpIndex::Invalid(),
                            JSObject::kElementsOffset);
         return;
+      case Builtin::kGrowFastDoubleElements:
+      case Builtin::kGrowFastSmiOrObjectElements:
+        // These are called when storing past the capacity of an array (most
+        // commonly from Array.prototype.push). They either replace the
+        // Elements array of the object by a larger copy or fail without side
+        // effects; in particular, they never change the map of the object
+        // (see ElementsAccessor::GrowCapacity) and never call into JS. The
+        // old Elements array isn't modified either, so loads from it remain
+        // valid.
+        memory_.Invalidate(op.arguments()[0], OpIndex::Invalid(),
+                           JSObject::kElementsOffset);
+        return;
       default:
         break;
     }
@@ -8,6 +8,8 @@
 
 #include "src/codegen/interface-descriptors-inl.h"
 #include "src/compiler/linkage.h"
+#include "src/execution/isolate.h"
+#include "src/logging/counters.h"
 #include "src/roots/roots-inl.h"
 
 namespace v8::internal::compiler::turboshaft {
@@ -24,6 +26,11 @@ const TSCallDescriptor* CreateAllocateBuiltinDescriptor(Zone* zone,
       CanThrow::kNo, LazyDeoptOnThrow::kNo, zone);
 }
 
+void CountElidedWriteBarrier(Isolate* isolate) {
+  if (isolate == nullptr) return;
+  isolate->counters()->write_barriers_elided()->Increment();
+}
+
 void MemoryAnalyzer::Run() {
   block_states[current_block] = BlockState{};
   BlockIndex end = BlockIndex(input_graph.block_count());
@@ -26,6 +26,9 @@ namespace v8::internal::compiler::turboshaft {
 const TSCallDescriptor* CreateAllocateBuiltinDescriptor(Zone* zone,
                                                         Isolate* isolate);
 
+// Bumps the write_barriers_elided counter; {isolate} is null for wasm.
+void CountElidedWriteBarrier(Isolate* isolate);
+
 inline bool ValueNeedsWriteBarrier(const Graph* graph, const Operation& value,
                                    Isolate* isolate) {
   if (value.Is<Opmask::kBitcastWordPtrToSmi>()) {
@@ -209,6 +212,9 @@ class MemoryOptimizationReducer : public Next {
       }
     }
     if (analyzer_->skipped_write_barriers.count(ig_index)) {
+      if (store.write_barrier != WriteBarrierKind::kNoWriteBarrier) {
+        CountElidedWriteBarrier(__ data()->isolate());
+      }
       __ Store(__ MapToNewGraph(store.base()), __ MapToNewGraph(store.index()),
                __ MapToNewGraph(store.value()), store.kind, store.stored_rep,
                WriteBarrierKind::kNoWriteBarrier, store.offset,
@@ -121,6 +121,17 @@ class Pipeline {
   }
 
   bool CreateGraphWithMaglev() {
+    if (std::optional<BailoutReason> bailout = TryCreateGraphWithMaglev()) {
+      data_->info()->AbortOptimization(bailout.value());
+      return false;
+    }
+    return true;
+  }
+
+  // Like CreateGraphWithMaglev, but leaves it to the caller to decide what to
+  // do on bailout. The graph component is cleared in that case, so that the
+  // caller can build the graph from Turbofan instead.
+  std::optional<BailoutReason> TryCreateGraphWithMaglev() {
     UnparkedScopeIfNeeded unparked_scope(data_->broker());
 
     BeginPhaseKind("V8.TFGraphCreation");
@@ -129,12 +140,10 @@ class Pipeline {
         Run<turboshaft::MaglevGraphBuildingPhase>();
     EndPhaseKind();
 
-    if (bailout.has_value()) {
-      data_->info()->AbortOptimization(bailout.value());
-      return false;
+    if (bailout.has_value() && data_->has_graph()) {
+      data_->ClearGraphComponent();
     }
-
-    return true;
+    return bailout;
   }
 
   bool CreateGraphFromTurbofan(compiler::TFPipelineData* turbofan_data,
@@ -219,9 +228,16 @@ class Pipeline {
 
   void PrepareForInstructionSelection(
       const ProfileDataFromFile* profile = nullptr) {
-    if (V8_UNLIKELY(data()->pipeline_kind() == TurboshaftPipelineKind::kCSA ||
-                    data()->pipeline_kind() ==
-                        TurboshaftPipelineKind::kTSABuiltin)) {
+    const bool is_builtin =
+        data()->pipeline_kind() == TurboshaftPipelineKind::kCSA ||
+        data()->pipeline_kind() == TurboshaftPipelineKind::kTSABuiltin;
+    // Optimized JavaScript functions take part in basic block profiling and
+    // profile application only when asked to. The caller only passes a
+    // profile for them with --turbo-profile-guided-js.
+    const bool is_profiled_js =
+        data()->pipeline_kind() == TurboshaftPipelineKind::kJS &&
+        (v8_flags.turbo_profiling_js || profile);
+    if (V8_UNLIKELY(is_builtin || is_profiled_js)) {
       if (profile) {
         Run<ProfileApplicationPhase>(profile);
       }
@@ -232,7 +248,8 @@ class Pipeline {
         BasicBlockCallGraphProfiler::StoreCallGraph(info(), data()->graph());
       }
 
-      if (v8_flags.turbo_profiling) {
+      if (is_builtin ? v8_flags.turbo_profiling.value()
+                     : v8_flags.turbo_profiling_js.value()) {
         UnparkedScopeIfNeeded unparked_scope(data()->broker());
 
         // Basic block profiling disables concurrent compilation, so handle
@@ -321,7 +338,12 @@ class Pipeline {
   }
 
   bool AllocateRegisters(CallDescriptor* call_descriptor) {
-    BeginPhaseKind("V8.TFRegisterAllocation");
+    // The fast mode is accounted to a separate phase kind so that both modes
+    // can be compared with --turbo-stats.
+    BeginPhaseKind(
+        RegisterAllocationData::UseFastAllocation(data_->sequence())
+            ? "V8.TFFastRegisterAllocation"
+            : "V8.TFRegisterAllocation");
 
     bool run_verifier = v8_flags.turbo_verify_allocation;
 
@@ -403,12 +425,16 @@ class Pipeline {
     data_->sequence()->ValidateDeferredBlockExitPaths();
 #endif
 
+    const bool fast_mode =
+        RegisterAllocationData::UseFastAllocation(data_->sequence());
     data_->InitializeRegisterComponent(config, call_descriptor);
 
     Run<MeetRegisterConstraintsPhase>();
     Run<ResolvePhisPhase>();
     Run<BuildLiveRangesPhase>();
-    Run<BuildLiveRangeBundlesPhase>();
+    // Bundles only serve as register hints and to share spill slots between
+    // phis and their inputs.
+    if (!fast_mode) Run<BuildLiveRangeBundlesPhase>();
 
     TraceSequence("before register allocation");
     if (verifier != nullptr) {
@@ -451,7 +477,7 @@ class Pipeline {
 
     Run<PopulateReferenceMapsPhase>();
 
-    if (v8_flags.turbo_move_optimization) {
+    if (v8_flags.turbo_move_optimization && !fast_mode) {
       Run<OptimizeMovesPhase>();
     }
 
@@ -1028,6 +1028,26 @@ void WasmRevecAnalyzer::Run() {
   }
 }
 
+namespace {
+
+// Instruction cost of emitting a force packed node, on top of the 128-bit
+// instructions that are emitted for it anyway.
+int ForcePackCost(PackNode::ForcePackType type) {
+  switch (type) {
+    case PackNode::ForcePackType::kNone:
+      UNREACHABLE();
+    case PackNode::ForcePackType::kSplat:
+      // One 128-bit node and an insert (or broadcast) into the upper lane.
+      return 1;
+    case PackNode::ForcePackType::kGeneral:
+      // Both 128-bit nodes and an insert; nothing is saved, so this offsets
+      // the default saving of the pack.
+      return 2;
+  }
+}
+
+}  // namespace
+
 bool WasmRevecAnalyzer::DecideVectorize() {
   TRACE("Enter %s\n", __func__);
   int save = 0, cost = 0;
@@ -1040,10 +1060,33 @@ bool WasmRevecAnalyzer::DecideVectorize() {
         }
 
         if (pnode->is_force_pack()) {
-          cost += 2;
+          cost += ForcePackCost(pnode->force_pack_type());
           return;
         }
 
+        // All packed shuffles are {ShufflePackNode}s, see {BuildTreeRec}.
+        if (graph_.Get(nodes[0]).opcode == Opcode::kSimd128Shuffle) {
+          const ShufflePackNode* shuffle =
+              static_cast<const ShufflePackNode*>(pnode);
+          switch (shuffle->info().kind()) {
+            case ShufflePackNode::SpecificInfo::Kind::kS256Load32Transform:
+            case ShufflePackNode::SpecificInfo::Kind::kS256Load64Transform:
+              // The splat shuffle and its load become a single broadcast
+              // load, although the nodes themselves are a splat.
+              save++;
+              break;
+#ifdef V8_TARGET_ARCH_X64
+            case ShufflePackNode::SpecificInfo::Kind::kShufd:
+            case ShufflePackNode::SpecificInfo::Kind::kShufps:
+            case ShufflePackNode::SpecificInfo::Kind::kS32x8UnpackLow:
+            case ShufflePackNode::SpecificInfo::Kind::kS32x8UnpackHigh:
+              // These operate within 128-bit lanes, so they cost the same as
+              // one of the 128-bit shuffles.
+              break;
+#endif  // V8_TARGET_ARCH_X64
+          }
+        }
+
 #ifdef V8_TARGET_ARCH_X64
         // On x64 platform, we dont emit extract for lane 0 as the source ymm
         // register is alias to the corresponding xmm register in lower 128-bit.
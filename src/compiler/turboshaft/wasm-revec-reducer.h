@@ -266,7 +266,7 @@ class PackNode : public NON_EXPORTED_BASE(ZoneObject) {
     return force_pack_type_ != ForcePackType::kNone;
   }
   void set_force_pack_type(ForcePackType type) { force_pack_type_ = type; }
-  ForcePackType force_pack_type() { return force_pack_type_; }
+  ForcePackType force_pack_type() const { return force_pack_type_; }
 
   void set_force_packed_pair(OpIndex left, OpIndex right) {
     force_packed_pair_ = {left, right};
@@ -321,7 +321,7 @@ class ShufflePackNode : public PackNode {
 #endif  // V8_TARGET_ARCH_X64
     };
 
-    Kind kind() { return kind_; }
+    Kind kind() const { return kind_; }
     void set_kind(Kind kind) { kind_ = kind; }
 
     void set_splat_index(uint8_t value) {
@@ -367,6 +367,7 @@ class ShufflePackNode : public PackNode {
   }
 
   SpecificInfo& info() { return info_; }
+  const SpecificInfo& info() const { return info_; }
 
  private:
   SpecificInfo info_;
@@ -86,6 +86,14 @@ size_t ZoneStats::GetTotalAllocatedBytes() const {
   return total_deleted_bytes_ + GetCurrentAllocatedBytes();
 }
 
+size_t ZoneStats::GetPooledSegmentBytes() const {
+  return allocator_->GetPooledMemoryUsage();
+}
+
+size_t ZoneStats::GetPooledSegmentHits() const {
+  return allocator_->GetPooledSegmentHits();
+}
+
 Zone* ZoneStats::NewEmptyZone(const char* zone_name,
                               bool support_zone_compression) {
   Zone* zone = new Zone(allocator_, zone_name, support_zone_compression);
@@ -97,6 +97,11 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   size_t GetTotalAllocatedBytes() const;
   size_t GetCurrentAllocatedBytes() const;
 
+  // Statistics of the segment pool of the underlying allocator, which is
+  // shared with other compilation jobs.
+  size_t GetPooledSegmentBytes() const;
+  size_t GetPooledSegmentHits() const;
+
  private:
   Zone* NewEmptyZone(const char* zone_name, bool support_zone_compression);
   void ReturnZone(Zone* zone);
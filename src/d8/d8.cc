@@ -4805,29 +4805,39 @@ void SourceGroup::JoinThread(const i::ParkedScope& parked) {
   thread_->Join();
 }
 
+SerializationDataQueue::SerializationDataQueue()
+    : head_(new Node), tail_(head_) {}
+
+SerializationDataQueue::~SerializationDataQueue() {
+  Clear();
+  delete head_;
+}
+
 void SerializationDataQueue::Enqueue(std::unique_ptr<SerializationData> data) {
-  base::MutexGuard lock_guard(&mutex_);
-  data_.push_back(std::move(data));
+  Node* node = new Node;
+  node->data = std::move(data);
+  tail_->next.store(node, std::memory_order_release);
+  tail_ = node;
 }
 
 bool SerializationDataQueue::Dequeue(
     std::unique_ptr<SerializationData>* out_data) {
   out_data->reset();
-  base::MutexGuard lock_guard(&mutex_);
-  if (data_.empty()) return false;
-  *out_data = std::move(data_[0]);
-  data_.erase(data_.begin());
+  Node* next = head_->next.load(std::memory_order_acquire);
+  if (next == nullptr) return false;
+  *out_data = std::move(next->data);
+  delete head_;
+  head_ = next;
   return true;
 }
 
 bool SerializationDataQueue::IsEmpty() {
-  base::MutexGuard lock_guard(&mutex_);
-  return data_.empty();
+  return head_->next.load(std::memory_order_acquire) == nullptr;
 }
 
 void SerializationDataQueue::Clear() {
-  base::MutexGuard lock_guard(&mutex_);
-  data_.clear();
+  std::unique_ptr<SerializationData> data;
+  while (Dequeue(&data)) {}
 }
 
 Worker::Worker(Isolate* parent_isolate, const char* script)
@@ -5178,7 +5188,8 @@ void Worker::PostMessageOut(const v8::FunctionCallbackInfo<v8::Value>& info) {
   }
 
   Local<Value> message = info[0];
-  Local<Value> transfer = Undefined(isolate);
+  Local<Value> transfer =
+      info.Length() >= 2 ? info[1] : Undefined(isolate).As<Value>();
   std::unique_ptr<SerializationData> data =
       Shell::SerializeValue(isolate, message, transfer);
   if (data) {
@@ -5443,6 +5454,13 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (FlagWithArgMatches("--repeat-compile", &flag_value, argc, argv,
                                   &i)) {
       options.repeat_compile = atoi(flag_value);
+    } else if (FlagWithArgMatches("--load-isolates", &flag_value, argc, argv,
+                                  &i)) {
+      options.load_isolates = atoi(flag_value);
+    } else if (FlagWithArgMatches("--load-duration", &flag_value, argc, argv,
+                                  &i)) {
+      // Value is expressed in milliseconds.
+      options.load_duration = atoi(flag_value);
     } else if (FlagWithArgMatches("--max-serializer-memory", &flag_value, argc,
                                   argv, &i)) {
       // Value is expressed in MB.
@@ -5525,6 +5543,10 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     FATAL("Flag --expose-fast-api is incompatible with --stress-snapshot.");
   }
 
+  if (options.load_isolates > 0 && options.num_isolates > 1) {
+    FATAL("Flag --load-isolates is incompatible with --isolate.");
+  }
+
   // Set up isolated source groups.
   options.isolate_sources = new SourceGroup[options.num_isolates];
   internal::g_num_isolates_for_testing = options.num_isolates;
@@ -5558,7 +5580,131 @@ bool Shell::SetOptions(int argc, char* argv[]) {
   return true;
 }
 
+namespace {
+
+// Runs the main source group in its own isolate over and over until the
+// deadline, each time in a fresh context, and records how long every run
+// took.
+class LoadGeneratorThread : public base::Thread {
+ public:
+  LoadGeneratorThread(SourceGroup* group, base::TimeTicks deadline)
+      : base::Thread(GetThreadOptions("LoadGeneratorThread")),
+        group_(group),
+        deadline_(deadline) {}
+
+  void Run() override {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    Isolate* isolate = Isolate::New(create_params);
+    {
+      Isolate::Scope isolate_scope(isolate);
+      D8Console console(isolate);
+      Shell::Initialize(isolate, &console, false);
+      PerIsolateData data(isolate);
+      while (success_ && base::TimeTicks::Now() < deadline_) {
+        base::TimeTicks start = base::TimeTicks::Now();
+        Global<Context> global_context;
+        HandleScope scope(isolate);
+        {
+          Local<Context> context;
+          if (!Shell::CreateEvaluationContext(isolate).ToLocal(&context)) {
+            success_ = false;
+            break;
+          }
+          global_context.Reset(isolate, context);
+        }
+        PerIsolateData::RealmScope realm_scope(isolate, global_context);
+        global_context.Get(isolate)->Enter();
+        success_ = group_->Execute(isolate);
+        global_context.Get(isolate)->Exit();
+        success_ &= Shell::FinishExecuting(isolate, global_context);
+        latencies_.push_back(base::TimeTicks::Now() - start);
+      }
+      Shell::ResetOnProfileEndListener(isolate);
+    }
+    isolate->Dispose();
+  }
+
+  bool success() const { return success_; }
+  const std::vector<base::TimeDelta>& latencies() const { return latencies_; }
+
+ private:
+  SourceGroup* const group_;
+  const base::TimeTicks deadline_;
+  bool success_ = true;
+  std::vector<base::TimeDelta> latencies_;
+};
+
+void PrintLoadGeneratorReport(
+    const std::vector<std::unique_ptr<LoadGeneratorThread>>& threads,
+    base::TimeDelta elapsed) {
+  std::vector<double> latencies_ms;
+  for (const auto& thread : threads) {
+    for (base::TimeDelta latency : thread->latencies()) {
+      latencies_ms.push_back(latency.InMillisecondsF());
+    }
+  }
+  std::sort(latencies_ms.begin(), latencies_ms.end());
+  double seconds = elapsed.InSecondsF();
+  printf("Load generator: %zu isolates for %.0f ms\n", threads.size(),
+         elapsed.InMillisecondsF());
+  for (size_t i = 0; i < threads.size(); i++) {
+    printf("  isolate %zu: %zu runs\n", i, threads[i]->latencies().size());
+  }
+  printf("  total: %zu runs, %.2f runs/s\n", latencies_ms.size(),
+         latencies_ms.size() / seconds);
+  if (latencies_ms.empty()) return;
+  auto percentile = [&](double p) {
+    return latencies_ms[static_cast<size_t>(p * (latencies_ms.size() - 1))];
+  };
+  printf("  latency (ms): min %.3f, p50 %.3f, p90 %.3f, p99 %.3f, max %.3f\n",
+         latencies_ms.front(), percentile(0.5), percentile(0.9),
+         percentile(0.99), latencies_ms.back());
+  // Power-of-two buckets, starting at 1 ms.
+  std::vector<size_t> buckets;
+  for (double latency : latencies_ms) {
+    size_t bucket = 0;
+    while ((1 << bucket) <= latency) bucket++;
+    if (bucket >= buckets.size()) buckets.resize(bucket + 1);
+    buckets[bucket]++;
+  }
+  printf("  latency histogram:\n");
+  for (size_t bucket = 0; bucket < buckets.size(); bucket++) {
+    if (buckets[bucket] == 0) continue;
+    double lower = bucket == 0 ? 0 : 1 << (bucket - 1);
+    printf("    [%6.0f, %6d) ms: %zu\n", lower, 1 << bucket, buckets[bucket]);
+  }
+}
+
+}  // namespace
+
+int Shell::RunLoadGenerator(v8::Isolate* isolate) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  base::TimeTicks start = base::TimeTicks::Now();
+  base::TimeTicks deadline =
+      start + base::TimeDelta::FromMilliseconds(options.load_duration);
+  std::vector<std::unique_ptr<LoadGeneratorThread>> threads;
+  for (int i = 0; i < options.load_isolates; i++) {
+    threads.push_back(std::make_unique<LoadGeneratorThread>(
+        &options.isolate_sources[0], deadline));
+    CHECK(threads.back()->Start());
+  }
+  // Park the main thread to prevent deadlocks in shared GCs.
+  i_isolate->main_thread_local_heap()->ExecuteMainThreadWhileParked(
+      [&threads](const i::ParkedScope& parked) {
+        USE(parked);
+        for (auto& thread : threads) thread->Join();
+      });
+  PrintLoadGeneratorReport(threads, base::TimeTicks::Now() - start);
+
+  bool success = true;
+  for (const auto& thread : threads) success &= thread->success();
+  if (Shell::options.no_fail) return 0;
+  return (success == Shell::options.expected_to_throw ? 1 : 0);
+}
+
 int Shell::RunMain(v8::Isolate* isolate, bool last_run) {
+  if (options.load_isolates > 0) return RunLoadGenerator(isolate);
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
 
   for (int i = 1; i < options.num_isolates; ++i) {
@@ -5,6 +5,7 @@
 #ifndef V8_D8_D8_H_
 #define V8_D8_D8_H_
 
+#include <atomic>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -172,16 +173,31 @@ class SerializationData {
   friend class Serializer;
 };
 
+// Unbounded lock-free queue that passes messages from a single producer
+// thread to a single consumer thread. Enqueue() must only be called by the
+// producer, all other methods only by the consumer.
 class SerializationDataQueue {
  public:
+  SerializationDataQueue();
+  ~SerializationDataQueue();
+  SerializationDataQueue(const SerializationDataQueue&) = delete;
+  SerializationDataQueue& operator=(const SerializationDataQueue&) = delete;
+
   void Enqueue(std::unique_ptr<SerializationData> data);
   bool Dequeue(std::unique_ptr<SerializationData>* data);
   bool IsEmpty();
   void Clear();
 
  private:
-  base::Mutex mutex_;
-  std::vector<std::unique_ptr<SerializationData>> data_;
+  struct Node {
+    std::unique_ptr<SerializationData> data;
+    std::atomic<Node*> next{nullptr};
+  };
+
+  // A sentinel whose data has already been dequeued. Owned by the consumer.
+  Node* head_;
+  // The most recently enqueued node. Owned by the producer.
+  Node* tail_;
 };
 
 class Worker : public std::enable_shared_from_this<Worker> {
@@ -446,6 +462,10 @@ class ShellOptions {
       "wait-for-background-tasks", true};
   DisallowReassignment<bool> simulate_errors = {"simulate-errors", false};
   DisallowReassignment<int> stress_runs = {"stress-runs", 1};
+  // Number of isolates that run the scripts in a loop for load_duration
+  // milliseconds, or 0 to run them once as usual.
+  DisallowReassignment<int> load_isolates = {"load-isolates", 0};
+  DisallowReassignment<int> load_duration = {"load-duration", 10000};
   DisallowReassignment<bool> interactive_shell = {"shell", false};
   bool test_shell = false;
   DisallowReassignment<bool> expected_to_throw = {"throws", false};
@@ -805,6 +825,7 @@ class Shell : public i::AllStatic {
   static Local<String> Stringify(Isolate* isolate, Local<Value> value);
   static void RunShell(Isolate* isolate);
   static bool RunMainIsolate(Isolate* isolate, bool keep_context_alive);
+  static int RunLoadGenerator(Isolate* isolate);
   static bool SetOptions(int argc, char* argv[]);
 
   static void NodeTypeCallback(const v8::FunctionCallbackInfo<v8::Value>& info);
@@ -68,6 +68,8 @@ bool DateParser::Parse(Isolate* isolate, base::Vector<Char> str, double* out) {
   //  the input can no longer be a valid legacy date, since the "T" is a
   //  garbage string after a number has been read.
 
+  if (TryParseISODateTime(str, out)) return true;
+
   // First try getting as far as possible with as ES5 Date Time String.
   DateToken next_unhandled_token = ParseES5DateTime(&scanner, &day, &time, &tz);
   if (next_unhandled_token.IsInvalid()) return false;
@@ -233,6 +235,55 @@ bool DateParser::InputReader<Char>::SkipParentheses() {
   return true;
 }
 
+template <typename Char>
+bool DateParser::TryParseISODateTime(base::Vector<Char> str, double* out) {
+  // yyyy-MM-DDTHH:mm:ssZ or yyyy-MM-DDTHH:mm:ss.sssZ.
+  static constexpr int kLengthWithoutMs = 20;
+  static constexpr int kLengthWithMs = 24;
+  const int length = str.length();
+  if (length != kLengthWithoutMs && length != kLengthWithMs) return false;
+  if (str[4] != '-' || str[7] != '-' || str[10] != 'T' || str[13] != ':' ||
+      str[16] != ':' || str[length - 1] != 'Z') {
+    return false;
+  }
+  bool valid = true;
+  auto digits = [&](int start, int count) {
+    int value = 0;
+    for (int i = start; i < start + count; i++) {
+      if (!IsDecimalDigit(str[i])) valid = false;
+      value = value * 10 + (str[i] - '0');
+    }
+    return value;
+  };
+  int year = digits(0, 4);
+  int month = digits(5, 2);
+  int day = digits(8, 2);
+  int hour = digits(11, 2);
+  int minute = digits(14, 2);
+  int second = digits(17, 2);
+  int millisecond = 0;
+  if (length == kLengthWithMs) {
+    if (str[19] != '.') return false;
+    millisecond = digits(20, 3);
+  }
+  // Hour 24 is left to the general parser, which only allows it for
+  // midnight at the end of a day.
+  if (!valid || !DayComposer::IsMonth(month) || !DayComposer::IsDay(day) ||
+      !TimeComposer::IsHour(hour) || !TimeComposer::IsMinute(minute) ||
+      !TimeComposer::IsSecond(second)) {
+    return false;
+  }
+  out[YEAR] = year;
+  out[MONTH] = month - 1;  // 0-based
+  out[DAY] = day;
+  out[HOUR] = hour;
+  out[MINUTE] = minute;
+  out[SECOND] = second;
+  out[MILLISECOND] = millisecond;
+  out[UTC_OFFSET] = 0;
+  return true;
+}
+
 template <typename Char>
 DateParser::DateToken DateParser::ParseES5DateTime(
     DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
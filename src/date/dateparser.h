@@ -360,6 +360,13 @@ class DateParser : public AllStatic {
   static DateParser::DateToken ParseES5DateTime(
       DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
       TimeZoneComposer* tz);
+
+  // Fast path for the format produced by Date.prototype.toISOString with a
+  // four-digit year: yyyy-MM-DDTHH:mm:ss[.sss]Z. Fills out the output array
+  // like Parse and returns true if {str} has exactly that format and valid
+  // components; otherwise returns false and the general parser must be used.
+  template <typename Char>
+  static bool TryParseISODateTime(base::Vector<Char> str, double* output);
 };
 
 }  // namespace internal
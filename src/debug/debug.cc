@@ -9,6 +9,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/base/platform/mutex.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/builtins/builtins.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
@@ -2321,6 +2322,7 @@ Handle<DebugInfo> Debug::GetOrCreateDebugInfo(
     return handle(di.value(), isolate_);
   }
 
+  DisableOffThreadBaselineInstall();
   Handle<DebugInfo> debug_info = isolate_->factory()->NewDebugInfo(shared);
   debug_infos_.Insert(*shared, *debug_info);
   return debug_info;
@@ -2801,6 +2803,7 @@ void Debug::UpdateState() {
   bool is_active = debug_delegate_ != nullptr;
   if (is_active == is_active_) return;
   if (is_active) {
+    DisableOffThreadBaselineInstall();
     // Note that the debug context could have already been loaded to
     // bootstrap test cases.
     isolate_->compilation_cache()->DisableScriptAndEval();
@@ -2816,10 +2819,18 @@ void Debug::UpdateState() {
 
 void Debug::UpdateHookOnFunctionCall() {
   static_assert(LastStepAction == StepInto);
-  hook_on_function_call_ =
+  bool hook_on_function_call =
       thread_local_.last_step_action_ == StepInto ||
       isolate_->debug_execution_mode() == DebugInfo::kSideEffects ||
       thread_local_.break_on_next_function_call_;
+  if (hook_on_function_call) DisableOffThreadBaselineInstall();
+  hook_on_function_call_ = hook_on_function_call;
+}
+
+void Debug::DisableOffThreadBaselineInstall() {
+#ifdef V8_ENABLE_SPARKPLUG
+  isolate_->baseline_batch_compiler()->DisableOffThreadInstall();
+#endif  // V8_ENABLE_SPARKPLUG
 }
 
 void Debug::HandleDebugBreak(IgnoreBreakMode ignore_break_mode,
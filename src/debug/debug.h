@@ -510,6 +510,10 @@ class V8_EXPORT_PRIVATE Debug {
   void UpdateHookOnFunctionCall();
   void Unload();
 
+  // Makes concurrent Sparkplug install its code on the main thread only, where
+  // it sees the debugger state. Called before that state first changes.
+  void DisableOffThreadBaselineInstall();
+
   // Return the number of virtual frames below debugger entry.
   int CurrentFrameCount();
 
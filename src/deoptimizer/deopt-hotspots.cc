@@ -0,0 +1,34 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deopt-hotspots.h"
+
+#include <algorithm>
+
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+int DeoptHotspots::Record(Tagged<SharedFunctionInfo> shared,
+                          BytecodeOffset bytecode_offset,
+                          DeoptimizeReason reason) {
+  Tagged<Object> script = shared->script();
+  Site site{IsScript(script) ? Cast<Script>(script)->id() : 0,
+            shared->StartPosition(), bytecode_offset.ToInt(), reason};
+  auto it = counts_.find(site);
+  if (it != counts_.end()) return ++it->second;
+  if (counts_.size() >= kMaxSites) {
+    auto coldest = std::min_element(
+        counts_.begin(), counts_.end(),
+        [](const auto& a, const auto& b) { return a.second < b.second; });
+    counts_.erase(coldest);
+  }
+  counts_.emplace(site, 1);
+  return 1;
+}
+
+}  // namespace internal
+}  // namespace v8
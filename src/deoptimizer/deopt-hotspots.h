@@ -0,0 +1,73 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEOPTIMIZER_DEOPT_HOTSPOTS_H_
+#define V8_DEOPTIMIZER_DEOPT_HOTSPOTS_H_
+
+#include <unordered_map>
+
+#include "src/base/functional.h"
+#include "src/deoptimizer/deoptimize-reason.h"
+#include "src/objects/tagged.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+
+// Counts deoptimizations per site, i.e. per function, bytecode offset and
+// reason, so that functions stuck in a deopt loop can be reported. Functions
+// are identified by their script id and source position rather than by the
+// SharedFunctionInfo, which keeps the table free of heap references. The
+// table is bounded; once it is full, a site with the lowest count makes room
+// for a new one, so that a long-running process keeps its hottest sites
+// rather than its earliest ones.
+class DeoptHotspots {
+ public:
+  static constexpr size_t kMaxSites = 1024;
+
+  struct Site {
+    int script_id;
+    int function_position;
+    int bytecode_offset;
+    DeoptimizeReason reason;
+
+    bool operator==(const Site& other) const {
+      return script_id == other.script_id &&
+             function_position == other.function_position &&
+             bytecode_offset == other.bytecode_offset &&
+             reason == other.reason;
+    }
+  };
+
+  // Records a deoptimization and returns how often the site has deoptimized
+  // so far, including this time.
+  int Record(Tagged<SharedFunctionInfo> shared, BytecodeOffset bytecode_offset,
+             DeoptimizeReason reason);
+
+  // Calls |callback| with every tracked site and its count.
+  template <typename Callback>
+  void ForEach(Callback callback) const {
+    for (const auto& [site, count] : counts_) callback(site, count);
+  }
+
+  size_t size() const { return counts_.size(); }
+
+ private:
+  struct SiteHash {
+    size_t operator()(const Site& site) const {
+      return base::hash_combine(site.script_id, site.function_position,
+                                site.bytecode_offset,
+                                static_cast<uint8_t>(site.reason));
+    }
+  };
+
+  std::unordered_map<Site, int, SiteHash> counts_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEOPTIMIZER_DEOPT_HOTSPOTS_H_
@@ -198,6 +198,15 @@ void BasicBlockProfiler::Log(Isolate* isolate, std::ostream& os) {
     // optimization might get confused.
     CHECK(builtin_names.insert(data.function_name_).second);
   }
+  // Off-heap data belongs to optimized JavaScript functions. A function that
+  // was optimized several times has an entry per compilation, and only the
+  // most recent one is logged since the reader expects a single hash per name.
+  base::MutexGuard lock(&data_list_mutex_);
+  std::unordered_set<std::string> function_names;
+  for (auto it = data_list_.rbegin(); it != data_list_.rend(); ++it) {
+    if (!function_names.insert((*it)->function_name_).second) continue;
+    (*it)->Log(isolate, os);
+  }
 }
 
 std::vector<bool> BasicBlockProfiler::GetCoverageBitmap(Isolate* isolate) {
@@ -48,6 +48,13 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
   total_stats_.count_++;
 }
 
+void CompilationStatistics::Reset() {
+  base::MutexGuard guard(&record_mutex_);
+  total_stats_ = TotalStats();
+  phase_kind_map_.clear();
+  phase_map_.clear();
+}
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -53,6 +53,17 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(const BasicStats& stats);
 
+  // Drops everything recorded so far.
+  void Reset();
+
+  // Calls |callback| with the name and the accumulated stats of every phase
+  // recorded so far.
+  template <typename Callback>
+  void ForEachPhase(Callback callback) {
+    base::MutexGuard guard(&record_mutex_);
+    for (const auto& [name, stats] : phase_map_) callback(name, stats);
+  }
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -2146,9 +2146,9 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
       if (v8_flags.regexp_tier_up) {
         // With tier-up enabled, ticks_until_tier_up should actually be >= 0.
         // However FlagScopes in unittests can modify the flag and verification
-        // on Isolate deinitialization will fail.
+        // on Isolate deinitialization will fail. There is no upper bound since
+        // the embedder can change the initial value at any time.
         CHECK_GE(ticks_until_tier_up(), JSRegExp::kUninitializedValue);
-        CHECK_LE(ticks_until_tier_up(), v8_flags.regexp_tier_up_ticks);
       } else {
         CHECK_EQ(ticks_until_tier_up(), JSRegExp::kUninitializedValue);
       }
@@ -38,7 +38,14 @@
 #include <unistd.h>
 
 #include <memory>
-
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
@@ -125,6 +132,74 @@ const int LinuxPerfJitLogger::kFilenameBufferPadding = 16;
 
 static const char kStringTerminator[] = {'\0'};
 
+// Compiling threads only append records to an in-memory buffer, which is
+// handed over to the writer thread whenever it fills up. This keeps the
+// file I/O off the threads that create code.
+class LinuxPerfJitLogger::AsyncWriter final : public base::Thread {
+ public:
+  explicit AsyncWriter(FILE* file)
+      : base::Thread(base::Thread::Options("V8 perf jitdump writer")),
+        file_(file) {
+    buffer_.reserve(kLogBufferSize);
+  }
+
+  // Called with GetFileMutex() held.
+  void Write(const char* bytes, int size) {
+    buffer_.insert(buffer_.end(), bytes, bytes + size);
+    if (buffer_.size() >= static_cast<size_t>(kLogBufferSize)) Flush();
+  }
+
+  // Writes the pending records and waits for the thread to finish. Called
+  // with GetFileMutex() held.
+  void Stop() {
+    Flush();
+    {
+      base::MutexGuard guard(&mutex_);
+      stopped_ = true;
+      cv_.NotifyOne();
+    }
+    Join();
+  }
+
+  void Run() override {
+    std::vector<std::vector<char>> batch;
+    while (true) {
+      {
+        base::MutexGuard guard(&mutex_);
+        while (pending_.empty() && !stopped_) cv_.Wait(&mutex_);
+        if (pending_.empty()) return;
+        batch.swap(pending_);
+      }
+      for (const std::vector<char>& chunk : batch) {
+        size_t rv = fwrite(chunk.data(), 1, chunk.size(), file_);
+        DCHECK_EQ(chunk.size(), rv);
+        USE(rv);
+      }
+      batch.clear();
+    }
+  }
+
+ private:
+  void Flush() {
+    if (buffer_.empty()) return;
+    std::vector<char> chunk;
+    chunk.reserve(kLogBufferSize);
+    chunk.swap(buffer_);
+    base::MutexGuard guard(&mutex_);
+    pending_.push_back(std::move(chunk));
+    cv_.NotifyOne();
+  }
+
+  FILE* const file_;
+  // Only accessed by the logging threads.
+  std::vector<char> buffer_;
+  // Protects {pending_} and {stopped_}.
+  base::Mutex mutex_;
+  base::ConditionVariable cv_;
+  std::vector<std::vector<char>> pending_;
+  bool stopped_ = false;
+};
+
 // The following static variables are protected by
 // GetFileMutex().
 int LinuxPerfJitLogger::process_id_ = 0;
@@ -132,6 +207,7 @@ uint64_t LinuxPerfJitLogger::reference_count_ = 0;
 void* LinuxPerfJitLogger::marker_address_ = nullptr;
 uint64_t LinuxPerfJitLogger::code_index_ = 0;
 FILE* LinuxPerfJitLogger::perf_output_handle_ = nullptr;
+LinuxPerfJitLogger::AsyncWriter* LinuxPerfJitLogger::async_writer_ = nullptr;
 
 void LinuxPerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -160,10 +236,23 @@ void LinuxPerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+
+  if (v8_flags.perf_prof_async_writes) {
+    async_writer_ = new AsyncWriter(perf_output_handle_);
+    if (!async_writer_->Start()) {
+      delete async_writer_;
+      async_writer_ = nullptr;
+    }
+  }
 }
 
 void LinuxPerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
+  if (async_writer_ != nullptr) {
+    async_writer_->Stop();
+    delete async_writer_;
+    async_writer_ = nullptr;
+  }
   base::Fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
 }
@@ -524,8 +613,11 @@ void LinuxPerfJitLogger::LogWriteUnwindingInfo(Tagged<Code> code) {
     LogWriteBytes(reinterpret_cast<const char*>(code->unwinding_info_start()),
                   code->unwinding_info_size());
   } else {
-    OFStream perf_output_stream(perf_output_handle_);
+    std::ostringstream perf_output_stream;
     EhFrameWriter::WriteEmptyEhFrame(perf_output_stream);
+    std::string empty_eh_frame = perf_output_stream.str();
+    LogWriteBytes(empty_eh_frame.data(),
+                  static_cast<int>(empty_eh_frame.size()));
   }
 
   char padding_bytes[] = "\0\0\0\0\0\0\0\0";
@@ -534,6 +626,10 @@ void LinuxPerfJitLogger::LogWriteUnwindingInfo(Tagged<Code> code) {
 }
 
 void LinuxPerfJitLogger::LogWriteBytes(const char* bytes, int size) {
+  if (async_writer_ != nullptr) {
+    async_writer_->Write(bytes, size);
+    return;
+  }
   size_t rv = fwrite(bytes, 1, size, perf_output_handle_);
   DCHECK(static_cast<size_t>(size) == rv);
   USE(rv);
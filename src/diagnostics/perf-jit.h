@@ -76,6 +76,10 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   // minimize the associated overhead.
   static const int kLogBufferSize = 2 * MB;
 
+  // Collects the records in memory and writes them to the file from a
+  // background thread, see --perf-prof-async-writes.
+  class AsyncWriter;
+
   void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
                              const char* name, int name_length);
 
@@ -133,6 +137,7 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   // Per-process singleton file. We assume that there is one main isolate;
   // to determine when it goes away, we keep reference count.
   static FILE* perf_output_handle_;
+  static AsyncWriter* async_writer_;
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
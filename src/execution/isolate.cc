@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -44,6 +45,7 @@
 #include "src/date/date.h"
 #include "src/debug/debug-frames.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deopt-hotspots.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/diagnostics/basic-block-profiler.h"
@@ -57,6 +59,7 @@
 #include "src/execution/protectors-inl.h"
 #include "src/execution/simulator.h"
 #include "src/execution/tiering-manager.h"
+#include "src/execution/tiering-profile.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles-inl.h"
@@ -67,6 +70,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/ic/ic-stats.h"
 #include "src/ic/stub-cache.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/setup-isolate.h"
@@ -106,6 +110,7 @@
 #include "src/objects/waiter-queue-node.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
+#include "src/regexp/experimental/experimental-interpreter.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/roots/roots.h"
 #include "src/roots/static-roots.h"
@@ -1292,6 +1297,9 @@ template <typename Visitor>
 void VisitStack(Isolate* isolate, Visitor* visitor,
                 StackTrace::StackTraceOptions options = StackTrace::kDetailed) {
   DisallowJavascriptExecution no_js(isolate);
+  // Reused across frames so that walking a deep stack does not allocate a
+  // new vector per frame.
+  std::vector<FrameSummary> summaries;
   for (StackFrameIterator it(isolate); !it.done(); it.Advance()) {
     StackFrame* frame = it.frame();
     switch (frame->type()) {
@@ -1315,7 +1323,7 @@ void VisitStack(Isolate* isolate, Visitor* visitor,
       {
         // A standard frame may include many summarized frames (due to
         // inlining).
-        std::vector<FrameSummary> summaries;
+        summaries.clear();
         CommonFrame::cast(frame)->Summarize(&summaries);
         for (auto rit = summaries.rbegin(); rit != summaries.rend(); ++rit) {
           FrameSummary& summary = *rit;
@@ -3942,13 +3950,17 @@ IsolateGroup* AcquireGroupForNewIsolate() {
 }  // namespace
 
 // static
-Isolate* Isolate::New() { return Allocate(); }
+Isolate* Isolate::New() { return Allocate(AcquireGroupForNewIsolate()); }
 
 // static
-Isolate* Isolate::Allocate() {
+Isolate* Isolate::New(IsolateGroup* isolate_group) {
+  return Allocate(isolate_group->Acquire());
+}
+
+// static
+Isolate* Isolate::Allocate(IsolateGroup* group) {
   // v8::V8::Initialize() must be called before creating any isolates.
   DCHECK_NOT_NULL(V8::GetCurrentPlatform());
-  IsolateGroup* group = AcquireGroupForNewIsolate();
   // Allocate Isolate itself on C++ heap, ensuring page alignment.
   void* isolate_ptr = base::AlignedAlloc(sizeof(Isolate), kMinimumOSPageSize);
   // IsolateAllocator manages the virtual memory resources for the Isolate.
@@ -4227,6 +4239,9 @@ void Isolate::UpdateLogObjectRelocation() {
 void Isolate::Deinit() {
   TRACE_ISOLATE(deinit);
 
+  // Write the tiering profile while the heap is still intact.
+  if (initialized_) TieringProfile::MaybeWriteToFile(this);
+
 #if defined(V8_USE_PERFETTO)
   PerfettoLogger::UnregisterIsolate(this);
 #endif  // defined(V8_USE_PERFETTO)
@@ -4502,6 +4517,9 @@ Isolate::~Isolate() {
   delete regexp_stack_;
   regexp_stack_ = nullptr;
 
+  delete experimental_regexp_dfa_cache_;
+  experimental_regexp_dfa_cache_ = nullptr;
+
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
@@ -4515,6 +4533,9 @@ Isolate::~Isolate() {
   delete materialized_object_store_;
   materialized_object_store_ = nullptr;
 
+  delete deopt_hotspots_;
+  deopt_hotspots_ = nullptr;
+
   delete v8_file_logger_;
   v8_file_logger_ = nullptr;
 
@@ -5321,7 +5342,9 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   store_stub_cache_ = new StubCache(this);
   define_own_stub_cache_ = new StubCache(this);
   materialized_object_store_ = new MaterializedObjectStore(this);
+  deopt_hotspots_ = new DeoptHotspots();
   regexp_stack_ = new RegExpStack();
+  experimental_regexp_dfa_cache_ = new ExperimentalRegExpDfaCache();
   date_cache_ = new DateCache();
   heap_profiler_ = new HeapProfiler(heap());
   interpreter_ = new interpreter::Interpreter(this);
@@ -5856,21 +5879,33 @@ void Isolate::DumpAndResetStats() {
 #endif  // V8_RUNTIME_CALL_STATS
 }
 
+bool Isolate::WriteAndResetBuiltinsProfileData(const char* file_name,
+                                               const char* mode) {
+  if (!BasicBlockProfiler::Get()->HasData(this)) return false;
+  FILE* f = std::fopen(file_name, mode);
+  if (f == nullptr) return false;
+  {
+    OFStream pgo_stream(f);
+    BasicBlockProfiler::Get()->Log(this, pgo_stream);
+  }
+  std::fclose(f);
+  BasicBlockProfiler::Get()->ResetCounts(this);
+  return true;
+}
+
 void Isolate::DumpAndResetBuiltinsProfileData() {
   if (BasicBlockProfiler::Get()->HasData(this)) {
     if (v8_flags.turbo_profiling_output) {
-      FILE* f = std::fopen(v8_flags.turbo_profiling_output, "w");
-      if (f == nullptr) {
+      if (!WriteAndResetBuiltinsProfileData(v8_flags.turbo_profiling_output,
+                                            "w")) {
         FATAL("Unable to open file \"%s\" for writing.\n",
               v8_flags.turbo_profiling_output.value());
       }
-      OFStream pgo_stream(f);
-      BasicBlockProfiler::Get()->Log(this, pgo_stream);
     } else {
       StdoutStream out;
       BasicBlockProfiler::Get()->Print(this, out);
+      BasicBlockProfiler::Get()->ResetCounts(this);
     }
-    BasicBlockProfiler::Get()->ResetCounts(this);
   } else {
     // Only log builtins PGO data if v8 was built with
     // v8_enable_builtins_profiling=true
@@ -5929,13 +5964,26 @@ bool Isolate::use_optimizer() {
 void Isolate::IncreaseTotalRegexpCodeGenerated(DirectHandle<HeapObject> code) {
   PtrComprCageBase cage_base(this);
   DCHECK(IsCode(*code, cage_base) || IsTrustedByteArray(*code, cage_base));
-  total_regexp_code_generated_ += code->Size(cage_base);
+  int size = code->Size(cage_base);
+  total_regexp_code_generated_ += size;
+  if (IsCode(*code, cage_base)) {
+    counters()->regexp_native_code_size()->Increment(size);
+  } else {
+    counters()->regexp_bytecode_size()->Increment(size);
+  }
 }
 
 bool Isolate::NeedsDetailedOptimizedCodeLineInfo() const {
   return NeedsSourcePositions() || detailed_source_positions_for_profiling();
 }
 
+ICTransitionSampler* Isolate::ic_transition_sampler() {
+  if (!ic_transition_sampler_) {
+    ic_transition_sampler_ = std::make_unique<ICTransitionSampler>();
+  }
+  return ic_transition_sampler_.get();
+}
+
 bool Isolate::IsLoggingCodeCreation() const {
   return v8_file_logger()->is_listening_to_code_events() || is_profiling() ||
          v8_flags.log_function_events ||
@@ -7021,21 +7069,35 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              Handle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
+  ICUObjectCacheEntry* entries =
       icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  for (int i = 0; i < kICUObjectCacheEntriesPerType; i++) {
+    if (!entries[i].obj) break;
+    if (StringEqualsLocales(this, entries[i].locales, locales)) {
+      // Move the entry to the front so that it is evicted last.
+      std::rotate(entries, entries + i, entries + i + 1);
+      return entries[0].obj.get();
+    }
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       DirectHandle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  ICUObjectCacheEntry* entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  // Evict the least recently used entry.
+  std::move_backward(entries, entries + kICUObjectCacheEntriesPerType - 1,
+                     entries + kICUObjectCacheEntriesPerType);
+  entries[0] = {GetStringFromLocales(this, locales), std::move(obj)};
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+  for (ICUObjectCacheEntry& entry :
+       icu_object_cache_[static_cast<int>(cache_type)]) {
+    entry = ICUObjectCacheEntry{};
+  }
 }
 
 void Isolate::clear_cached_icu_objects() {
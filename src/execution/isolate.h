@@ -122,14 +122,17 @@ class CompilationStatistics;
 class Counters;
 class Debug;
 class Deoptimizer;
+class DeoptHotspots;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
+class ExperimentalRegExpDfaCache;
 class GlobalHandles;
 class GlobalSafepoint;
 class HandleScopeImplementer;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
+class ICTransitionSampler;
 class InnerPointerToCodeCache;
 class LazyCompileDispatcher;
 class LocalIsolate;
@@ -536,6 +539,7 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(const v8::StartupData*, snapshot_blob, nullptr)                           \
   V(int, code_and_metadata_size, 0)                                           \
   V(int, bytecode_and_metadata_size, 0)                                       \
+  V(int, deoptimization_data_size, 0)                                         \
   V(int, external_script_source_size, 0)                                      \
   /* Number of CPU profilers running on the isolate. */                       \
   V(size_t, num_cpu_profilers, 0)                                             \
@@ -639,6 +643,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // Creates Isolate object. Must be used instead of constructing Isolate with
   // new operator.
   static Isolate* New();
+  // Same as above, but in the given group, on which it takes a reference.
+  static Isolate* New(IsolateGroup* isolate_group);
 
   // Deletes Isolate object. Must be used instead of delete operator.
   // Destroys the non-default isolates.
@@ -1289,6 +1295,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StubCache* load_stub_cache() const { return load_stub_cache_; }
   StubCache* store_stub_cache() const { return store_stub_cache_; }
   StubCache* define_own_stub_cache() const { return define_own_stub_cache_; }
+  // Created on first use, see --ic-transition-sampling-interval.
+  ICTransitionSampler* ic_transition_sampler();
   Deoptimizer* GetAndClearCurrentDeoptimizer() {
     Deoptimizer* result = current_deoptimizer_;
     CHECK_NOT_NULL(result);
@@ -1349,6 +1357,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return materialized_object_store_;
   }
 
+  DeoptHotspots* deopt_hotspots() const { return deopt_hotspots_; }
+
   DescriptorLookupCache* descriptor_lookup_cache() const {
     return descriptor_lookup_cache_;
   }
@@ -1407,11 +1417,20 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   RegExpStack* regexp_stack() const { return regexp_stack_; }
 
+  ExperimentalRegExpDfaCache* experimental_regexp_dfa_cache() const {
+    return experimental_regexp_dfa_cache_;
+  }
+
   size_t total_regexp_code_generated() const {
     return total_regexp_code_generated_;
   }
   void IncreaseTotalRegexpCodeGenerated(DirectHandle<HeapObject> code);
 
+  // Number of interpreted executions before a regexp created in this isolate
+  // is tiered up to native code. See also --regexp-tier-up-ticks.
+  int regexp_tier_up_ticks() const { return regexp_tier_up_ticks_; }
+  void set_regexp_tier_up_ticks(int ticks) { regexp_tier_up_ticks_ = ticks; }
+
   std::vector<int>* regexp_indices() { return &regexp_indices_; }
 
   Debug* debug() const { return debug_; }
@@ -1682,6 +1701,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   void DumpAndResetStats();
   void DumpAndResetBuiltinsProfileData();
+  // Writes the builtins profile to |file_name|, opened with |mode|, and resets
+  // it. Returns false if there's no profile data or the file can't be opened.
+  bool WriteAndResetBuiltinsProfileData(const char* file_name,
+                                        const char* mode);
 
   void* stress_deopt_count_address() { return &stress_deopt_count_; }
 
@@ -2274,7 +2297,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   explicit Isolate(IsolateGroup* isolate_group);
   ~Isolate();
 
-  static Isolate* Allocate();
+  static Isolate* Allocate(IsolateGroup* isolate_group);
 
   bool Init(SnapshotData* startup_snapshot_data,
             SnapshotData* read_only_snapshot_data,
@@ -2422,9 +2445,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StubCache* load_stub_cache_ = nullptr;
   StubCache* store_stub_cache_ = nullptr;
   StubCache* define_own_stub_cache_ = nullptr;
+  std::unique_ptr<ICTransitionSampler> ic_transition_sampler_;
   Deoptimizer* current_deoptimizer_ = nullptr;
   bool deoptimizer_lazy_throw_ = false;
   MaterializedObjectStore* materialized_object_store_ = nullptr;
+  DeoptHotspots* deopt_hotspots_ = nullptr;
   bool capture_stack_trace_for_uncaught_exceptions_ = false;
   int stack_trace_for_uncaught_exceptions_frame_limit_ = 0;
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
@@ -2452,6 +2477,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       regexp_macro_assembler_canonicalize_;
 #endif  // !V8_INTL_SUPPORT
   RegExpStack* regexp_stack_ = nullptr;
+  ExperimentalRegExpDfaCache* experimental_regexp_dfa_cache_ = nullptr;
   std::vector<int> regexp_indices_;
   DateCache* date_cache_ = nullptr;
   base::RandomNumberGenerator* random_number_generator_ = nullptr;
@@ -2485,8 +2511,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores the most recently accessed {locales,obj} pairs for each
+  // cache type, most recently used first, so that code alternating between a
+  // few locales doesn't construct a new ICU object on every call.
+  static constexpr int kICUObjectCacheEntriesPerType = 4;
   struct ICUObjectCacheEntry {
     std::string locales;
     std::shared_ptr<icu::UMemory> obj;
@@ -2496,7 +2524,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         : locales(locales), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount]
+                                       [kICUObjectCacheEntriesPerType];
 #endif  // V8_INTL_SUPPORT
 
   // Whether the isolate has been created for snapshotting.
@@ -2684,6 +2713,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   ManagedPtrDestructor* managed_ptr_destructors_head_ = nullptr;
 
   size_t total_regexp_code_generated_ = 0;
+  int regexp_tier_up_ticks_ = v8_flags.regexp_tier_up_ticks;
 
   size_t elements_deletion_counter_ = 0;
 
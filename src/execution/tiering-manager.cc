@@ -232,6 +232,14 @@ int TieringManager::InterruptBudgetFor(
       function->shared()->GetBytecodeArray(isolate)->length();
 
   if (FirstTimeTierUpToSparkplug(isolate, function)) {
+    // Feedback vectors are sized for all IC slots up front, so under memory
+    // pressure only allocate them for functions which are invoked more often.
+    if (!function->has_feedback_vector() &&
+        v8_flags.invocation_count_for_feedback_allocation_for_size > 0 &&
+        isolate->heap()->ShouldOptimizeForMemoryUsage()) {
+      return bytecode_length *
+             v8_flags.invocation_count_for_feedback_allocation_for_size;
+    }
     return bytecode_length * v8_flags.invocation_count_for_feedback_allocation;
   }
 
@@ -0,0 +1,245 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "src/base/lazy-instance.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/heap-object-iterator.h"
+#include "src/objects/code-kind.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/utils/ostreams.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Returns the name of the script of |shared| if it has one, or nullptr.
+std::unique_ptr<char[]> ScriptNameFor(Tagged<SharedFunctionInfo> shared) {
+  Tagged<HeapObject> script = shared->script();
+  if (!IsScript(script)) return nullptr;
+  Tagged<Object> name = Cast<Script>(script)->GetNameOrSourceURL();
+  if (!IsString(name) || Cast<String>(name)->length() == 0) return nullptr;
+  return Cast<String>(name)->ToCString();
+}
+
+// The highest tier the function has code for. The maybe_has_*_code bits may
+// lag behind, which is fine for a profile.
+CodeKind HighestTierFor(Tagged<FeedbackVector> vector) {
+  if (vector->maybe_has_turbofan_code() ||
+      vector->maybe_has_turbofan_osr_code()) {
+    return CodeKind::TURBOFAN;
+  }
+  if (vector->maybe_has_maglev_code() || vector->maybe_has_maglev_osr_code()) {
+    return CodeKind::MAGLEV;
+  }
+  if (vector->shared_function_info()->HasBaselineCode()) {
+    return CodeKind::BASELINE;
+  }
+  return CodeKind::INTERPRETED_FUNCTION;
+}
+
+bool ReadInt(std::istringstream& line_stream, int* value) {
+  std::string token;
+  if (!std::getline(line_stream, token, ',')) return false;
+  char* end = nullptr;
+  errno = 0;
+  long result = strtol(token.c_str(), &end, 10);
+  if (errno != 0 || end == token.c_str() || *end != '\0') return false;
+  *value = static_cast<int>(result);
+  return true;
+}
+
+bool ReadCodeKind(std::istringstream& line_stream, CodeKind* code_kind) {
+  std::string token;
+  if (!std::getline(line_stream, token, ',')) return false;
+  for (CodeKind kind : {CodeKind::INTERPRETED_FUNCTION, CodeKind::BASELINE,
+                        CodeKind::MAGLEV, CodeKind::TURBOFAN}) {
+    if (token == CodeKindToString(kind)) {
+      *code_kind = kind;
+      return true;
+    }
+  }
+  return false;
+}
+
+const TieringProfile::Records& GetTieringProfile() {
+  static base::LeakyObject<TieringProfile::Records> profile(
+      TieringProfile::ReadFromFile(v8_flags.tiering_profile_input));
+  return *profile.get();
+}
+
+}  // namespace
+
+// static
+std::string TieringProfile::KeyFor(int start, int end,
+                                   const char* script_name) {
+  std::ostringstream key;
+  key << start << ',' << end << ',' << script_name;
+  return key.str();
+}
+
+// static
+void TieringProfile::Write(Isolate* isolate, std::ostream& os) {
+  HeapObjectIterator iterator(isolate->heap());
+  for (Tagged<HeapObject> obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    if (!IsFeedbackVector(obj)) continue;
+    Tagged<FeedbackVector> vector = Cast<FeedbackVector>(obj);
+    Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+    std::unique_ptr<char[]> script_name = ScriptNameFor(shared);
+    if (!script_name) continue;
+
+    int ic_slots = 0;
+    int polymorphic_ics = 0;
+    int megamorphic_ics = 0;
+    FeedbackMetadataIterator iter(vector->metadata());
+    while (iter.HasNext()) {
+      FeedbackSlot slot = iter.Next();
+      ic_slots++;
+      switch (FeedbackNexus(isolate, vector, slot).ic_state()) {
+        case InlineCacheState::POLYMORPHIC:
+          polymorphic_ics++;
+          break;
+        case InlineCacheState::MEGADOM:
+        case InlineCacheState::MEGAMORPHIC:
+        case InlineCacheState::GENERIC:
+          megamorphic_ics++;
+          break;
+        default:
+          break;
+      }
+    }
+
+    os << kFunctionMarker << ',' << shared->StartPosition() << ','
+       << shared->EndPosition() << ','
+       << vector->invocation_count(kRelaxedLoad) << ','
+       << CodeKindToString(HighestTierFor(vector)) << ','
+       << static_cast<int>(shared->cached_tiering_decision()) << ','
+       << ic_slots << ',' << polymorphic_ics << ',' << megamorphic_ics << ','
+       << script_name.get() << '\n';
+  }
+}
+
+// static
+void TieringProfile::MaybeWriteToFile(Isolate* isolate) {
+  if (!v8_flags.tiering_profile_output) return;
+  FILE* f = std::fopen(v8_flags.tiering_profile_output, "a");
+  if (f == nullptr) {
+    FATAL("Unable to open file \"%s\" for writing.\n",
+          v8_flags.tiering_profile_output.value());
+  }
+  {
+    OFStream profile_stream(f);
+    Write(isolate, profile_stream);
+  }
+  std::fclose(f);
+}
+
+// static
+TieringProfile::Records TieringProfile::Read(std::istream& is) {
+  Records profile;
+  for (std::string line; std::getline(is, line);) {
+    std::istringstream line_stream(line);
+    std::string token;
+    if (!std::getline(line_stream, token, ',') || token != kFunctionMarker) {
+      continue;
+    }
+    int start, end, invocation_count, cached_tiering_decision, ic_slots,
+        polymorphic_ics, megamorphic_ics;
+    CodeKind code_kind;
+    std::string script_name;
+    if (!ReadInt(line_stream, &start) || !ReadInt(line_stream, &end) ||
+        !ReadInt(line_stream, &invocation_count) ||
+        !ReadCodeKind(line_stream, &code_kind) ||
+        !ReadInt(line_stream, &cached_tiering_decision) ||
+        !ReadInt(line_stream, &ic_slots) ||
+        !ReadInt(line_stream, &polymorphic_ics) ||
+        !ReadInt(line_stream, &megamorphic_ics) ||
+        !std::getline(line_stream, script_name) ||
+        cached_tiering_decision < 0 ||
+        cached_tiering_decision >
+            static_cast<int>(CachedTieringDecision::kNormal)) {
+      continue;
+    }
+    // Several isolates may have written records for the same function; keep
+    // the one that got furthest.
+    FunctionRecord record{
+        code_kind, static_cast<CachedTieringDecision>(cached_tiering_decision)};
+    auto result =
+        profile.emplace(KeyFor(start, end, script_name.c_str()), record);
+    if (!result.second && result.first->second.code_kind < code_kind) {
+      result.first->second = record;
+    }
+  }
+  return profile;
+}
+
+// static
+TieringProfile::Records TieringProfile::ReadFromFile(const char* filename) {
+  std::ifstream file(filename);
+  CHECK_WITH_MSG(file.good(), "Can't read tiering profile");
+  return Read(file);
+}
+
+// static
+void TieringProfile::Apply(const Records& profile,
+                           Tagged<SharedFunctionInfo> shared) {
+  // Don't override what this process has already learned.
+  if (shared->cached_tiering_decision() >
+      CachedTieringDecision::kEarlySparkplug) {
+    return;
+  }
+  if (profile.empty()) return;
+  std::unique_ptr<char[]> script_name = ScriptNameFor(shared);
+  if (!script_name) return;
+  auto it = profile.find(KeyFor(shared->StartPosition(), shared->EndPosition(),
+                                script_name.get()));
+  if (it == profile.end()) return;
+
+  const FunctionRecord& record = it->second;
+  CachedTieringDecision decision;
+  if (record.cached_tiering_decision == CachedTieringDecision::kDelayMaglev) {
+    // The function deoptimized early last time.
+    decision = CachedTieringDecision::kDelayMaglev;
+  } else if (record.cached_tiering_decision ==
+             CachedTieringDecision::kNormal) {
+    // Its feedback kept changing, so tier it up as usual.
+    return;
+  } else if (record.code_kind == CodeKind::TURBOFAN) {
+    decision = CachedTieringDecision::kEarlyTurbofan;
+  } else if (record.code_kind == CodeKind::MAGLEV) {
+    decision = CachedTieringDecision::kEarlyMaglev;
+  } else {
+    return;
+  }
+  if (v8_flags.trace_opt_verbose) {
+    PrintF("[seeding tiering decision of %s from profile: %d]\n",
+           shared->DebugNameCStr().get(), static_cast<int>(decision));
+  }
+  shared->set_cached_tiering_decision(decision);
+}
+
+// static
+void TieringProfile::MaybeApply(Isolate* isolate,
+                                Tagged<SharedFunctionInfo> shared) {
+  DCHECK_NOT_NULL(v8_flags.tiering_profile_input.value());
+  if (!v8_flags.profile_guided_optimization) return;
+  Apply(GetTieringProfile(), shared);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,80 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_TIERING_PROFILE_H_
+#define V8_EXECUTION_TIERING_PROFILE_H_
+
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+
+#include "src/common/globals.h"
+#include "src/objects/code-kind.h"
+#include "src/utils/allocation.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class SharedFunctionInfo;
+
+// A tiering profile records, for every function that has a feedback vector,
+// how often it was invoked, the highest tier it reached and a summary of its
+// feedback. A later process running the same scripts can read the profile to
+// seed the CachedTieringDecision of those functions, so that the ones which
+// were known to be hot and stable get optimized after a few invocations
+// instead of going through the full warm-up again.
+//
+// Functions are identified by the name (or source URL) of their script and
+// their source range, so the profile is only meaningful for the same sources.
+// The format follows the one read by ProfileDataFromFile: one comma-separated
+// record per line, starting with kFunctionMarker.
+class TieringProfile : public AllStatic {
+ public:
+  // Any line in the profile beginning with this string is a function record:
+  //   literal kFunctionMarker , start , end , invocation_count , code_kind ,
+  //   cached_tiering_decision , ic_slots , polymorphic_ics , megamorphic_ics ,
+  //   script_name
+  static constexpr char kFunctionMarker[] = "tiering_function";
+
+  // The part of a function record that is used when applying a profile.
+  struct FunctionRecord {
+    CodeKind code_kind;
+    CachedTieringDecision cached_tiering_decision;
+  };
+
+  // Function records by KeyFor() of the function.
+  using Records = std::unordered_map<std::string, FunctionRecord>;
+
+  // Returns the key of the function at [start, end) of |script_name|.
+  V8_EXPORT_PRIVATE static std::string KeyFor(int start, int end,
+                                              const char* script_name);
+
+  // Writes a record for every function of |isolate| that has a feedback
+  // vector and belongs to a named script.
+  V8_EXPORT_PRIVATE static void Write(Isolate* isolate, std::ostream& os);
+
+  // Writes the profile to the file given by --tiering-profile-output.
+  static void MaybeWriteToFile(Isolate* isolate);
+
+  // Reads the function records from |is|. Malformed records are skipped
+  // rather than treated as fatal, since the profile only affects heuristics.
+  V8_EXPORT_PRIVATE static Records Read(std::istream& is);
+
+  // Like Read(), but from |filename|, which must exist.
+  V8_EXPORT_PRIVATE static Records ReadFromFile(const char* filename);
+
+  // Seeds the cached tiering decision of |shared| from |profile|, if it has a
+  // record for the function.
+  V8_EXPORT_PRIVATE static void Apply(const Records& profile,
+                                      Tagged<SharedFunctionInfo> shared);
+
+  // Like Apply(), with the profile given by --tiering-profile-input.
+  static void MaybeApply(Isolate* isolate, Tagged<SharedFunctionInfo> shared);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_TIERING_PROFILE_H_
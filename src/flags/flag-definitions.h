@@ -576,6 +576,15 @@ DEFINE_UINT(
     "max number of threads that concurrent Maglev can use (0 for unbounded)")
 DEFINE_BOOL(concurrent_maglev_high_priority_threads, false,
             "use high priority compiler threads for concurrent Maglev")
+DEFINE_BOOL(concurrent_maglev_prioritize_hot_functions, true,
+            "compile the functions with the highest invocation counts first "
+            "in concurrent Maglev")
+DEFINE_INT(concurrent_maglev_small_function_size, 128,
+           "max bytecode size of functions whose code concurrent Maglev may "
+           "install together with that of others")
+DEFINE_INT(concurrent_maglev_install_batch_size, 4,
+           "max number of small functions compiled by concurrent Maglev before "
+           "requesting to install their code")
 
 DEFINE_INT(
     max_maglev_inline_depth, 1,
@@ -794,6 +803,11 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(code_cache_pretenuring_feedback, false,
+            "store pretenuring decisions of literal allocation sites in the "
+            "code cache and apply them to newly created sites")
+DEFINE_NEG_NEG_IMPLICATION(allocation_site_pretenuring,
+                           code_cache_pretenuring_feedback)
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation "
@@ -848,10 +862,17 @@ DEFINE_BOOL_READONLY(enable_sealed_frozen_elements_kind, true,
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
 DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
+DEFINE_BOOL(string_search_ropes, false,
+            "let String.prototype.indexOf search long cons strings segment by "
+            "segment instead of flattening them")
 
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(invocation_count_for_feedback_allocation, 8,
            "invocation count required for allocating feedback vectors")
+DEFINE_INT(invocation_count_for_feedback_allocation_for_size, 0,
+           "invocation count required for allocating feedback vectors when "
+           "the heap optimizes for memory usage (0 to use "
+           "--invocation-count-for-feedback-allocation)")
 
 // Tiering: Maglev.
 #if defined(ANDROID)
@@ -998,6 +1019,10 @@ DEFINE_UINT(
     "max number of threads that concurrent Sparkplug can use (0 for unbounded)")
 DEFINE_BOOL(concurrent_sparkplug_high_priority_threads, false,
             "use high priority compiler threads for concurrent Sparkplug")
+DEFINE_BOOL(concurrent_sparkplug_off_thread_install, false,
+            "install concurrent Sparkplug code from the background thread")
+DEFINE_IMPLICATION(concurrent_sparkplug_off_thread_install,
+                   concurrent_sparkplug)
 #else
 DEFINE_BOOL(baseline_batch_compilation, false, "batch compile Sparkplug code")
 DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
@@ -1236,6 +1261,9 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
+DEFINE_FLOAT(min_polymorphic_inlining_target_share, 0.1,
+             "minimum share of the invocations of all targets of a polymorphic "
+             "call site that a target needs to be inlined")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
 DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size, 999999)
@@ -1294,6 +1322,13 @@ DEFINE_STRING(
     turbo_profiling_output, nullptr,
     "emit data about basic block usage in builtins to this file "
     "(requires that V8 was built with v8_enable_builtins_profiling=true)")
+DEFINE_BOOL(turbo_profiling_js, false,
+            "enable basic block profiling of optimized JavaScript functions "
+            "in TurboFan; the counters are written to --turbo-profiling-output")
+DEFINE_IMPLICATION(turbo_profiling_js, turbo_profiling)
+DEFINE_BOOL(turbo_profile_guided_js, false,
+            "apply the branch hints in --turbo-profiling-input to optimized "
+            "JavaScript functions")
 DEFINE_BOOL(reorder_builtins, false,
             "enable builtin reordering when run mksnapshot.")
 
@@ -1309,6 +1344,10 @@ DEFINE_STRING(
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
+DEFINE_INT(turbo_fast_register_allocation_threshold, 0,
+           "use a cheaper register allocation mode, which skips live range "
+           "bundling and gap move optimization, for instruction sequences "
+           "with at least this many instructions (0 means never)")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
@@ -1412,6 +1451,10 @@ DEFINE_EXPERIMENTAL_FEATURE(turboshaft_from_maglev,
                             "build the Turboshaft graph from Maglev")
 // inline_api_calls are not supported by the Turboshaft->Maglev translation.
 DEFINE_NEG_IMPLICATION(turboshaft_from_maglev, maglev_inline_api_calls)
+DEFINE_BOOL(turboshaft_from_maglev_on_tier_up, false,
+            "build the Turboshaft graph from Maglev for functions that tier up "
+            "from Maglev code, falling back to the Turbofan frontend if that "
+            "fails")
 
 DEFINE_BOOL(turboshaft_csa, true, "run the CSA pipeline with turboshaft")
 DEFINE_IMPLICATION(turboshaft_csa, turboshaft_load_elimination)
@@ -1478,6 +1521,12 @@ DEFINE_INT(invocation_count_for_maglev_with_delay, 600,
            "invocation count for maglev for functions which according to "
            "profile_guided_optimization are likely to deoptimize before "
            "reaching this invocation count")
+DEFINE_STRING(tiering_profile_output, nullptr,
+              "append the invocation counts, tiers and feedback summaries of "
+              "all functions to this file when an isolate is torn down")
+DEFINE_STRING(tiering_profile_input, nullptr,
+              "seed the tiering decisions of functions from a profile written "
+              "with --tiering-profile-output")
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, false,
@@ -1534,6 +1583,10 @@ DEFINE_BOOL(wasm_async_compilation, true,
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
 DEFINE_BOOL(wasm_test_streaming, false,
             "use streaming compilation instead of async compilation for tests")
+DEFINE_UINT(wasm_streaming_commit_batch_kb, 0,
+            "during streaming compilation, start compiling pending functions "
+            "once their bodies add up to this many KiB, instead of waiting for "
+            "the end of the received chunk (0 to disable)")
 DEFINE_BOOL(wasm_native_module_cache_enabled, true,
             "enable the native module cache")
 DEFINE_BOOL(turboshaft_wasm_wrappers, false,
@@ -1596,6 +1649,9 @@ DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_loop_invariant_registers, false,
+            "keep locals which are not assigned in a loop in their registers "
+            "when entering the loop in Liftoff, instead of spilling them")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1759,6 +1815,10 @@ DEFINE_EXPERIMENTAL_FEATURE(
     wasm_lazy_validation,
     "enable lazy validation for lazily compiled wasm functions")
 DEFINE_WEAK_IMPLICATION(wasm_lazy_validation, wasm_lazy_compilation)
+DEFINE_BOOL(wasm_lazy_validation_in_background, false,
+            "with --wasm-lazy-validation, validate lazily compiled functions "
+            "on background threads after compilation, so that their first "
+            "call does not block on validation")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
@@ -1910,6 +1970,9 @@ DEFINE_BOOL(huge_max_old_generation_size, true,
             "Increase max size of the old space to 4 GB for x64 systems with"
             "the physical memory bigger than 16 GB")
 DEFINE_SIZE_T(initial_old_space_size, 0, "initial old space size (in Mbytes)")
+DEFINE_INT(heap_numa_node, -1,
+           "preferred NUMA node for the memory backing heap pages (-1 for no "
+           "preference)")
 DEFINE_BOOL(separate_gc_phases, false,
             "young and full garbage collection phases are not overlapping")
 DEFINE_BOOL(gc_global, false, "always perform global GCs")
@@ -1945,6 +2008,9 @@ DEFINE_BOOL(trace_gc_freelists_verbose, false,
             "prints details of freelists of each page before and after "
             "each major garbage collection")
 DEFINE_IMPLICATION(trace_gc_freelists_verbose, trace_gc_freelists)
+DEFINE_UINT(trace_old_to_new_remembered_set_interval, 0,
+            "print the size of the OLD_TO_NEW remembered set and its densest "
+            "pages before every n-th young generation gc (0 means never)")
 DEFINE_BOOL(trace_gc_heap_layout, false,
             "print layout of pages in heap before and after gc")
 DEFINE_BOOL(trace_gc_heap_layout_ignore_minor_gc, true,
@@ -2024,6 +2090,10 @@ DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(parallel_weak_ref_clearing, true,
             "use parallel threads to clear weak refs in the atomic pause.")
+DEFINE_INT(finalization_registry_cleanup_batch_size, 1024,
+           "maximum number of FinalizationRegistry cleanup callbacks run by "
+           "one cleanup task before yielding to other tasks (0 means no "
+           "limit)")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -2034,6 +2104,9 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_BOOL(track_gc_instance_type_stats, false,
+            "count live objects and their size per instance type while "
+            "marking in full GCs")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -2047,6 +2120,9 @@ DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
     TracingFlags::zone_stats.store(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_SIZE_T(zone_segment_pool_size, 0,
+              "keep up to this many KB of freed zone segments for reuse by "
+              "later zones instead of returning them to the system allocator")
 DEFINE_DEBUG_BOOL(trace_backing_store, false, "trace backing store events")
 DEFINE_INT(gc_stats, 0, "Used by tracing internally to enable gc statistics")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
@@ -2086,6 +2162,12 @@ DEFINE_INT(memory_reducer_gc_count, 2,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_pages_for_young_and_code, false,
+            "advise the OS to back young generation pages and the code range "
+            "with (transparent) huge pages")
+DEFINE_BOOL(huge_pages_for_embedded_builtins, false,
+            "place the builtins remapped into the code range so that they can "
+            "be backed by (transparent) huge pages, and advise the OS to do so")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -2101,6 +2183,14 @@ DEFINE_BOOL(
 // Disabling compaction with stack implies also disabling code space compaction
 // with stack.
 DEFINE_NEG_NEG_IMPLICATION(compact_with_stack, compact_code_space_with_stack)
+DEFINE_BOOL(reuse_pages_across_isolates, false,
+            "Keep the regular data pages of torn down isolates in a "
+            "process-wide pool from which new isolates allocate (intended for "
+            "many short-lived isolates; implies --no-compact)")
+DEFINE_NEG_IMPLICATION(reuse_pages_across_isolates, compact)
+DEFINE_SIZE_T(max_reused_pages_pool_size, 64,
+              "max size of the process-wide page pool in MBytes (see "
+              "--reuse_pages_across_isolates)")
 DEFINE_BOOL(shortcut_strings_with_stack, true,
             "Shortcut Strings during GC with stack")
 DEFINE_BOOL(stress_compaction, false,
@@ -2122,6 +2212,13 @@ DEFINE_BOOL(flush_code_based_on_time, false,
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
             "Flush code when tab goes into the background.")
 DEFINE_INT(bytecode_old_time, 30, "number of seconds before we flush code")
+DEFINE_BOOL(flush_code_based_on_memory_pressure, false,
+            "adapt the number of gcs before we flush code to how often "
+            "flushed code is recompiled, and flush more in gcs that reduce "
+            "memory")
+DEFINE_INT(bytecode_max_old_age, 48,
+           "maximum number of gcs before we flush code with "
+           "--flush-code-based-on-memory-pressure")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_code, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -2201,6 +2298,10 @@ DEFINE_FLOAT(memory_balancer_c_value, 3e-10,
              "A special constant to balance between memory and space tradeoff. "
              "The smaller the more memory it uses.")
 DEFINE_NEG_IMPLICATION(memory_balancer, memory_reducer)
+DEFINE_STRING(memory_balancer_pressure_file, nullptr,
+              "file in pressure stall information format (e.g. "
+              "/sys/fs/cgroup/memory.pressure) from which membalancer reads "
+              "the memory pressure of the environment")
 DEFINE_BOOL(trace_memory_balancer, false, "print memory balancer behavior.")
 
 // assembler-ia32.cc / assembler-arm.cc / assembler-arm64.cc / assembler-x64.cc
@@ -2376,6 +2477,9 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_INT(deopt_hotspot_threshold, 0,
+           "report the stack and feedback of a function once it has "
+           "deoptimized this many times at the same site (0 to disable)")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_turbofan, false, "always try to optimize functions")
@@ -2397,6 +2501,14 @@ DEFINE_BOOL(external_reference_stats, false,
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
 
+// process-wide-code-cache.cc
+DEFINE_BOOL(process_wide_code_cache, false,
+            "share the code of top-level scripts between the isolates of the "
+            "process, keyed by source, through the code serializer")
+DEFINE_SIZE_T(process_wide_code_cache_max_size, 32 * MB,
+              "maximum size in bytes of the process-wide code cache, after "
+              "which the least recently used scripts are evicted")
+
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
 // lazy-compile-dispatcher.cc
@@ -2486,6 +2598,10 @@ DEFINE_IMPLICATION(log_ic, log_code)
 DEFINE_GENERIC_IMPLICATION(
     log_ic, TracingFlags::ic_stats.store(
                 v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_INT(ic_transition_sampling_interval, 0,
+           "record every n-th inline cache transition to a polymorphic or "
+           "megamorphic state, or involving a deprecated map, for "
+           "v8::Isolate::TakeICTransitionSamples (0 to disable)")
 DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
@@ -2521,6 +2637,11 @@ DEFINE_BOOL(move_prototype_transitions_first, false,
             "Always move prototype transitions to the front of the tree")
 DEFINE_WEAK_IMPLICATION(future, move_prototype_transitions_first)
 
+// json-parser.cc
+DEFINE_BOOL(json_shape_cache, true,
+            "reuse maps of previously parsed JSON objects with the same "
+            "property names")
+
 // parser.cc
 DEFINE_BOOL(allow_natives_syntax, false, "allow natives syntax")
 DEFINE_BOOL(allow_natives_for_differential_fuzzing, false,
@@ -2636,6 +2757,9 @@ DEFINE_GENERIC_IMPLICATION(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
 DEFINE_BOOL(rcs, false, "report runtime call counts and times")
 DEFINE_IMPLICATION(rcs, runtime_call_stats)
+DEFINE_INT(runtime_call_stats_sampling_rate, 0,
+           "if greater than 1, only time one in this many top-level runtime "
+           "call stats scopes (together with their nested scopes)")
 
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
@@ -2665,6 +2789,12 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_BOOL(regexp_process_wide_bytecode_cache, false,
+            "share compiled regexp bytecode between all isolates of the "
+            "process")
+DEFINE_INT(regexp_global_cache_max_registers, 4096,
+           "maximum number of capture registers filled by a single call to "
+           "a global regexp's matcher")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -2689,6 +2819,12 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, false,
+            "rule out matches with a lazily built DFA before running the "
+            "experimental engine")
+DEFINE_INT(experimental_regexp_engine_lazy_dfa_max_states, 1024,
+           "maximum number of cached states of the experimental engine's "
+           "lazy DFA")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -2822,7 +2958,8 @@ DEFINE_BOOL(target_is_simulator, false,
             "(mksnapshot only)")
 DEFINE_STRING(turbo_profiling_input, nullptr,
               "Path of the input file containing basic information for "
-              "builtins. (mksnapshot only)")
+              "builtins. (mksnapshot only, unless --turbo-profile-guided-js "
+              "is set)")
 DEFINE_STRING(turbo_log_builtins_count_input, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins for logging in turbolizer. (mksnapshot only)")
@@ -2845,6 +2982,10 @@ DEFINE_BOOL(concurrent_minor_ms_marking, true,
             "perform young generation marking concurrently")
 DEFINE_NEG_NEG_IMPLICATION(concurrent_marking, concurrent_minor_ms_marking)
 
+DEFINE_BOOL(parallel_minor_ms_sweeping, true,
+            "sweep young generation pages on multiple worker threads")
+DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping, parallel_minor_ms_sweeping)
+
 #ifdef V8_ENABLE_STICKY_MARK_BITS
 #define V8_ENABLE_STICKY_MARK_BITS_BOOL true
 #else
@@ -3082,6 +3223,11 @@ DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
 DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
+DEFINE_PERF_PROF_BOOL(
+    perf_prof_async_writes,
+    "Used with --perf-prof, write the jit-<pid>.dump file in batches from a "
+    "background thread.")
+DEFINE_PERF_PROF_IMPLICATION(perf_prof, perf_prof_async_writes)
 
 // --perf-prof-unwinding-info is available only on selected architectures.
 #if V8_TARGET_ARCH_ARM || V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64 || \
@@ -3233,6 +3379,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_ref_clearing)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_minor_ms_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, cppheap_concurrent_marking)
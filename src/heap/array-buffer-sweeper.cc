@@ -94,10 +94,11 @@ class ArrayBufferSweeper::SweepingState final {
     return status_.load(std::memory_order_relaxed) == Status::kDone;
   }
 
+  // Only splices the swept lists back into the sweeper. External memory
+  // counters for freed extensions are already updated by the sweeping job.
   void MergeTo(ArrayBufferSweeper* sweeper) {
     sweeper->young_.Append(new_young_);
     sweeper->old_.Append(new_old_);
-    sweeper->DecrementExternalMemoryCounters(freed_bytes_);
   }
 
   void StartBackgroundSweeping() { job_handle_->NotifyConcurrencyIncrease(); }
@@ -353,7 +354,7 @@ void ArrayBufferSweeper::Detach(ArrayBufferExtension* extension) {
     }
   }
 
-  DecrementExternalMemoryCounters(bytes);
+  DecrementExternalMemoryCounters(heap_, bytes);
 }
 
 void ArrayBufferSweeper::IncrementExternalMemoryCounters(size_t bytes) {
@@ -364,13 +365,15 @@ void ArrayBufferSweeper::IncrementExternalMemoryCounters(size_t bytes) {
       ->AdjustAmountOfExternalAllocatedMemory(static_cast<int64_t>(bytes));
 }
 
-void ArrayBufferSweeper::DecrementExternalMemoryCounters(size_t bytes) {
+// static
+void ArrayBufferSweeper::DecrementExternalMemoryCounters(Heap* heap,
+                                                         size_t bytes) {
   if (bytes == 0) return;
-  heap_->DecrementExternalBackingStoreBytes(
+  heap->DecrementExternalBackingStoreBytes(
       ExternalBackingStoreType::kArrayBuffer, bytes);
   // Unlike IncrementExternalMemoryCounters we don't use
   // AdjustAmountOfExternalAllocatedMemory such that we never start a GC here.
-  heap_->update_external_memory(-static_cast<int64_t>(bytes));
+  heap->update_external_memory(-static_cast<int64_t>(bytes));
 }
 
 void ArrayBufferSweeper::FinalizeAndDelete(ArrayBufferExtension* extension) {
@@ -393,6 +396,12 @@ void ArrayBufferSweeper::SweepingState::SweepingJob::Sweep(
       break;
   }
   if (is_finished) {
+    // Publish freed bytes from the sweeping thread. Both counters are atomic
+    // and decrementing never triggers a GC, so this doesn't need to wait for
+    // the main thread to finalize sweeping.
+    ArrayBufferSweeper::DecrementExternalMemoryCounters(heap_,
+                                                        state_.freed_bytes_);
+    state_.freed_bytes_ = 0;
     state_.SetDone();
   } else {
     TRACE_GC_NOTE("ArrayBufferSweeper Preempted");
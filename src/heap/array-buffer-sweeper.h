@@ -89,7 +89,9 @@ class ArrayBufferSweeper final {
   // Increments external memory counters outside of ArrayBufferSweeper.
   // Increment may trigger GC.
   void IncrementExternalMemoryCounters(size_t bytes);
-  void DecrementExternalMemoryCounters(size_t bytes);
+  // Decrements external memory counters. Never triggers GC and is safe to call
+  // from the background sweeping job.
+  static void DecrementExternalMemoryCounters(Heap* heap, size_t bytes);
 
   void Prepare(SweepingType type,
                TreatAllYoungAsPromoted treat_all_young_as_promoted,
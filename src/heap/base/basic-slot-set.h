@@ -262,6 +262,27 @@ class BasicSlotSet {
         });
   }
 
+  struct Stats {
+    size_t buckets = 0;
+    size_t slots = 0;
+  };
+
+  // Returns the number of allocated buckets and the number of slots recorded
+  // in them. The result is only approximate if the set is concurrently
+  // modified.
+  Stats ComputeStats(size_t buckets) {
+    Stats stats;
+    for (size_t bucket_index = 0; bucket_index < buckets; bucket_index++) {
+      Bucket* bucket = LoadBucket(bucket_index);
+      if (bucket == nullptr) continue;
+      stats.buckets++;
+      for (int i = 0; i < kCellsPerBucket; i++) {
+        stats.slots += v8::base::bits::CountPopulation(bucket->LoadCell(i));
+      }
+    }
+    return stats;
+  }
+
   static constexpr int kCellsPerBucket = 32;
   static constexpr int kCellsPerBucketLog2 = 5;
   static constexpr int kCellSizeBytesLog2 = 2;
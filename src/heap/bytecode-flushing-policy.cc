@@ -0,0 +1,74 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/bytecode-flushing-policy.h"
+
+#include <algorithm>
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/heap.h"
+#include "src/logging/counters.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The age grows once more than this fraction of the flushed functions were
+// compiled again.
+constexpr int kMaxRecompiledFraction = 4;
+
+uint16_t MinOldAge() {
+  return static_cast<uint16_t>(std::max(1, v8_flags.bytecode_old_age.value()));
+}
+
+uint16_t MaxOldAge() {
+  return static_cast<uint16_t>(
+      std::max<int>(MinOldAge(), v8_flags.bytecode_max_old_age));
+}
+
+}  // namespace
+
+BytecodeFlushingPolicy::BytecodeFlushingPolicy(Heap* heap)
+    : heap_(heap), old_age_(MinOldAge()), adaptive_old_age_(MinOldAge()) {}
+
+void BytecodeFlushingPolicy::NotifyStartMarking(bool reduce_memory) {
+  if (!v8_flags.flush_code_based_on_memory_pressure) {
+    old_age_ = MinOldAge();
+    return;
+  }
+  int recompiled = recompiled_.exchange(0, std::memory_order_relaxed);
+  if (flushed_ > 0) {
+    if (recompiled * kMaxRecompiledFraction > flushed_) {
+      adaptive_old_age_ = static_cast<uint16_t>(
+          std::min<int>(adaptive_old_age_ * 2, MaxOldAge()));
+    } else if (recompiled == 0) {
+      adaptive_old_age_ = static_cast<uint16_t>(
+          std::max<int>(adaptive_old_age_ - 1, MinOldAge()));
+    }
+    flushed_ = 0;
+  }
+  old_age_ = reduce_memory
+                 ? static_cast<uint16_t>(std::max(1, adaptive_old_age_ / 2))
+                 : adaptive_old_age_;
+  if (v8_flags.trace_flush_code) {
+    PrintIsolate(heap_->isolate(),
+                 "bytecode flushing: %d recompiled, flushing from age %d\n",
+                 recompiled, old_age_);
+  }
+}
+
+void BytecodeFlushingPolicy::NotifyFlushed(int count) {
+  flushed_ += count;
+  heap_->isolate()->counters()->bytecode_flushed_functions()->Increment(count);
+}
+
+void BytecodeFlushingPolicy::NotifyRecompiled() {
+  recompiled_.fetch_add(1, std::memory_order_relaxed);
+  heap_->isolate()->counters()->bytecode_recompiled_functions()->Increment();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
+#define V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Decides how many full GCs a function has to go without being executed
+// before its bytecode is flushed. The age of a SharedFunctionInfo is reset
+// whenever the function runs, so flushing the functions above an age flushes
+// the least recently used bytecode first.
+//
+// By default the age is fixed at --bytecode-old-age. With
+// --flush-code-based-on-memory-pressure the age instead adapts:
+// - It doubles, up to --bytecode-max-old-age, when many of the functions
+//   flushed since the last adjustment had to be compiled again, so that hot
+//   but infrequently run code isn't recompiled over and over.
+// - It decays back to --bytecode-old-age again once flushing doesn't cause
+//   recompilations.
+// - GCs that reduce memory, such as the ones started by the MemoryReducer or
+//   on memory pressure, use half of it, so that they flush more.
+class BytecodeFlushingPolicy final {
+ public:
+  explicit BytecodeFlushingPolicy(Heap* heap);
+
+  // The age from which bytecode is flushed in the current full GC.
+  uint16_t old_age() const { return old_age_; }
+
+  // Called at the start of every full GC, before any marking visitor is
+  // created.
+  void NotifyStartMarking(bool reduce_memory);
+  // Called from the atomic pause with the number of functions whose bytecode
+  // was flushed.
+  void NotifyFlushed(int count);
+  // Called when a function is compiled lazily again after its bytecode was
+  // flushed.
+  void NotifyRecompiled();
+
+ private:
+  Heap* const heap_;
+  uint16_t old_age_;
+  uint16_t adaptive_old_age_;
+  int flushed_ = 0;
+  std::atomic<int> recompiled_{0};
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
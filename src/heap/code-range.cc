@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <atomic>
 #include <limits>
+#include <optional>
 #include <utility>
 
 #include "src/base/bits.h"
@@ -20,6 +21,9 @@
 #if defined(V8_OS_WIN64)
 #include "src/diagnostics/unwinding-info-win64.h"
 #endif  // V8_OS_WIN64
+#if V8_OS_LINUX
+#include "src/base/platform/platform-linux.h"
+#endif  // V8_OS_LINUX
 
 namespace v8 {
 namespace internal {
@@ -30,6 +34,25 @@ DEFINE_LAZY_LEAKY_OBJECT_GETTER(CodeRangeAddressHint, GetCodeRangeAddressHint)
 
 void FunctionInStaticBinaryForAddressHint() {}
 
+// Size of a transparent huge page on the common 4K page configurations.
+constexpr size_t kHugePageSizeForCodeRange = 2 * MB;
+
+// Advises the OS to back the huge-page-aligned part of the re-embedded
+// builtins with huge pages. Failing to do so is not an error.
+void AdviseHugePagesForEmbeddedBuiltins(uint8_t* code, size_t size) {
+  const Address start = reinterpret_cast<Address>(code);
+  const Address huge_start = RoundUp(start, kHugePageSizeForCodeRange);
+  const Address huge_end = RoundDown(start + size, kHugePageSizeForCodeRange);
+  if (huge_end <= huge_start) return;
+  const bool advised = base::OS::AdviseHugePages(
+      reinterpret_cast<void*>(huge_start), huge_end - huge_start);
+  if (v8_flags.trace_code_range_allocation) {
+    PrintF("=== Huge page advice for embedded builtins [%p, %p): %d\n",
+           reinterpret_cast<void*>(huge_start),
+           reinterpret_cast<void*>(huge_end), advised);
+  }
+}
+
 }  // anonymous namespace
 
 Address CodeRangeAddressHint::GetAddressHint(size_t code_range_size,
@@ -118,9 +141,13 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   // not cross the 4Gb boundary and thus the default compression scheme of
   // truncating the InstructionStream pointers to 32-bits still works. It's
   // achieved by specifying base_alignment parameter.
-  const size_t base_alignment = V8_EXTERNAL_CODE_SPACE_BOOL
-                                    ? base::bits::RoundUpToPowerOfTwo(requested)
-                                    : kPageSize;
+  size_t base_alignment = V8_EXTERNAL_CODE_SPACE_BOOL
+                              ? base::bits::RoundUpToPowerOfTwo(requested)
+                              : kPageSize;
+  if (v8_flags.huge_pages_for_young_and_code) {
+    // Align the range so that all of it can be backed by huge pages.
+    base_alignment = std::max(base_alignment, kHugePageSizeForCodeRange);
+  }
 
   DCHECK_IMPLIES(kPlatformRequiresCodeRange,
                  requested <= kMaximalCodeRangeSize);
@@ -272,6 +299,21 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   }
 #endif  // !defined(V8_OS_WIN)
 
+  if (v8_flags.huge_pages_for_young_and_code) {
+    // The advice only applies to the aligned part of the range. Failing to
+    // apply it is not an error, the range is then backed by regular pages.
+    const Address huge_start = RoundUp(base(), kHugePageSizeForCodeRange);
+    const Address huge_end =
+        RoundDown(base() + size(), kHugePageSizeForCodeRange);
+    if (huge_end > huge_start) {
+      const bool advised = params.page_allocator->AdviseHugePages(
+          reinterpret_cast<void*>(huge_start), huge_end - huge_start);
+      TRACE("=== Huge page advice for [%p, %p): %d\n",
+            reinterpret_cast<void*>(huge_start),
+            reinterpret_cast<void*>(huge_end), advised);
+    }
+  }
+
   return true;
 }
 
@@ -396,6 +438,32 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
   size_t hint_offset =
       std::min(max_pc_relative_code_range, code_region.size()) -
       allocate_code_size;
+  // Offset of the blob in the file it is mapped from, if any.
+  std::optional<uint64_t> blob_file_offset;
+#if V8_OS_LINUX
+  if (v8_flags.huge_pages_for_embedded_builtins) {
+    blob_file_offset = base::GetFileOffsetOfAddress(embedded_blob_code);
+  }
+#endif  // V8_OS_LINUX
+  if (blob_file_offset.has_value()) {
+    // A file-backed mapping can only be backed by huge pages where its
+    // addresses are congruent to their file offsets modulo the huge page size.
+    // RemapPages maps the blob from its own file offset, so place the copy at
+    // the same distance from a huge page boundary as that offset. The virtual
+    // address of the blob in the binary does not matter: with PIE and 4K
+    // aligned segments it only matches the file offset by chance.
+    const Address blob_offset = static_cast<Address>(
+        *blob_file_offset % kHugePageSizeForCodeRange);
+    const Address end = code_region.begin() + hint_offset;
+    if (IsAligned(blob_offset, kAllocatePageSize) && end >= blob_offset) {
+      const Address start =
+          RoundDown(end - blob_offset, kHugePageSizeForCodeRange) +
+          blob_offset;
+      if (start >= code_region.begin()) {
+        hint_offset = start - code_region.begin();
+      }
+    }
+  }
   void* hint = reinterpret_cast<void*>(code_region.begin() + hint_offset);
 
   embedded_blob_code_copy =
@@ -446,6 +514,21 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
                                      base::OS::MemoryPermission::kReadExecute);
 
       if (ok) {
+        if (v8_flags.huge_pages_for_embedded_builtins) {
+          if (v8_flags.trace_code_range_allocation) {
+            const bool congruent =
+                blob_file_offset.has_value() &&
+                reinterpret_cast<Address>(embedded_blob_code_copy) %
+                        kHugePageSizeForCodeRange ==
+                    *blob_file_offset % kHugePageSizeForCodeRange;
+            PrintF(
+                "=== Embedded builtins remapped to %p, huge page congruent "
+                "with file offset: %d\n",
+                embedded_blob_code_copy, congruent);
+          }
+          AdviseHugePagesForEmbeddedBuiltins(embedded_blob_code_copy,
+                                             code_size);
+        }
         embedded_blob_code_copy_.store(embedded_blob_code_copy,
                                        std::memory_order_release);
         return embedded_blob_code_copy;
@@ -479,6 +562,10 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
                                   "Re-embedded builtins: set permissions");
     }
   }
+  if (v8_flags.huge_pages_for_embedded_builtins) {
+    // The copy is private memory, but still benefits from fewer iTLB misses.
+    AdviseHugePagesForEmbeddedBuiltins(embedded_blob_code_copy, code_size);
+  }
   embedded_blob_code_copy_.store(embedded_blob_code_copy,
                                  std::memory_order_release);
   return embedded_blob_code_copy;
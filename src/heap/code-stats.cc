@@ -9,6 +9,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/paged-spaces-inl.h"  // For PagedSpaceObjectIterator.
+#include "src/objects/deoptimization-data-inl.h"
 #include "src/objects/objects-inl.h"
 
 namespace v8 {
@@ -36,6 +37,13 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(Tagged<HeapObject> object,
     if (IsCode(abstract_code, cage_base)) {
       size += isolate->code_and_metadata_size();
       isolate->set_code_and_metadata_size(size);
+      Tagged<Code> code = Cast<Code>(abstract_code);
+      if (code->uses_deoptimization_data()) {
+        isolate->set_deoptimization_data_size(
+            isolate->deoptimization_data_size() +
+            Cast<DeoptimizationData>(code->deoptimization_data())
+                ->SizeIncludingMetadata());
+      }
     } else {
       size += isolate->bytecode_and_metadata_size();
       isolate->set_bytecode_and_metadata_size(size);
@@ -54,6 +62,7 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(Tagged<HeapObject> object,
 void CodeStatistics::ResetCodeAndMetadataStatistics(Isolate* isolate) {
   isolate->set_code_and_metadata_size(0);
   isolate->set_bytecode_and_metadata_size(0);
+  isolate->set_deoptimization_data_size(0);
   isolate->set_external_script_source_size(0);
 #ifdef DEBUG
   ResetCodeStatistics(isolate);
@@ -109,6 +118,10 @@ void CodeStatistics::ReportCodeStatistics(Isolate* isolate) {
     PrintF("Bytecode size including metadata: %10d bytes\n",
            isolate->bytecode_and_metadata_size());
   }
+  if (isolate->deoptimization_data_size() > 0) {
+    PrintF("Deoptimization data size        : %10d bytes\n",
+           isolate->deoptimization_data_size());
+  }
 
   // Report code comment statistics
   CommentStatistic* comments_statistics =
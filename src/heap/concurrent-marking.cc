@@ -15,11 +15,13 @@
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/heap/base/cached-unordered-map.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/ephemeron-remembered-set.h"
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
+#include "src/heap/instance-type-stats.h"
 #include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/marking-state-inl.h"
@@ -68,11 +70,12 @@ class ConcurrentMarkingVisitor final
                            base::EnumSet<CodeFlushMode> code_flush_mode,
                            bool should_keep_ages_unchanged,
                            uint16_t code_flushing_increase,
+                           uint16_t bytecode_old_age,
                            MemoryChunkDataMap* memory_chunk_data)
       : FullMarkingVisitorBase(local_marking_worklists, local_weak_objects,
                                heap, mark_compact_epoch, code_flush_mode,
                                should_keep_ages_unchanged,
-                               code_flushing_increase),
+                               code_flushing_increase, bytecode_old_age),
         memory_chunk_data_(memory_chunk_data) {}
 
   using FullMarkingVisitorBase<
@@ -134,6 +137,7 @@ struct ConcurrentMarking::TaskState {
   size_t marked_bytes = 0;
   MemoryChunkDataMap memory_chunk_data;
   NativeContextStats native_context_stats;
+  InstanceTypeStats instance_type_stats;
   PretenuringHandler::PretenuringFeedbackMap local_pretenuring_feedback{
       PretenuringHandler::kInitialFeedbackCapacity};
 };
@@ -276,9 +280,14 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
   ConcurrentMarkingVisitor visitor(
       &local_marking_worklists, &local_weak_objects, heap_, mark_compact_epoch,
       code_flush_mode, should_keep_ages_unchanged,
-      heap_->tracer()->CodeFlushingIncrease(), &task_state->memory_chunk_data);
+      heap_->tracer()->CodeFlushingIncrease(),
+      heap_->bytecode_flushing_policy()->old_age(),
+      &task_state->memory_chunk_data);
   NativeContextInferrer native_context_inferrer;
   NativeContextStats& native_context_stats = task_state->native_context_stats;
+  InstanceTypeStats& instance_type_stats = task_state->instance_type_stats;
+  const bool track_instance_type_stats =
+      v8_flags.track_gc_instance_type_stats;
   double time_ms;
   size_t marked_bytes = 0;
   Isolate* isolate = heap_->isolate();
@@ -358,6 +367,9 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
             native_context_stats.IncrementSize(
                 local_marking_worklists.Context(), map, object, visited_size);
           }
+          if (V8_UNLIKELY(track_instance_type_stats)) {
+            instance_type_stats.Increment(map->instance_type(), visited_size);
+          }
           current_marked_bytes += visited_size;
         }
       }
@@ -749,6 +761,14 @@ void ConcurrentMarking::FlushNativeContexts(NativeContextStats* main_stats) {
   }
 }
 
+void ConcurrentMarking::FlushInstanceTypeStats(InstanceTypeStats* main_stats) {
+  DCHECK(!job_handle_ || !job_handle_->IsValid());
+  for (size_t i = 1; i < task_state_.size(); i++) {
+    main_stats->Merge(task_state_[i]->instance_type_stats);
+    task_state_[i]->instance_type_stats.Clear();
+  }
+}
+
 void ConcurrentMarking::FlushMemoryChunkData() {
   DCHECK(!job_handle_ || !job_handle_->IsValid());
   for (size_t i = 1; i < task_state_.size(); i++) {
@@ -4,12 +4,15 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <atomic>
 #include <map>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
 #include "include/cppgc/macros.h"
+#include "include/cppgc/platform.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/cppgc/compaction-worklists.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap-base.h"
@@ -55,6 +58,13 @@ class MovableReferences final {
   // marking visitors.
   void UpdateCallbacks();
 
+  // Relocation can run concurrently for different spaces if every recorded
+  // slot lives outside of compactable spaces, i.e., no slot is moved itself,
+  // and no move listeners need to be notified.
+  bool SupportsConcurrentRelocation() const {
+    return interior_movable_references_.empty() && !heap_has_move_listeners_;
+  }
+
  private:
   HeapBase& heap_;
 
@@ -77,6 +87,7 @@ class MovableReferences final {
   // The following two collections are used to allow refer back from a slot to
   // an already moved object.
   std::unordered_set<const void*> moved_objects_;
+  v8::base::Mutex moved_objects_mutex_;
   std::unordered_map<MovableReference*, MovableReference>
       interior_slot_to_object_;
 #endif  // DEBUG
@@ -140,7 +151,10 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
 void MovableReferences::Relocate(Address from, Address to,
                                  size_t size_including_header) {
 #if DEBUG
-  moved_objects_.insert(from);
+  {
+    v8::base::MutexGuard guard(&moved_objects_mutex_);
+    moved_objects_.insert(from);
+  }
 #endif  // DEBUG
 
   if (V8_UNLIKELY(heap_has_move_listeners_)) {
@@ -275,7 +289,9 @@ class CompactionState final {
     DCHECK_LE(used_bytes_in_current_page_, current_page_->PayloadSize());
   }
 
-  void FinishCompactingSpace() {
+  // Returns the pages that remained available. They must be released back to
+  // the backend on the mutator thread.
+  Pages FinishCompactingSpace() {
     // If the current page hasn't been allocated into, add it to the available
     // list, for subsequent release below.
     if (used_bytes_in_current_page_ == 0) {
@@ -284,11 +300,10 @@ class CompactionState final {
       ReturnCurrentPageToSpace();
     }
 
-    // Return remaining available pages back to the backend.
     for (NormalPage* page : available_pages_) {
       SetMemoryInaccessible(page->PayloadStart(), page->PayloadSize());
-      NormalPage::Destroy(page, FreeMemoryHandling::kDiscardWherePossible);
     }
+    return std::move(available_pages_);
   }
 
   void FinishCompactingPage(NormalPage* page) {
@@ -359,14 +374,10 @@ void CompactPage(NormalPage* page, CompactionState& compaction_state,
     }
 
     if (!header->IsMarked()) {
-      // Compaction is currently launched only from AtomicPhaseEpilogue, so it's
-      // guaranteed to be on the mutator thread - no need to postpone
-      // finalization.
-      header->Finalize();
-
-      // As compaction is under way, leave the freed memory accessible
-      // while compacting the rest of the page. We just zap the payload
-      // to catch out other finalizers trying to access it.
+      // The object was already finalized on the mutator thread in
+      // FinalizeUnmarkedObjects(). As compaction is under way, leave the freed
+      // memory accessible while compacting the rest of the page. We just zap
+      // the payload to catch out other finalizers trying to access it.
 #if DEBUG || defined(V8_USE_MEMORY_SANITIZER) || \
     defined(V8_USE_ADDRESS_SANITIZER)
       ZapMemory(header, size);
@@ -392,10 +403,36 @@ void CompactPage(NormalPage* page, CompactionState& compaction_state,
   compaction_state.FinishCompactingPage(page);
 }
 
-void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
-                  StickyBits sticky_bits) {
-  using Pages = NormalPageSpace::Pages;
+// Invokes finalizers of dead objects on |page|. Compaction is launched only
+// from AtomicPhaseEpilogue, so this is guaranteed to be on the mutator thread
+// and there's no need to postpone finalization. Doing this upfront keeps
+// the actual compaction free of embedder callbacks, so that it can be moved to
+// worker threads.
+void FinalizeUnmarkedObjects(NormalPage* page) {
+  for (Address header_address = page->PayloadStart();
+       header_address < page->PayloadEnd();) {
+    HeapObjectHeader* header =
+        reinterpret_cast<HeapObjectHeader*>(header_address);
+    const size_t size = header->AllocatedSize();
+    DCHECK_GT(size, 0u);
+    if (!header->IsFree() && !header->IsMarked()) {
+      header->Finalize();
+    }
+    header_address += size;
+  }
+}
 
+// A space that has been detached from the heap and is ready to be compacted.
+struct SpaceToCompact {
+  NormalPageSpace* space;
+  NormalPageSpace::Pages pages;
+  // Pages that are no longer needed after compaction.
+  std::vector<NormalPage*> unused_pages;
+};
+
+// Prepares |space| for compaction on the mutator thread. Returns the pages
+// that should be compacted, which is empty if there is nothing to do.
+NormalPageSpace::Pages PrepareSpaceForCompaction(NormalPageSpace* space) {
 #ifdef V8_USE_ADDRESS_SANITIZER
   UnmarkedObjectsPoisoner().Traverse(*space);
 #endif  // V8_USE_ADDRESS_SANITIZER
@@ -404,6 +441,21 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
 
   space->free_list().Clear();
 
+  NormalPageSpace::Pages pages = space->RemoveAllPages();
+  for (BasePage* page : pages) {
+    // Large objects do not belong to this arena.
+    FinalizeUnmarkedObjects(NormalPage::From(page));
+  }
+  return pages;
+}
+
+void CompactSpace(SpaceToCompact& space_to_compact,
+                  MovableReferences& movable_references,
+                  StickyBits sticky_bits) {
+  NormalPageSpace* space = space_to_compact.space;
+  const NormalPageSpace::Pages& pages = space_to_compact.pages;
+  DCHECK(space->is_compactable());
+
   // Compaction generally follows Jonker's algorithm for fast garbage
   // compaction. Compaction is performed in-place, sliding objects down over
   // unused holes for a smaller heap page footprint and improved locality. A
@@ -430,7 +482,6 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
   // To ease the passing of the compaction state when iterating over an
   // arena's pages, package it up into a |CompactionState|.
 
-  Pages pages = space->RemoveAllPages();
   if (pages.empty()) return;
 
   CompactionState compaction_state(space, movable_references);
@@ -440,10 +491,45 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
     CompactPage(NormalPage::From(page), compaction_state, sticky_bits);
   }
 
-  compaction_state.FinishCompactingSpace();
+  space_to_compact.unused_pages = compaction_state.FinishCompactingSpace();
   // Sweeping will verify object start bitmap of compacted space.
 }
 
+// Compacts independent spaces in parallel. Each space is compacted by a single
+// thread as sliding compaction within a space is inherently sequential.
+class ConcurrentCompactionJob final : public cppgc::JobTask {
+ public:
+  ConcurrentCompactionJob(HeapBase& heap, std::vector<SpaceToCompact>& spaces,
+                          MovableReferences& movable_references,
+                          StickyBits sticky_bits)
+      : heap_(heap),
+        spaces_(spaces),
+        movable_references_(movable_references),
+        sticky_bits_(sticky_bits) {}
+
+  void Run(cppgc::JobDelegate* delegate) final {
+    StatsCollector::DisabledConcurrentScope stats_scope(
+        heap_.stats_collector(), StatsCollector::kConcurrentCompact);
+    for (size_t index = next_space_.fetch_add(1, std::memory_order_relaxed);
+         index < spaces_.size();
+         index = next_space_.fetch_add(1, std::memory_order_relaxed)) {
+      CompactSpace(spaces_[index], movable_references_, sticky_bits_);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t /* active_worker_count */) const final {
+    const size_t next = next_space_.load(std::memory_order_relaxed);
+    return next < spaces_.size() ? spaces_.size() - next : 0;
+  }
+
+ private:
+  HeapBase& heap_;
+  std::vector<SpaceToCompact>& spaces_;
+  MovableReferences& movable_references_;
+  const StickyBits sticky_bits_;
+  std::atomic<size_t> next_space_{0};
+};
+
 size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
   return std::accumulate(spaces.cbegin(), spaces.cend(), 0u,
                          [](size_t acc, const NormalPageSpace* space) {
@@ -523,12 +609,39 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   }
   compaction_worklists_.reset();
 
-  const bool young_gen_enabled = heap_.heap()->generational_gc_supported();
+  const StickyBits sticky_bits = heap_.heap()->generational_gc_supported()
+                                     ? StickyBits::kEnabled
+                                     : StickyBits::kDisabled;
 
+  std::vector<SpaceToCompact> spaces;
   for (NormalPageSpace* space : compactable_spaces_) {
-    CompactSpace(
-        space, movable_references,
-        young_gen_enabled ? StickyBits::kEnabled : StickyBits::kDisabled);
+    NormalPageSpace::Pages pages = PrepareSpaceForCompaction(space);
+    if (pages.empty()) continue;
+    spaces.push_back({space, std::move(pages)});
+  }
+
+  std::unique_ptr<cppgc::JobHandle> job_handle;
+  if (spaces.size() > 1 && movable_references.SupportsConcurrentRelocation() &&
+      heap_.heap()->platform()) {
+    job_handle = heap_.heap()->platform()->PostJob(
+        cppgc::TaskPriority::kUserBlocking,
+        std::make_unique<ConcurrentCompactionJob>(
+            *heap_.heap(), spaces, movable_references, sticky_bits));
+  }
+  if (job_handle) {
+    // The mutator thread contributes and waits for all spaces to be done.
+    job_handle->Join();
+  } else {
+    for (SpaceToCompact& space_to_compact : spaces) {
+      CompactSpace(space_to_compact, movable_references, sticky_bits);
+    }
+  }
+
+  // Return remaining available pages back to the backend.
+  for (SpaceToCompact& space_to_compact : spaces) {
+    for (NormalPage* page : space_to_compact.unused_pages) {
+      NormalPage::Destroy(page, FreeMemoryHandling::kDiscardWherePossible);
+    }
   }
 
   enable_for_next_gc_for_testing_ = false;
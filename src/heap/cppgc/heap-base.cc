@@ -213,6 +213,8 @@ void HeapBase::ResetRememberedSet() {
     return;
   }
 
+  StatsCollector::EnabledScope stats_scope(stats_collector(),
+                                           StatsCollector::kResetRememberedSet);
   AgeTableResetter age_table_resetter;
   age_table_resetter.Run(raw_heap());
 
@@ -54,6 +54,7 @@ namespace internal {
   V(MarkVisitCrossThreadPersistents)        \
   V(MarkVisitStack)                         \
   V(MarkVisitRememberedSets)                \
+  V(ResetRememberedSet)                     \
   V(WeakContainerCallbacksProcessing)       \
   V(CustomCallbacksProcessing)              \
   V(SweepFinishIfOutOfWork)                 \
@@ -70,7 +71,9 @@ namespace internal {
   V(ConcurrentWeakCallback)                          \
   V(ConcurrentWeakPersistent)
 
-#define CPPGC_FOR_ALL_CONCURRENT_SCOPES(V) V(ConcurrentMarkProcessEphemerons)
+#define CPPGC_FOR_ALL_CONCURRENT_SCOPES(V) \
+  V(ConcurrentMarkProcessEphemerons)       \
+  V(ConcurrentCompact)
 
 // Sink for various time and memory statistics.
 class V8_EXPORT_PRIVATE StatsCollector final {
@@ -1550,6 +1550,7 @@ Handle<Script> Factory::CloneScript(DirectHandle<Script> script,
     new_script->set_source_hash(*undefined_value(), SKIP_WRITE_BARRIER);
     new_script->set_compiled_lazy_function_positions(*undefined_value(),
                                                      SKIP_WRITE_BARRIER);
+    new_script->set_literal_sites(*undefined_value(), SKIP_WRITE_BARRIER);
 #ifdef V8_SCRIPTORMODULE_LEGACY_LIFETIME
     new_script->set_script_or_modules(*list);
 #endif
@@ -4138,7 +4139,7 @@ Handle<RegExpData> Factory::NewIrRegExpData(DirectHandle<String> source,
   instance->set_max_register_count(JSRegExp::kUninitializedValue);
   instance->set_capture_count(capture_count);
   int ticks_until_tier_up = v8_flags.regexp_tier_up
-                                ? v8_flags.regexp_tier_up_ticks
+                                ? isolate()->regexp_tier_up_ticks()
                                 : JSRegExp::kUninitializedValue;
   instance->set_ticks_until_tier_up(ticks_until_tier_up);
   instance->set_backtrack_limit(backtrack_limit);
@@ -82,9 +82,9 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // microtask checkpoint after each cleanup task, so the task should return
   // after an exception so the host can perform a microtask checkpoint. In case
   // of exception, check if the FinalizationRegistry still needs cleanup
-  // and should be requeued.
-  //
-  // TODO(syg): Implement better scheduling for finalizers.
+  // and should be requeued. The same happens when the task has run
+  // --finalization-registry-cleanup-batch-size callbacks, so that a registry
+  // with many cleared cells is cleaned up over several tasks.
   InvokeFinalizationRegistryCleanupFromTask(native_context,
                                             finalization_registry, callback);
   if (finalization_registry->NeedsCleanup() &&
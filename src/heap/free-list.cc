@@ -450,6 +450,14 @@ size_t FreeList::EvictFreeListItems(PageMetadata* page) {
   return sum;
 }
 
+size_t FreeList::AvailableInCategory(FreeListCategoryType type) {
+  size_t sum = 0;
+  ForAllFreeListCategories(type, [&sum](FreeListCategory* category) {
+    sum += category->available();
+  });
+  return sum;
+}
+
 void FreeList::RepairLists(Heap* heap) {
   ForAllFreeListCategories(
       [heap](FreeListCategory* category) { category->RepairFreeList(heap); });
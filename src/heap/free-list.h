@@ -193,6 +193,12 @@ class FreeList {
 
   size_t min_block_size() const { return min_block_size_; }
 
+  // Returns the size of the smallest blocks that go into category |type|.
+  virtual size_t CategoryMinSize(FreeListCategoryType type) const = 0;
+
+  // Returns the number of bytes in category |type| across all pages.
+  V8_EXPORT_PRIVATE size_t AvailableInCategory(FreeListCategoryType type);
+
   template <typename Callback>
   void ForAllFreeListCategories(FreeListCategoryType type, Callback callback) {
     FreeListCategory* current = categories_[type];
@@ -299,6 +305,10 @@ class V8_EXPORT_PRIVATE FreeListMany : public FreeList {
       size_t size_in_bytes, size_t* node_size,
       AllocationOrigin origin) override;
 
+  size_t CategoryMinSize(FreeListCategoryType type) const override {
+    return categories_min[type];
+  }
+
  protected:
   static constexpr size_t kMinBlockSize = 3 * kTaggedSize;
 
@@ -316,6 +316,19 @@ void GCTracer::StopInSafepoint(base::TimeTicks time) {
   current_.survived_young_object_size = heap_->SurvivedYoungObjectSize();
   current_.end_atomic_pause_time = time;
 
+#if defined(V8_USE_PERFETTO)
+  // Heap sizes after each atomic pause, as counter tracks that line up with
+  // the GC scopes of the cycle.
+  TRACE_COUNTER(TRACE_DISABLED_BY_DEFAULT("v8.gc"), "ObjectSizeAfterGC",
+                current_.end_object_size);
+  TRACE_COUNTER(TRACE_DISABLED_BY_DEFAULT("v8.gc"), "MemorySizeAfterGC",
+                current_.end_memory_size);
+  TRACE_COUNTER(TRACE_DISABLED_BY_DEFAULT("v8.gc"), "HolesSizeAfterGC",
+                current_.end_holes_size);
+  TRACE_COUNTER(TRACE_DISABLED_BY_DEFAULT("v8.gc"), "SurvivedYoungObjectSize",
+                current_.survived_young_object_size);
+#endif
+
   // Do not include the GC pause for calculating the allocation rate. GC pause
   // with heap verification can decrease the allocation rate significantly.
   allocation_time_ = time;
@@ -339,6 +352,11 @@ void GCTracer::StopObservablePause(GarbageCollector collector,
   FetchBackgroundCounters();
 
   const base::TimeDelta duration = current_.end_time - current_.start_time;
+  if (pause_budget_ && duration > *pause_budget_) {
+    RecordPauseBudgetExceeded(
+        Heap::IsYoungGenerationCollector(collector) ? "young" : "full",
+        duration);
+  }
   auto* long_task_stats = heap_->isolate()->GetCurrentLongTaskStats();
   const bool is_young = Heap::IsYoungGenerationCollector(collector);
   if (is_young) {
@@ -714,6 +732,22 @@ void GCTracer::AddIncrementalSweepingStep(double duration) {
   ReportIncrementalSweepingStepToRecorder(duration);
 }
 
+void GCTracer::RecordPauseBudgetExceeded(const char* pause_kind,
+                                         base::TimeDelta duration) {
+  DCHECK(pause_budget_.has_value());
+  pause_budget_exceeded_count_++;
+  TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                       "V8.GCPauseBudgetExceeded", TRACE_EVENT_SCOPE_THREAD,
+                       "kind", pause_kind, "duration",
+                       duration.InMillisecondsF());
+  if (V8_UNLIKELY(v8_flags.trace_gc_verbose)) {
+    heap_->isolate()->PrintWithTimestamp(
+        "GC pause budget exceeded: kind=%s duration=%.1fms budget=%.1fms\n",
+        pause_kind, duration.InMillisecondsF(),
+        pause_budget_->InMillisecondsF());
+  }
+}
+
 void GCTracer::Output(const char* format, ...) const {
   if (v8_flags.trace_gc) {
     va_list arguments;
@@ -823,6 +857,7 @@ void GCTracer::PrintNVP() const {
           "scavenge.weak=%.2f "
           "scavenge.weak_global_handles.identify=%.2f "
           "scavenge.weak_global_handles.process=%.2f "
+          "scavenge.weak_traced_handles.process=%.2f "
           "scavenge.parallel=%.2f "
           "scavenge.update_refs=%.2f "
           "scavenge.sweep_array_buffers=%.2f "
@@ -845,7 +880,8 @@ void GCTracer::PrintNVP() const {
           "promotion_rate=%.1f%% "
           "new_space_survive_rate_=%.1f%% "
           "new_space_allocation_throughput=%.1f "
-          "pool_chunks=%zu\n",
+          "pool_chunks=%zu "
+          "huge_page_advised=%.1f%%\n",
           duration.InMillisecondsF(), spent_in_mutator.InMillisecondsF(),
           ToString(current_.type, true), current_.reduce_memory,
           young_gc_while_full_gc_,
@@ -863,6 +899,7 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::SCAVENGER_SCAVENGE_WEAK),
           current_scope(Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_IDENTIFY),
           current_scope(Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_PROCESS),
+          current_scope(Scope::SCAVENGER_SCAVENGE_WEAK_TRACED_HANDLES_PROCESS),
           current_scope(Scope::SCAVENGER_SCAVENGE_PARALLEL),
           current_scope(Scope::SCAVENGER_SCAVENGE_UPDATE_REFS),
           current_scope(Scope::SCAVENGER_SWEEP_ARRAY_BUFFERS),
@@ -880,7 +917,8 @@ void GCTracer::PrintNVP() const {
           AverageSurvivalRatio(), heap_->promotion_rate_,
           heap_->new_space_surviving_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
-          heap_->memory_allocator()->pool()->NumberOfCommittedChunks());
+          heap_->memory_allocator()->pool()->NumberOfCommittedChunks(),
+          heap_->memory_allocator()->HugePageAdvisedPercentage());
       break;
     case Event::Type::MINOR_MARK_SWEEPER:
     case Event::Type::INCREMENTAL_MINOR_MARK_SWEEPER:
@@ -895,6 +933,7 @@ void GCTracer::PrintNVP() const {
           "mark.incremental_seed=%.2f "
           "mark.finish_incremental=%.2f "
           "mark.seed=%.2f "
+          "mark.seed.traced_handles=%.2f "
           "mark.traced_handles=%.2f "
           "mark.closure_parallel=%.2f "
           "mark.closure=%.2f "
@@ -903,6 +942,7 @@ void GCTracer::PrintNVP() const {
           "clear.string_forwarding_table=%.2f "
           "clear.string_table=%.2f "
           "clear.global_handles=%.2f "
+          "clear.traced_handles=%.2f "
           "complete.sweep_array_buffers=%.2f "
           "complete.sweeping=%.2f "
           "sweep=%.2f "
@@ -940,6 +980,7 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::MINOR_MS_MARK_INCREMENTAL_SEED),
           current_scope(Scope::MINOR_MS_MARK_FINISH_INCREMENTAL),
           current_scope(Scope::MINOR_MS_MARK_SEED),
+          current_scope(Scope::MINOR_MS_MARK_SEED_TRACED_HANDLES),
           current_scope(Scope::MINOR_MS_MARK_TRACED_HANDLES),
           current_scope(Scope::MINOR_MS_MARK_CLOSURE_PARALLEL),
           current_scope(Scope::MINOR_MS_MARK_CLOSURE),
@@ -948,6 +989,7 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::MINOR_MS_CLEAR_STRING_FORWARDING_TABLE),
           current_scope(Scope::MINOR_MS_CLEAR_STRING_TABLE),
           current_scope(Scope::MINOR_MS_CLEAR_WEAK_GLOBAL_HANDLES),
+          current_scope(Scope::MINOR_MS_CLEAR_WEAK_TRACED_HANDLES),
           current_scope(Scope::MINOR_MS_COMPLETE_SWEEP_ARRAY_BUFFERS),
           current_scope(Scope::MINOR_MS_COMPLETE_SWEEPING),
           current_scope(Scope::MINOR_MS_SWEEP),
@@ -1071,6 +1113,7 @@ void GCTracer::PrintNVP() const {
           "new_space_survive_rate=%.1f%% "
           "new_space_allocation_throughput=%.1f "
           "pool_chunks=%zu "
+          "huge_page_advised=%.1f%% "
           "compaction_speed=%.f\n",
           duration.InMillisecondsF(), spent_in_mutator.InMillisecondsF(),
           ToString(current_.type, true), current_.reduce_memory,
@@ -1159,6 +1202,7 @@ void GCTracer::PrintNVP() const {
           heap_->new_space_surviving_rate_,
           NewSpaceAllocationThroughputInBytesPerMillisecond(),
           heap_->memory_allocator()->pool()->NumberOfCommittedChunks(),
+          heap_->memory_allocator()->HugePageAdvisedPercentage(),
           CompactionSpeedInBytesPerMillisecond());
       break;
     case Event::Type::START:
@@ -448,6 +448,21 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void RecordEmbedderSpeed(size_t bytes, double duration);
 
+  // Sets the budget that individual main-thread GC pauses should not exceed.
+  // Incremental marking steps are capped to the budget; longer atomic pauses
+  // are reported via RecordPauseBudgetExceeded().
+  void SetPauseBudget(std::optional<base::TimeDelta> budget) {
+    pause_budget_ = budget;
+  }
+  std::optional<base::TimeDelta> pause_budget() const { return pause_budget_; }
+
+  // Reports a main-thread pause of |duration| that exceeded the pause budget.
+  void RecordPauseBudgetExceeded(const char* pause_kind,
+                                 base::TimeDelta duration);
+  size_t pause_budget_exceeded_count() const {
+    return pause_budget_exceeded_count_;
+  }
+
   // Returns the average time between scheduling and invocation of an
   // incremental marking task.
   std::optional<base::TimeDelta> AverageTimeToIncrementalMarkingTask() const;
@@ -529,6 +544,9 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   std::optional<base::TimeDelta> average_time_to_incremental_marking_task_;
 
+  std::optional<base::TimeDelta> pause_budget_;
+  size_t pause_budget_exceeded_count_ = 0;
+
   double recorded_embedder_speed_ = 0.0;
 
   // This is not the general last marking start time as it's only updated when
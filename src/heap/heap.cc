@@ -4,6 +4,7 @@
 
 #include "src/heap/heap.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cinttypes>
 #include <iomanip>
@@ -43,6 +44,7 @@
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/base/stack.h"
 #include "src/heap/base/worklist.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/code-range.h"
 #include "src/heap/code-stats.h"
 #include "src/heap/collection-barrier.h"
@@ -110,6 +112,7 @@
 #include "src/objects/slots-inl.h"
 #include "src/objects/visitors.h"
 #include "src/profiler/heap-profiler.h"
+#include "src/regexp/experimental/experimental-interpreter.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -120,6 +123,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -2320,6 +2324,10 @@ void Heap::PerformGarbageCollection(GarbageCollector collector,
 
   PerformHeapVerification();
 
+  if (IsYoungGenerationCollector(collector)) {
+    MaybeTraceOldToNewRememberedSet();
+  }
+
   const size_t start_young_generation_size =
       NewSpaceSize() + (new_lo_space() ? new_lo_space()->SizeOfObjects() : 0);
 
@@ -2731,6 +2739,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->descriptor_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  isolate_->experimental_regexp_dfa_cache()->Clear();
 
   FlushNumberStringCache();
 }
@@ -4154,6 +4163,7 @@ void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     // The optimizing compiler may be unnecessarily holding on to memory.
     isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
+    isolate()->allocator()->ReleasePooledSegments();
   }
   // Reset the memory pressure level to avoid recursive GCs triggered by
   // CheckMemoryPressure from AdjustAmountOfExternalMemory called by
@@ -5105,6 +5115,12 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints,
 
   code_range_size_ = constraints.code_range_size_in_bytes();
 
+  if (v8_flags.heap_numa_node >= 0) {
+    numa_node_preference_ = v8_flags.heap_numa_node;
+  } else if (constraints.numa_node_preference() >= 0) {
+    numa_node_preference_ = constraints.numa_node_preference();
+  }
+
   if (cpp_heap) {
     AttachCppHeap(cpp_heap);
     owning_cpp_heap_.reset(CppHeap::From(cpp_heap));
@@ -5140,6 +5156,52 @@ void Heap::ConfigureHeapDefault() {
   ConfigureHeap(constraints, nullptr);
 }
 
+void Heap::MaybeTraceOldToNewRememberedSet() {
+  const unsigned interval = v8_flags.trace_old_to_new_remembered_set_interval;
+  if (interval == 0 || (gc_count_ - ms_count_) % interval != 0) return;
+
+  struct PageStats {
+    MutablePageMetadata* chunk;
+    SlotSet::Stats stats;
+  };
+  std::vector<PageStats> pages;
+  SlotSet::Stats total;
+  OldGenerationMemoryChunkIterator::ForAll(
+      this, [&pages, &total](MutablePageMetadata* chunk) {
+        SlotSet* slot_set = chunk->slot_set<OLD_TO_NEW>();
+        if (!slot_set) return;
+        SlotSet::Stats stats = slot_set->ComputeStats(chunk->buckets());
+        total.buckets += stats.buckets;
+        total.slots += stats.slots;
+        pages.push_back({chunk, stats});
+      });
+  PrintIsolate(isolate_,
+               "old-to-new remembered set: pages=%zu buckets=%zu slots=%zu\n",
+               pages.size(), total.buckets, total.slots);
+
+  // Pages with many slots are the ones worth looking at, as their slots are
+  // visited on every young generation gc.
+  static constexpr size_t kMaxPagesToPrint = 8;
+  const size_t pages_to_print = std::min(pages.size(), kMaxPagesToPrint);
+  std::partial_sort(pages.begin(), pages.begin() + pages_to_print, pages.end(),
+                    [](const PageStats& a, const PageStats& b) {
+                      return a.stats.slots > b.stats.slots;
+                    });
+  for (size_t i = 0; i < pages_to_print; i++) {
+    const PageStats& page = pages[i];
+    const double density =
+        page.stats.buckets == 0
+            ? 0.0
+            : 100.0 * page.stats.slots /
+                  (page.stats.buckets * SlotSet::kBitsPerBucket);
+    PrintIsolate(isolate_,
+                 "  page=%p space=%s buckets=%zu slots=%zu density=%.1f%%\n",
+                 reinterpret_cast<void*>(page.chunk->ChunkAddress()),
+                 ToString(page.chunk->owner_identity()), page.stats.buckets,
+                 page.stats.slots, density);
+  }
+}
+
 void Heap::RecordStats(HeapStats* stats, bool take_snapshot) {
   *stats->start_marker = HeapStats::kStartMarker;
   *stats->end_marker = HeapStats::kEndMarker;
@@ -5163,6 +5225,18 @@ void Heap::RecordStats(HeapStats* stats, bool take_snapshot) {
   // TODO(leszeks): Include the string table in both current and peak usage.
   *stats->malloced_memory = isolate_->allocator()->GetCurrentMemoryUsage();
   *stats->malloced_peak_memory = isolate_->allocator()->GetMaxMemoryUsage();
+  *stats->old_to_new_pages = 0;
+  *stats->old_to_new_buckets = 0;
+  *stats->old_to_new_slots = 0;
+  OldGenerationMemoryChunkIterator::ForAll(
+      this, [stats](MutablePageMetadata* chunk) {
+        SlotSet* slot_set = chunk->slot_set<OLD_TO_NEW>();
+        if (!slot_set) return;
+        SlotSet::Stats page_stats = slot_set->ComputeStats(chunk->buckets());
+        (*stats->old_to_new_pages)++;
+        *stats->old_to_new_buckets += page_stats.buckets;
+        *stats->old_to_new_slots += page_stats.slots;
+      });
   if (take_snapshot) {
     HeapObjectIterator iterator(this);
     for (Tagged<HeapObject> obj = iterator.Next(); !obj.is_null();
@@ -5856,6 +5930,7 @@ void Heap::SetUpSpaces(LinearAllocationArea& new_allocation_info,
   array_buffer_sweeper_.reset(new ArrayBufferSweeper(this));
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   if (v8_flags.memory_reducer) memory_reducer_.reset(new MemoryReducer(this));
+  bytecode_flushing_policy_.reset(new BytecodeFlushingPolicy(this));
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
     live_object_stats_.reset(new ObjectStats(this));
     dead_object_stats_.reset(new ObjectStats(this));
@@ -6201,6 +6276,7 @@ void Heap::TearDown() {
     memory_reducer_->TearDown();
     memory_reducer_.reset();
   }
+  bytecode_flushing_policy_.reset();
 
   live_object_stats_.reset();
   dead_object_stats_.reset();
@@ -6944,14 +7020,30 @@ size_t Heap::NumberOfTrackedHeapObjectTypes() {
 }
 
 size_t Heap::ObjectCountAtLastGC(size_t index) {
-  if (live_object_stats_ == nullptr || index >= ObjectStats::OBJECT_STATS_COUNT)
-    return 0;
+  if (live_object_stats_ == nullptr) {
+    // Without ObjectStats, instance types may still have been counted while
+    // marking.
+    if (!v8_flags.track_gc_instance_type_stats ||
+        index >= InstanceTypeStats::kNumberOfTypes) {
+      return 0;
+    }
+    return mark_compact_collector()->instance_type_stats_at_last_gc().count(
+        static_cast<int>(index));
+  }
+  if (index >= ObjectStats::OBJECT_STATS_COUNT) return 0;
   return live_object_stats_->object_count_last_gc(index);
 }
 
 size_t Heap::ObjectSizeAtLastGC(size_t index) {
-  if (live_object_stats_ == nullptr || index >= ObjectStats::OBJECT_STATS_COUNT)
-    return 0;
+  if (live_object_stats_ == nullptr) {
+    if (!v8_flags.track_gc_instance_type_stats ||
+        index >= InstanceTypeStats::kNumberOfTypes) {
+      return 0;
+    }
+    return mark_compact_collector()->instance_type_stats_at_last_gc().size(
+        static_cast<int>(index));
+  }
+  if (index >= ObjectStats::OBJECT_STATS_COUNT) return 0;
   return live_object_stats_->object_size_last_gc(index);
 }
 
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_HEAP_H_
 #define V8_HEAP_HEAP_H_
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <memory>
@@ -78,6 +79,7 @@ class TestMemoryAllocatorScope;
 class ArrayBufferCollector;
 class ArrayBufferSweeper;
 class BackingStore;
+class BytecodeFlushingPolicy;
 class MemoryChunkMetadata;
 class Boolean;
 class CodeLargeObjectSpace;
@@ -592,6 +594,16 @@ class Heap final {
       v8::MemoryPressureLevel level, bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // Sets the pressure signal reported by the embedder, see
+  // v8::Isolate::SetEnvironmentMemoryPressure().
+  void SetEnvironmentMemoryPressure(double pressure) {
+    environment_memory_pressure_.store(std::clamp(pressure, 0.0, 1.0),
+                                       std::memory_order_relaxed);
+  }
+  double environment_memory_pressure() const {
+    return environment_memory_pressure_.load(std::memory_order_relaxed);
+  }
+
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
   V8_EXPORT_PRIVATE void RemoveNearHeapLimitCallback(
@@ -1251,6 +1263,9 @@ class Heap final {
   // Returns the maximum amount of memory reserved for the heap.
   V8_EXPORT_PRIVATE size_t MaxReserved() const;
   size_t MaxSemiSpaceSize() { return max_semi_space_size_; }
+  std::optional<int> numa_node_preference() const {
+    return numa_node_preference_;
+  }
   size_t InitialSemiSpaceSize() { return initial_semispace_size_; }
   size_t MaxOldGenerationSize() { return max_old_generation_size(); }
 
@@ -1761,6 +1776,8 @@ class Heap final {
                                 const char* collector_reason);
 
   void PerformHeapVerification();
+  // Implements --trace-old-to-new-remembered-set-interval.
+  void MaybeTraceOldToNewRememberedSet();
   std::vector<Isolate*> PauseConcurrentThreadsInClients(
       GarbageCollector collector);
   void ResumeConcurrentThreadsInClients(std::vector<Isolate*> paused_clients);
@@ -1917,6 +1934,10 @@ class Heap final {
 
   MemoryReducer* memory_reducer() { return memory_reducer_.get(); }
 
+  BytecodeFlushingPolicy* bytecode_flushing_policy() {
+    return bytecode_flushing_policy_.get();
+  }
+
   // For some webpages RAIL mode does not switch from PERFORMANCE_LOAD.
   // This constant limits the effect of load RAIL mode on GC.
   // The value is arbitrary and chosen as the largest load time observed in
@@ -2092,6 +2113,7 @@ class Heap final {
   // constraints and flags.
   size_t code_range_size_ = 0;
   size_t max_semi_space_size_ = 0;
+  std::optional<int> numa_node_preference_;
   size_t initial_semispace_size_ = 0;
   // Full garbage collections can be skipped if the old generation size
   // is below this threshold.
@@ -2138,6 +2160,9 @@ class Heap final {
   // and reset by a mark-compact garbage collection.
   std::atomic<v8::MemoryPressureLevel> memory_pressure_level_;
 
+  // Pressure signal between 0 and 1 set by the embedder.
+  std::atomic<double> environment_memory_pressure_{0.0};
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
@@ -2276,6 +2301,7 @@ class Heap final {
   std::unique_ptr<ConcurrentMarking> concurrent_marking_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
+  std::unique_ptr<BytecodeFlushingPolicy> bytecode_flushing_policy_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
   std::unique_ptr<MinorGCJob> minor_gc_job_;
@@ -2523,7 +2549,10 @@ class HeapStats {
   int* os_error;                           // 24
   char* last_few_messages;                 // 25
   char* js_stacktrace;                     // 26
-  intptr_t* end_marker;                    // 27
+  size_t* old_to_new_pages;                // 27
+  size_t* old_to_new_buckets;              // 28
+  size_t* old_to_new_slots;                // 29
+  intptr_t* end_marker;                    // 30
 };
 
 // Disables GC for all allocations. It should not be used
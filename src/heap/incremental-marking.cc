@@ -6,6 +6,7 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
 #include <cmath>
 #include <optional>
 
@@ -62,16 +63,26 @@ static constexpr size_t kV8ActivationThreshold = 0;
 static constexpr size_t kEmbedderActivationThreshold = 0;
 #endif  // DEBUG
 
-base::TimeDelta GetMaxDuration(StepOrigin step_origin) {
+base::TimeDelta GetMaxDuration(StepOrigin step_origin,
+                               std::optional<base::TimeDelta> pause_budget) {
   if (v8_flags.predictable) {
     return base::TimeDelta::Max();
   }
+  base::TimeDelta max_duration;
   switch (step_origin) {
     case StepOrigin::kTask:
-      return kMaxStepSizeOnTask;
+      max_duration = kMaxStepSizeOnTask;
+      break;
     case StepOrigin::kV8:
-      return kMaxStepSizeOnAllocation;
+      max_duration = kMaxStepSizeOnAllocation;
+      break;
   }
+  // An embedder-provided pause budget caps the step. Work that doesn't fit is
+  // left on the shared worklist for concurrent marking.
+  if (pause_budget) {
+    max_duration = std::min(max_duration, *pause_budget);
+  }
+  return max_duration;
 }
 
 }  // namespace
@@ -770,8 +781,8 @@ size_t IncrementalMarking::GetScheduledBytes(StepOrigin step_origin) {
 
 void IncrementalMarking::AdvanceAndFinalizeIfComplete() {
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kTask);
-  Step(GetMaxDuration(StepOrigin::kTask), max_bytes_to_process,
-       StepOrigin::kTask);
+  Step(GetMaxDuration(StepOrigin::kTask, heap_->tracer()->pause_budget()),
+       max_bytes_to_process, StepOrigin::kTask);
   if (IsMajorMarkingComplete()) {
     heap()->FinalizeIncrementalMarkingAtomically(
         GarbageCollectionReason::kFinalizeMarkingViaTask);
@@ -814,7 +825,8 @@ void IncrementalMarking::AdvanceOnAllocation() {
   DCHECK(IsMajorMarking());
 
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kV8);
-  Step(GetMaxDuration(StepOrigin::kV8), max_bytes_to_process, StepOrigin::kV8);
+  Step(GetMaxDuration(StepOrigin::kV8, heap_->tracer()->pause_budget()),
+       max_bytes_to_process, StepOrigin::kV8);
 
   // Bail out when an AlwaysAllocateScope is active as the assumption is that
   // there's no GC being triggered. Check this condition at last position to
@@ -934,6 +946,14 @@ void IncrementalMarking::Step(v8::base::TimeDelta max_duration,
   heap_->tracer()->AddIncrementalMarkingStep(v8_time.InMillisecondsF(),
                                              v8_bytes_processed);
 
+  if (const auto pause_budget = heap_->tracer()->pause_budget()) {
+    const auto step_time = v8::base::TimeTicks::Now() - start;
+    if (step_time > *pause_budget) {
+      heap_->tracer()->RecordPauseBudgetExceeded("incremental marking step",
+                                                 step_time);
+    }
+  }
+
   if (V8_UNLIKELY(v8_flags.trace_incremental_marking)) {
     isolate()->PrintWithTimestamp(
         "[IncrementalMarking] Step: origin: %s, V8: %zuKB (%zuKB) in %.1f, "
@@ -0,0 +1,52 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_INSTANCE_TYPE_STATS_H_
+#define V8_HEAP_INSTANCE_TYPE_STATS_H_
+
+#include <array>
+
+#include "src/objects/instance-type.h"
+
+namespace v8 {
+namespace internal {
+
+// Count and size of the objects of each instance type that were found live
+// by a full GC. Unlike ObjectStats, these are maintained by the marking
+// visitors as they go (see --track-gc-instance-type-stats), so they don't
+// need a separate heap iteration. Objects that are allocated black are not
+// visited and hence not counted.
+class InstanceTypeStats final {
+ public:
+  static constexpr int kNumberOfTypes = LAST_TYPE + 1;
+
+  void Increment(InstanceType type, size_t size) {
+    counts_[type]++;
+    sizes_[type] += size;
+  }
+
+  void Merge(const InstanceTypeStats& other) {
+    for (int i = 0; i < kNumberOfTypes; i++) {
+      counts_[i] += other.counts_[i];
+      sizes_[i] += other.sizes_[i];
+    }
+  }
+
+  void Clear() {
+    counts_.fill(0);
+    sizes_.fill(0);
+  }
+
+  size_t count(int type) const { return counts_[type]; }
+  size_t size(int type) const { return sizes_[type]; }
+
+ private:
+  std::array<size_t, kNumberOfTypes> counts_{};
+  std::array<size_t, kNumberOfTypes> sizes_{};
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_INSTANCE_TYPE_STATS_H_
@@ -30,6 +30,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/base/basic-slot-set.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/concurrent-marking.h"
 #include "src/heap/ephemeron-remembered-set.h"
 #include "src/heap/evacuation-allocator-inl.h"
@@ -246,11 +247,11 @@ class MainMarkingVisitor final
                      unsigned mark_compact_epoch,
                      base::EnumSet<CodeFlushMode> code_flush_mode,
                      bool should_keep_ages_unchanged,
-                     uint16_t code_flushing_increase)
+                     uint16_t code_flushing_increase, uint16_t bytecode_old_age)
       : FullMarkingVisitorBase<MainMarkingVisitor>(
             local_marking_worklists, local_weak_objects, heap,
             mark_compact_epoch, code_flush_mode, should_keep_ages_unchanged,
-            code_flushing_increase) {}
+            code_flushing_increase, bytecode_old_age) {}
 
  private:
   // Functions required by MarkingVisitorBase.
@@ -383,8 +384,12 @@ void MarkCompactCollector::StartMarking() {
     }
   }
   heap_->tracer()->NotifyMarkingStart();
+  heap_->bytecode_flushing_policy()->NotifyStartMarking(
+      heap_->ShouldReduceMemory());
   code_flush_mode_ = Heap::GetCodeFlushMode(heap_->isolate());
   marking_worklists_.CreateContextWorklists(contexts);
+  // Drop counts from a marking cycle that didn't finish.
+  if (v8_flags.track_gc_instance_type_stats) instance_type_stats_.Clear();
   auto* cpp_heap = CppHeap::From(heap_->cpp_heap_);
   local_marking_worklists_ = std::make_unique<MarkingWorklists::Local>(
       &marking_worklists_,
@@ -394,7 +399,8 @@ void MarkCompactCollector::StartMarking() {
   marking_visitor_ = std::make_unique<MainMarkingVisitor>(
       local_marking_worklists_.get(), local_weak_objects_.get(), heap_, epoch(),
       code_flush_mode(), heap_->ShouldCurrentGCKeepAgesUnchanged(),
-      heap_->tracer()->CodeFlushingIncrease());
+      heap_->tracer()->CodeFlushingIncrease(),
+      heap_->bytecode_flushing_policy()->old_age());
   // This method evicts SFIs with flushed bytecode from the cache before
   // iterating the compilation cache as part of the root set. SFIs that get
   // flushed in this GC cycle will get evicted out of the cache in the next GC
@@ -743,6 +749,10 @@ void MarkCompactCollector::FinishConcurrentMarking() {
     heap_->concurrent_marking()->Join();
     heap_->concurrent_marking()->FlushMemoryChunkData();
     heap_->concurrent_marking()->FlushNativeContexts(&native_context_stats_);
+    if (v8_flags.track_gc_instance_type_stats) {
+      heap_->concurrent_marking()->FlushInstanceTypeStats(
+          &instance_type_stats_);
+    }
   }
   if (auto* cpp_heap = CppHeap::From(heap_->cpp_heap_)) {
     cpp_heap->FinishConcurrentMarkingIfNeeded();
@@ -854,6 +864,10 @@ void MarkCompactCollector::Finish() {
   local_marking_worklists_.reset();
   marking_worklists_.ReleaseContextWorklists();
   native_context_stats_.Clear();
+  if (v8_flags.track_gc_instance_type_stats) {
+    instance_type_stats_at_last_gc_ = instance_type_stats_;
+    instance_type_stats_.Clear();
+  }
 
   CHECK(weak_objects_.current_ephemerons.IsEmpty());
   CHECK(weak_objects_.discovered_ephemerons.IsEmpty());
@@ -2176,6 +2190,7 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
   size_t bytes_processed = 0;
   size_t objects_processed = 0;
   bool is_per_context_mode = local_marking_worklists_->IsPerContextMode();
+  const bool track_instance_type_stats = v8_flags.track_gc_instance_type_stats;
   Isolate* const isolate = heap_->isolate();
   const auto start = v8::base::TimeTicks::Now();
   PtrComprCageBase cage_base(isolate);
@@ -2214,6 +2229,9 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
       native_context_stats_.IncrementSize(local_marking_worklists_->Context(),
                                           map, object, visited_size);
     }
+    if (V8_UNLIKELY(track_instance_type_stats)) {
+      instance_type_stats_.Increment(map->instance_type(), visited_size);
+    }
     bytes_processed += visited_size;
     objects_processed++;
     static_assert(base::bits::IsPowerOfTwo(kDeadlineCheckInterval),
@@ -3300,6 +3318,7 @@ void MarkCompactCollector::ProcessOldCodeCandidates() {
 #endif
   }
 
+  heap_->bytecode_flushing_policy()->NotifyFlushed(number_of_flushed_sfis);
   if (v8_flags.trace_flush_code) {
     PrintIsolate(heap_->isolate(), "%d flushed SharedFunctionInfo(s)\n",
                  number_of_flushed_sfis);
@@ -9,6 +9,7 @@
 
 #include "include/v8-internal.h"
 #include "src/common/globals.h"
+#include "src/heap/instance-type-stats.h"
 #include "src/heap/marking-state.h"
 #include "src/heap/marking-visitor.h"
 #include "src/heap/marking-worklist.h"
@@ -169,6 +170,10 @@ class MarkCompactCollector final {
   WeakObjects* weak_objects() { return &weak_objects_; }
   WeakObjects::Local* local_weak_objects() { return local_weak_objects_.get(); }
 
+  const InstanceTypeStats& instance_type_stats_at_last_gc() const {
+    return instance_type_stats_at_last_gc_;
+  }
+
   void AddNewlyDiscovered(Tagged<HeapObject> object) {
     if (ephemeron_marking_.newly_discovered_overflowed) return;
 
@@ -416,6 +421,10 @@ class MarkCompactCollector final {
   std::unique_ptr<WeakObjects::Local> local_weak_objects_;
   NativeContextInferrer native_context_inferrer_;
   NativeContextStats native_context_stats_;
+  // Accumulated while marking with --track-gc-instance-type-stats and moved
+  // to instance_type_stats_at_last_gc_ when the GC finishes.
+  InstanceTypeStats instance_type_stats_;
+  InstanceTypeStats instance_type_stats_at_last_gc_;
 
   std::vector<GlobalHandleVector<DescriptorArray>> strong_descriptor_arrays_;
   base::Mutex strong_descriptor_arrays_mutex_;
@@ -450,7 +450,7 @@ bool MarkingVisitorBase<ConcreteVisitor>::IsOld(
     return isolate_in_background_ ||
            V8_UNLIKELY(sfi->age() == SharedFunctionInfo::kMaxAge);
   } else {
-    return sfi->age() >= v8_flags.bytecode_old_age;
+    return sfi->age() >= bytecode_old_age_;
   }
 }
 
@@ -480,10 +480,9 @@ void MarkingVisitorBase<ConcreteVisitor>::MakeOlder(
     // No need to increment age.
   } else {
     uint16_t age = sfi->age();
-    if (age < v8_flags.bytecode_old_age) {
+    if (age < bytecode_old_age_) {
       sfi->CompareExchangeAge(age, age + 1);
     }
-    DCHECK_LE(sfi->age(), v8_flags.bytecode_old_age);
   }
 }
 
@@ -53,7 +53,8 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
                      unsigned mark_compact_epoch,
                      base::EnumSet<CodeFlushMode> code_flush_mode,
                      bool should_keep_ages_unchanged,
-                     uint16_t code_flushing_increase)
+                     uint16_t code_flushing_increase,
+                     uint16_t bytecode_old_age)
       : ConcurrentHeapVisitor<int, ConcreteVisitor>(heap->isolate()),
         local_marking_worklists_(local_marking_worklists),
         local_weak_objects_(local_weak_objects),
@@ -62,6 +63,7 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
         code_flush_mode_(code_flush_mode),
         should_keep_ages_unchanged_(should_keep_ages_unchanged),
         code_flushing_increase_(code_flushing_increase),
+        bytecode_old_age_(bytecode_old_age),
         isolate_in_background_(heap->isolate()->is_backgrounded())
 #ifdef V8_COMPRESS_POINTERS
         ,
@@ -213,6 +215,7 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
   const base::EnumSet<CodeFlushMode> code_flush_mode_;
   const bool should_keep_ages_unchanged_;
   const uint16_t code_flushing_increase_;
+  const uint16_t bytecode_old_age_;
   const bool isolate_in_background_;
 #ifdef V8_COMPRESS_POINTERS
   ExternalPointerTable* const external_pointer_table_;
@@ -236,11 +239,12 @@ class FullMarkingVisitorBase : public MarkingVisitorBase<ConcreteVisitor> {
                          unsigned mark_compact_epoch,
                          base::EnumSet<CodeFlushMode> code_flush_mode,
                          bool should_keep_ages_unchanged,
-                         uint16_t code_flushing_increase)
+                         uint16_t code_flushing_increase,
+                         uint16_t bytecode_old_age)
       : MarkingVisitorBase<ConcreteVisitor>(
             local_marking_worklists, local_weak_objects, heap,
             mark_compact_epoch, code_flush_mode, should_keep_ages_unchanged,
-            code_flushing_increase),
+            code_flushing_increase, bytecode_old_age),
         marking_state_(heap->marking_state()) {}
 
   V8_INLINE void AddStrongReferenceForReferenceSummarizer(
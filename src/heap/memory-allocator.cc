@@ -8,6 +8,7 @@
 #include <optional>
 
 #include "src/base/address-region.h"
+#include "src/base/lazy-instance.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -67,6 +68,11 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
 }
 
 void MemoryAllocator::TearDown() {
+  if (ShouldReusePagesAcrossIsolates()) {
+    const size_t max_chunks =
+        v8_flags.max_reused_pages_pool_size * MB / PageMetadata::kPageSize;
+    process_wide_pool()->TakeChunksFrom(pool(), max_chunks);
+  }
   pool()->ReleasePooledChunks();
 
   // Check that spaces were torn down before MemoryAllocator.
@@ -96,6 +102,28 @@ void MemoryAllocator::Pool::ReleasePooledChunks() {
   }
 }
 
+void MemoryAllocator::Pool::TakeChunksFrom(Pool* other, size_t max_chunks) {
+  DCHECK_NE(this, other);
+  base::MutexGuard guard(&mutex_);
+  base::MutexGuard other_guard(&other->mutex_);
+  while (pooled_chunks_.size() < max_chunks &&
+         !other->pooled_chunks_.empty()) {
+    pooled_chunks_.push_back(other->pooled_chunks_.back());
+    other->pooled_chunks_.pop_back();
+  }
+}
+
+// static
+MemoryAllocator::Pool* MemoryAllocator::process_wide_pool() {
+  static base::LeakyObject<Pool> pool(nullptr);
+  return pool.get();
+}
+
+// static
+void MemoryAllocator::ReleaseProcessWidePooledChunks() {
+  process_wide_pool()->ReleasePooledChunks();
+}
+
 size_t MemoryAllocator::Pool::NumberOfCommittedChunks() const {
   base::MutexGuard guard(&mutex_);
   return pooled_chunks_.size();
@@ -163,6 +191,26 @@ Address MemoryAllocator::AllocateAlignedMemory(
 
   Address base = reservation.address();
 
+  if (std::optional<int> numa_node =
+          isolate_->heap()->numa_node_preference()) {
+    // This is only a hint. Must happen before the pages are touched, e.g. by
+    // zapping, since the policy only applies to pages that are faulted in
+    // later.
+    USE(page_allocator->SetPreferredNumaNode(reinterpret_cast<void*>(base),
+                                             chunk_size, *numa_node));
+  }
+
+  if (v8_flags.huge_pages_for_young_and_code &&
+      (space == NEW_SPACE || space == CODE_SPACE)) {
+    // Chunks are smaller than a huge page. Advising them individually still
+    // allows the kernel to merge adjacent chunks into huge pages.
+    huge_page_requested_size_ += chunk_size;
+    if (page_allocator->AdviseHugePages(reinterpret_cast<void*>(base),
+                                        chunk_size)) {
+      huge_page_advised_size_ += chunk_size;
+    }
+  }
+
   if (executable == EXECUTABLE) {
     ThreadIsolation::RegisterJitPage(base, chunk_size);
   }
@@ -516,7 +564,16 @@ LargePageMetadata* MemoryAllocator::AllocateLargePage(
 std::optional<MemoryAllocator::MemoryChunkAllocationResult>
 MemoryAllocator::AllocateUninitializedPageFromPool(Space* space) {
   MemoryChunkMetadata* chunk_metadata = pool()->TryGetPooled();
+  if (chunk_metadata == nullptr && ShouldReusePagesAcrossIsolates()) {
+    // Fall back to pages that were left behind by torn down isolates. These
+    // are metadata objects of the same shape as locally pooled ones, they only
+    // still point to the heap of the previous owner, which gets overwritten
+    // when the page is initialized.
+    chunk_metadata = process_wide_pool()->TryGetPooled();
+  }
   if (chunk_metadata == nullptr) return {};
+  DCHECK_EQ(chunk_metadata->reserved_memory()->page_allocator(),
+            data_page_allocator());
   const int size = MutablePageMetadata::kPageSize;
   const Address start = chunk_metadata->ChunkAddress();
   const Address area_start =
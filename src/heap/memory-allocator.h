@@ -20,6 +20,7 @@
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/semaphore.h"
 #include "src/common/globals.h"
+#include "src/flags/flags.h"
 #include "src/heap/code-range.h"
 #include "src/heap/memory-chunk-metadata.h"
 #include "src/heap/mutable-page-metadata.h"
@@ -74,6 +75,10 @@ class MemoryAllocator {
 
     void ReleasePooledChunks();
 
+    // Moves chunks from |other| into this pool until this pool holds
+    // |max_chunks| chunks. Chunks that do not fit remain in |other|.
+    void TakeChunksFrom(Pool* other, size_t max_chunks);
+
     size_t NumberOfCommittedChunks() const;
     size_t CommittedBufferedMemory() const;
 
@@ -109,6 +114,23 @@ class MemoryAllocator {
   // Initialize page sizes field in V8::Initialize.
   static void InitializeOncePerProcess();
 
+  // Frees the pages that torn down isolates left in the process-wide pool (see
+  // --reuse_pages_across_isolates). Must only be called when no isolate is
+  // alive anymore.
+  V8_EXPORT_PRIVATE static void ReleaseProcessWidePooledChunks();
+
+  // Returns whether pooled pages outlive this allocator and can be handed to
+  // other isolates. This requires all isolates to allocate from the same page
+  // allocator, which is not the case with multiple pointer compression cages.
+  static bool ShouldReusePagesAcrossIsolates() {
+    return v8_flags.reuse_pages_across_isolates &&
+           !COMPRESS_POINTERS_IN_MULTIPLE_CAGES_BOOL;
+  }
+
+  // Pool that is shared by all isolates of the process and filled when an
+  // isolate is torn down.
+  V8_EXPORT_PRIVATE static Pool* process_wide_pool();
+
   V8_INLINE static intptr_t GetCommitPageSize() {
     DCHECK_LT(0, commit_page_size_);
     return commit_page_size_;
@@ -158,6 +180,16 @@ class MemoryAllocator {
   // Returns allocated executable spaces in bytes.
   size_t SizeExecutable() const { return size_executable_; }
 
+  // Returns the percentage of young generation and code chunks reserved so far
+  // that were successfully advised to use huge pages (see
+  // --huge_pages_for_young_and_code). A successful advice does not mean that
+  // the kernel actually backs the memory with huge pages.
+  double HugePageAdvisedPercentage() const {
+    const size_t requested = huge_page_requested_size_;
+    if (requested == 0) return 0.0;
+    return 100.0 * huge_page_advised_size_ / requested;
+  }
+
   // Returns the maximum available bytes of heaps.
   size_t Available() const {
     const size_t size = Size();
@@ -419,6 +451,11 @@ class MemoryAllocator {
   // Allocated executable space size in bytes.
   std::atomic<size_t> size_executable_ = 0;
 
+  // Reserved size in bytes of chunks for which huge pages were requested and
+  // for which the request was accepted.
+  std::atomic<size_t> huge_page_requested_size_ = 0;
+  std::atomic<size_t> huge_page_advised_size_ = 0;
+
   // We keep the lowest and highest addresses allocated as a quick way
   // of determining that pointers are outside the heap. The estimate is
   // conservative, i.e. not all addresses in 'allocated' space are allocated
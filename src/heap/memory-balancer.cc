@@ -4,12 +4,34 @@
 
 #include "src/heap/memory-balancer.h"
 
+#include <algorithm>
+#include <cstdio>
+
+#include "src/base/platform/platform.h"
+#include "src/base/platform/wrappers.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Reads the "some avg10" value of a file in pressure stall information format
+// (e.g. /proc/pressure/memory or a cgroup's memory.pressure), i.e. the share
+// of the last 10 seconds in which at least one task stalled on memory.
+std::optional<double> ReadPressureStallInformation(const char* path) {
+  FILE* file = base::OS::FOpen(path, "r");
+  if (file == nullptr) return {};
+  double avg10;
+  const int matched = fscanf(file, "some avg10=%lf", &avg10);
+  base::Fclose(file);
+  if (matched != 1) return {};
+  return std::clamp(avg10 / 100.0, 0.0, 1.0);
+}
+
+}  // namespace
+
 MemoryBalancer::MemoryBalancer(Heap* heap, base::TimeTicks startup_time)
     : heap_(heap), last_measured_at_(startup_time) {}
 
@@ -38,18 +60,28 @@ void MemoryBalancer::RefreshLimit() {
   constexpr size_t kMinHeapExtraSpace = 2 * MB;
   const size_t minimum_limit = live_memory_after_gc_ + kMinHeapExtraSpace;
 
-  size_t new_limit = std::max<size_t>(minimum_limit, computed_limit);
+  // Under environment memory pressure only grant a share of the computed
+  // headroom, so that the heap shrinks before the environment runs out of
+  // memory instead of relying on last resort GCs close to OOM.
+  const double pressure = EnvironmentMemoryPressure();
+  const size_t pressure_adjusted_limit =
+      live_memory_after_gc_ +
+      static_cast<size_t>((computed_limit - live_memory_after_gc_) *
+                          (1.0 - pressure));
+
+  size_t new_limit = std::max<size_t>(minimum_limit, pressure_adjusted_limit);
   new_limit = std::min<size_t>(new_limit, heap_->max_old_generation_size());
   new_limit = std::max<size_t>(new_limit, heap_->min_old_generation_size());
 
   if (v8_flags.trace_memory_balancer) {
     heap_->isolate()->PrintWithTimestamp(
         "MemoryBalancer: allocation-rate=%.1lfKB/ms gc-speed=%.1lfKB/ms "
-        "minium-limit=%.1lfM computed-limit=%.1lfM new-limit=%.1lfM\n",
+        "minium-limit=%.1lfM computed-limit=%.1lfM pressure=%.2lf "
+        "new-limit=%.1lfM\n",
         major_allocation_rate_.value().rate() / KB,
         major_gc_speed_.value().rate() / KB,
         static_cast<double>(minimum_limit) / MB,
-        static_cast<double>(computed_limit) / MB,
+        static_cast<double>(computed_limit) / MB, pressure,
         static_cast<double>(new_limit) / MB);
   }
 
@@ -57,6 +89,20 @@ void MemoryBalancer::RefreshLimit() {
       new_limit, new_limit + embedder_allocation_limit_);
 }
 
+double MemoryBalancer::EnvironmentMemoryPressure() const {
+  return std::max(heap_->environment_memory_pressure(),
+                  sampled_pressure_stall_);
+}
+
+void MemoryBalancer::SamplePressureStallInformation() {
+  if (!v8_flags.memory_balancer_pressure_file) return;
+  // Keep the previous sample if the file can't be read.
+  if (std::optional<double> psi = ReadPressureStallInformation(
+          v8_flags.memory_balancer_pressure_file)) {
+    sampled_pressure_stall_ = *psi;
+  }
+}
+
 void MemoryBalancer::UpdateGCSpeed(size_t major_gc_bytes,
                                    base::TimeDelta major_gc_duration) {
   if (!major_gc_speed_) {
@@ -92,6 +138,7 @@ void MemoryBalancer::HeartbeatUpdate() {
 
   last_measured_memory_ = memory;
   last_measured_at_ = time;
+  SamplePressureStallInformation();
   RefreshLimit();
   PostHeartbeatTask();
 }
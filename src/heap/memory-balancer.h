@@ -55,6 +55,13 @@ class MemoryBalancer {
 
   void RefreshLimit();
   void PostHeartbeatTask();
+  // Returns the memory pressure of the environment between 0 and 1, taking
+  // both the embedder's signal and the last sample of
+  // --memory-balancer-pressure-file into account.
+  double EnvironmentMemoryPressure() const;
+  // Reads --memory-balancer-pressure-file. This does file I/O, so it only runs
+  // from the heartbeat task and never on the GC path.
+  void SamplePressureStallInformation();
 
   Heap* heap_;
 
@@ -82,6 +89,10 @@ class MemoryBalancer {
   size_t last_measured_memory_ = 0;
   base::TimeTicks last_measured_at_;
   bool heartbeat_task_started_ = false;
+
+  // Share of time the environment stalled on memory, as last sampled by the
+  // heartbeat task.
+  double sampled_pressure_stall_ = 0.0;
 };
 
 class HeartbeatTask : public CancelableTask {
@@ -540,6 +540,8 @@ void MinorMarkSweepCollector::ClearNonLiveReferences() {
              GCTracer::Scope::MINOR_MS_CLEAR_WEAK_GLOBAL_HANDLES);
     isolate->global_handles()->ProcessWeakYoungObjects(
         nullptr, &IsUnmarkedObjectInYoungGeneration);
+    TRACE_GC(heap_->tracer(),
+             GCTracer::Scope::MINOR_MS_CLEAR_WEAK_TRACED_HANDLES);
     if (auto* cpp_heap = CppHeap::From(heap_->cpp_heap_);
         cpp_heap && cpp_heap->generational_gc_supported()) {
       isolate->traced_handles()->ResetYoungDeadNodes(
@@ -655,7 +657,11 @@ void MinorMarkSweepCollector::MarkRoots(
   // Seed the root set.
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MINOR_MS_MARK_SEED);
-    isolate->traced_handles()->ComputeWeaknessForYoungObjects();
+    {
+      TRACE_GC(heap_->tracer(),
+               GCTracer::Scope::MINOR_MS_MARK_SEED_TRACED_HANDLES);
+      isolate->traced_handles()->ComputeWeaknessForYoungObjects();
+    }
     // MinorMS treats all weak roots except for global handles as strong.
     // That is why we don't set skip_weak = true here and instead visit
     // global handles separately.
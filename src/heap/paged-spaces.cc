@@ -90,11 +90,18 @@ PageMetadata* PagedSpaceBase::InitializePage(
 }
 
 void PagedSpaceBase::TearDown() {
+  // When pages are reused across isolates, hand the pages of spaces that
+  // allocate from the pool back to it wholesale instead of unmapping them. The
+  // memory allocator moves them to the process-wide pool on tear down.
+  const MemoryAllocator::FreeMode free_mode =
+      MemoryAllocator::ShouldReusePagesAcrossIsolates() &&
+              (identity() == NEW_SPACE || identity() == OLD_SPACE)
+          ? MemoryAllocator::FreeMode::kPool
+          : MemoryAllocator::FreeMode::kImmediately;
   while (!memory_chunk_list_.Empty()) {
     MutablePageMetadata* chunk = memory_chunk_list_.front();
     memory_chunk_list_.Remove(chunk);
-    heap()->memory_allocator()->Free(MemoryAllocator::FreeMode::kImmediately,
-                                     chunk);
+    heap()->memory_allocator()->Free(free_mode, chunk);
   }
   accounting_stats_.Clear();
 }
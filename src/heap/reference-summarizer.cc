@@ -96,7 +96,8 @@ class ReferenceSummarizerMarkingVisitor
                            marking_state->local_weak_objects(), heap,
                            0 /*mark_compact_epoch*/, {} /*code_flush_mode*/,
                            true /*should_keep_ages_unchanged*/,
-                           0 /*code_flushing_increase*/),
+                           0 /*code_flushing_increase*/,
+                           v8_flags.bytecode_old_age /*bytecode_old_age*/),
         marking_state_(marking_state) {}
 
   template <typename TSlot>
@@ -16,6 +16,7 @@
 #include "src/init/heap-symbols.h"
 #include "src/init/setup-isolate.h"
 #include "src/interpreter/interpreter.h"
+#include "src/json/json-parser.h"
 #include "src/objects/arguments.h"
 #include "src/objects/call-site-info.h"
 #include "src/objects/cell-inl.h"
@@ -1325,6 +1326,11 @@ void Heap::CreateInitialMutableObjects() {
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
 
+  // Allocate cache for JSON object shapes.
+  set_json_shape_cache(*factory->NewWeakFixedArray(
+      JsonShapeCache::kJsonShapeCacheSize * JsonShapeCache::kEntrySize,
+      AllocationType::kOld));
+
   // Allocate FeedbackCell for builtins.
   DirectHandle<FeedbackCell> many_closures_cell =
       factory->NewManyClosuresCell();
@@ -172,7 +172,10 @@ class Sweeper::MajorSweeperJob final : public JobTask {
 
 class Sweeper::MinorSweeperJob final : public JobTask {
  public:
-  static constexpr int kMaxTasks = 1;
+  // New space pages and promoted pages are handed out one at a time from the
+  // shared sweeping lists, so any number of tasks can steal work from each
+  // other.
+  static constexpr int kMaxTasks = 8;
 
   MinorSweeperJob(Isolate* isolate, Sweeper* sweeper)
       : sweeper_(sweeper),
@@ -194,8 +197,12 @@ class Sweeper::MinorSweeperJob final : public JobTask {
 
   size_t GetMaxConcurrency(size_t worker_count) const override {
     static constexpr int kPagePerTask = 2;
+    const size_t max_tasks =
+        v8_flags.parallel_minor_ms_sweeping
+            ? concurrent_sweepers.size()
+            : std::min<size_t>(1, concurrent_sweepers.size());
     return std::min<size_t>(
-        concurrent_sweepers.size(),
+        max_tasks,
         worker_count +
             (sweeper_->ConcurrentMinorSweepingPageCount() + kPagePerTask - 1) /
                 kPagePerTask);
@@ -216,8 +223,15 @@ class Sweeper::MinorSweeperJob final : public JobTask {
     PtrComprCageAccessScope ptr_compr_cage_access_scope(
         sweeper_->heap_->isolate());
 
-    if (!concurrent_sweeper.ConcurrentSweepSpace(delegate)) return;
-    concurrent_sweeper.ConcurrentSweepPromotedPages(delegate);
+    // Odd tasks start with promoted pages so that both lists are drained in
+    // parallel rather than all tasks contending on the new space list first.
+    if (offset % 2 == 0) {
+      if (!concurrent_sweeper.ConcurrentSweepSpace(delegate)) return;
+      concurrent_sweeper.ConcurrentSweepPromotedPages(delegate);
+    } else {
+      if (!concurrent_sweeper.ConcurrentSweepPromotedPages(delegate)) return;
+      concurrent_sweeper.ConcurrentSweepSpace(delegate);
+    }
   }
 
   Sweeper* const sweeper_;
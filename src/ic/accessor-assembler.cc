@@ -26,6 +26,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/property-details.h"
 #include "src/objects/smi.h"
+#include "src/objects/transitions.h"
 
 namespace v8 {
 namespace internal {
@@ -5223,7 +5224,40 @@ void AccessorAssembler::GenerateCloneObjectIC() {
                    TaggedEqual(strong_feedback, MegamorphicSymbolConstant())));
       GotoIfNot(TaggedEqual(strong_feedback, MegamorphicSymbolConstant()),
                 &miss);
-      Goto(&slow);
+
+      // Megamorphic sites still share the per-source-map clone target cached
+      // as a side-step transition by the miss handler. If there is one we can
+      // use the fast clone, otherwise fall back to the generic slow path.
+      GotoIf(TaggedIsSmi(source), &slow);
+      GotoIfNot(IsJSObjectMap(source_map), &slow);
+      GotoIfNot(SmiEqual(SmiAnd(flags, SmiConstant(
+                                           ObjectLiteral::kHasNullPrototype)),
+                         SmiConstant(Smi::zero())),
+                &slow);
+      // Only use targets created for the current native context.
+      TNode<NativeContext> native_context = LoadNativeContext(context);
+      GotoIfNot(
+          TaggedEqual(LoadMap(source_map),
+                      LoadMap(LoadObjectFunctionInitialMap(native_context))),
+          &slow);
+      TNode<MaybeObject> maybe_transitions = LoadMaybeWeakObjectField(
+          source_map, Map::kTransitionsOrPrototypeInfoOffset);
+      TNode<HeapObject> transitions_object =
+          GetHeapObjectIfStrong(maybe_transitions, &slow);
+      GotoIfNot(IsTransitionArrayMap(LoadMap(transitions_object)), &slow);
+      TNode<Object> side_step_transitions = CAST(LoadWeakFixedArrayElement(
+          CAST(transitions_object),
+          IntPtrConstant(TransitionArray::kSideStepTransitionsIndex)));
+      GotoIf(TaggedIsSmi(side_step_transitions), &slow);
+      TNode<MaybeObject> maybe_target_map = LoadWeakFixedArrayElement(
+          CAST(side_step_transitions),
+          IntPtrConstant(SideStepTransition::index_of(
+              SideStepTransition::Kind::kCloneObject)));
+      // Empty and Unreachable entries are Smis.
+      GotoIf(TaggedIsSmi(maybe_target_map), &slow);
+      result_map = CAST(GetHeapObjectAssumeWeak(maybe_target_map, &slow));
+      GotoIf(IsDeprecatedMap(result_map.value()), &slow);
+      Goto(&if_result_map);
     }
 
     BIND(&if_handler);
@@ -4,6 +4,9 @@
 
 #include "src/ic/ic-stats.h"
 
+#include <algorithm>
+
+#include "src/flags/flags.h"
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/objects/objects-inl.h"
@@ -54,6 +57,36 @@ void ICStats::Dump() {
   Reset();
 }
 
+bool ICTransitionSampler::ShouldSample() {
+  DCHECK_GT(v8_flags.ic_transition_sampling_interval, 0);
+  if (transitions_until_sample_ > 0) {
+    --transitions_until_sample_;
+    return false;
+  }
+  transitions_until_sample_ = v8_flags.ic_transition_sampling_interval - 1;
+  return true;
+}
+
+void ICTransitionSampler::Record(const v8::ICTransitionSample& sample) {
+  samples_[(start_ + size_) % kCapacity] = sample;
+  if (size_ < kCapacity) {
+    ++size_;
+  } else {
+    start_ = (start_ + 1) % kCapacity;
+  }
+}
+
+size_t ICTransitionSampler::Take(
+    v8::MemorySpan<v8::ICTransitionSample> samples) {
+  size_t count = std::min(size_, samples.size());
+  for (size_t i = 0; i < count; ++i) {
+    samples[i] = samples_[(start_ + i) % kCapacity];
+  }
+  start_ = (start_ + count) % kCapacity;
+  size_ -= count;
+  return count;
+}
+
 const char* ICStats::GetOrCacheScriptName(Tagged<Script> script) {
   Address script_ptr = script.ptr();
   if (script_name_map_.find(script_ptr) != script_name_map_.end()) {
@@ -5,12 +5,14 @@
 #ifndef V8_IC_IC_STATS_H_
 #define V8_IC_IC_STATS_H_
 
+#include <array>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "include/v8-internal.h"  // For Address.
+#include "include/v8-statistics.h"
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
 #include "src/sandbox/isolate.h"
@@ -79,6 +81,29 @@ class ICStats {
   int pos_;
 };
 
+// Records every --ic-transition-sampling-interval'th interesting IC
+// transition of an isolate into a fixed-size ring buffer, overwriting the
+// oldest samples when full. Unlike ICStats this is cheap enough to leave
+// enabled in production. ICs only miss on the thread owning the isolate, so
+// the buffer needs no synchronization.
+class ICTransitionSampler {
+ public:
+  static constexpr size_t kCapacity = 1024;
+
+  // Returns true if the next interesting transition should be recorded.
+  bool ShouldSample();
+  void Record(const v8::ICTransitionSample& sample);
+  // Moves up to |samples.size()| samples, oldest first, into |samples|.
+  size_t Take(v8::MemorySpan<v8::ICTransitionSample> samples);
+
+ private:
+  std::array<v8::ICTransitionSample, kCapacity> samples_;
+  // The index of the oldest sample and the number of samples.
+  size_t start_ = 0;
+  size_t size_ = 0;
+  int transitions_until_sample_ = 0;
+};
+
 }  // namespace internal
 }  // namespace v8
 
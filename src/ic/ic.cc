@@ -18,6 +18,7 @@
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/isolate.h"
+#include "src/execution/messages.h"
 #include "src/execution/protectors-inl.h"
 #include "src/execution/tiering-manager.h"
 #include "src/handles/handles-inl.h"
@@ -115,7 +116,10 @@ const char* GetModifier(KeyedAccessStoreMode mode) {
 }  // namespace
 
 void IC::TraceIC(const char* type, DirectHandle<Object> name) {
-  if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled())) return;
+  if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled() &&
+                v8_flags.ic_transition_sampling_interval == 0)) {
+    return;
+  }
   State new_state =
       (state() == NO_FEEDBACK) ? NO_FEEDBACK : nexus()->ic_state();
   TraceIC(type, name, state(), new_state);
@@ -123,6 +127,9 @@ void IC::TraceIC(const char* type, DirectHandle<Object> name) {
 
 void IC::TraceIC(const char* type, DirectHandle<Object> name, State old_state,
                  State new_state) {
+  if (V8_UNLIKELY(v8_flags.ic_transition_sampling_interval > 0)) {
+    SampleICTransition(type, old_state, new_state);
+  }
   if (V8_LIKELY(!TracingFlags::is_ic_stats_enabled())) return;
 
   Handle<Map> map = lookup_start_object_map();  // Might be empty.
@@ -197,6 +204,37 @@ void IC::TraceIC(const char* type, DirectHandle<Object> name, State old_state,
   ICStats::instance()->End();
 }
 
+void IC::SampleICTransition(const char* type, State old_state,
+                            State new_state) {
+  Handle<Map> map = lookup_start_object_map();  // Might be empty.
+  bool is_deprecated_map = !map.is_null() && map->is_deprecated();
+  bool is_degrading = new_state != old_state &&
+                      (new_state == POLYMORPHIC || new_state == MEGAMORPHIC ||
+                       new_state == MEGADOM || new_state == GENERIC);
+  if (!is_degrading && !is_deprecated_map) return;
+  ICTransitionSampler* sampler = isolate()->ic_transition_sampler();
+  if (!sampler->ShouldSample()) return;
+
+  v8::ICTransitionSample sample;
+  sample.ic_type = type;
+  sample.is_keyed = is_keyed() && !IsStoreInArrayLiteralIC();
+  sample.old_state = TransitionMarkFromState(old_state);
+  sample.new_state = TransitionMarkFromState(new_state);
+  sample.is_deprecated_map = is_deprecated_map;
+  sample.script_id = -1;
+  sample.position = -1;
+  sample.function_position = -1;
+  MessageLocation location;
+  if (isolate()->ComputeLocation(&location)) {
+    sample.script_id = location.script()->id();
+    sample.position = location.start_pos();
+    if (!location.shared().is_null()) {
+      sample.function_position = location.shared()->StartPosition();
+    }
+  }
+  sampler->Record(sample);
+}
+
 IC::IC(Isolate* isolate, Handle<FeedbackVector> vector, FeedbackSlot slot,
        FeedbackSlotKind kind)
     : isolate_(isolate),
@@ -97,6 +97,7 @@ class IC {
   void TraceIC(const char* type, DirectHandle<Object> name);
   void TraceIC(const char* type, DirectHandle<Object> name, State old_state,
                State new_state);
+  void SampleICTransition(const char* type, State old_state, State new_state);
 
   MaybeHandle<Object> TypeError(MessageTemplate, Handle<Object> object,
                                 Handle<Object> key);
@@ -85,9 +85,20 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // The table sizes are fixed at build time (see the
+  // v8_stub_cache_primary_table_bits and v8_stub_cache_secondary_table_bits gn
+  // args), so that the IC builtins can embed the offset masks.
+#ifdef V8_STUB_CACHE_PRIMARY_TABLE_BITS
+  static const int kPrimaryTableBits = V8_STUB_CACHE_PRIMARY_TABLE_BITS;
+#else
   static const int kPrimaryTableBits = 11;
+#endif
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
+#ifdef V8_STUB_CACHE_SECONDARY_TABLE_BITS
+  static const int kSecondaryTableBits = V8_STUB_CACHE_SECONDARY_TABLE_BITS;
+#else
   static const int kSecondaryTableBits = 9;
+#endif
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
   static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
@@ -4842,14 +4842,21 @@ void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
         isolate_, finalization_registry_prototype, "unregister",
         Builtin::kFinalizationRegistryUnregister, 1, kDontAdapt);
 
-    // The cleanupSome function is created but not exposed, as it is used
-    // internally by InvokeFinalizationRegistryCleanupFromTask.
+    // The cleanupSome function is created but not exposed.
     //
     // It is exposed by v8_flags.harmony_weak_refs_with_cleanup_some.
     DirectHandle<JSFunction> cleanup_some_fun = SimpleCreateFunction(
         isolate_, factory->InternalizeUtf8String("cleanupSome"),
         Builtin::kFinalizationRegistryPrototypeCleanupSome, 0, kDontAdapt);
     native_context()->set_finalization_registry_cleanup_some(*cleanup_some_fun);
+
+    // Used by InvokeFinalizationRegistryCleanupFromTask to run a bounded
+    // number of cleanup callbacks per task. Never exposed.
+    DirectHandle<JSFunction> cleanup_from_task_fun = SimpleCreateFunction(
+        isolate_, factory->empty_string(),
+        Builtin::kFinalizationRegistryCleanupFromTask, 2, kDontAdapt);
+    native_context()->set_finalization_registry_cleanup_from_task(
+        *cleanup_from_task_fun);
   }
 
   {  // -- W e a k R e f
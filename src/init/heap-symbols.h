@@ -606,12 +606,14 @@
   F(MINOR_MS_CLEAR_STRING_FORWARDING_TABLE) \
   F(MINOR_MS_CLEAR_STRING_TABLE)            \
   F(MINOR_MS_CLEAR_WEAK_GLOBAL_HANDLES)     \
+  F(MINOR_MS_CLEAR_WEAK_TRACED_HANDLES)     \
   F(MINOR_MS_COMPLETE_SWEEP_ARRAY_BUFFERS)  \
   F(MINOR_MS_COMPLETE_SWEEPING)             \
   F(MINOR_MS_MARK_FINISH_INCREMENTAL)       \
   F(MINOR_MS_MARK_PARALLEL)                 \
   F(MINOR_MS_MARK_INCREMENTAL_SEED)         \
   F(MINOR_MS_MARK_SEED)                     \
+  F(MINOR_MS_MARK_SEED_TRACED_HANDLES)      \
   F(MINOR_MS_MARK_TRACED_HANDLES)           \
   F(MINOR_MS_MARK_CONSERVATIVE_STACK)       \
   F(MINOR_MS_MARK_CLOSURE_PARALLEL)         \
@@ -634,6 +636,7 @@
   F(SCAVENGER_SCAVENGE)                              \
   F(SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_IDENTIFY) \
   F(SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_PROCESS)  \
+  F(SCAVENGER_SCAVENGE_WEAK_TRACED_HANDLES_PROCESS)  \
   F(SCAVENGER_SCAVENGE_PARALLEL)                     \
   F(SCAVENGER_SCAVENGE_PARALLEL_PHASE)               \
   F(SCAVENGER_SCAVENGE_ROOTS)                        \
@@ -21,6 +21,7 @@
 #include "src/execution/isolate.h"
 #include "src/execution/simulator.h"
 #include "src/flags/flags.h"
+#include "src/heap/memory-allocator.h"
 #include "src/init/bootstrapper.h"
 #include "src/libsampler/sampler.h"
 #include "src/objects/elements.h"
@@ -264,6 +265,7 @@ void V8::Dispose() {
   CallDescriptors::TearDown();
   ElementsAccessor::TearDown();
   RegisteredExtension::UnregisterAll();
+  MemoryAllocator::ReleaseProcessWidePooledChunks();
   FlagList::ReleaseDynamicAllocations();
   AdvanceStartupState(V8StartupState::kV8Disposed);
 }
@@ -404,11 +404,9 @@ Response V8HeapProfilerAgentImpl::takeHeapSnapshotNow(
           ? v8::HeapProfiler::NumericsMode::kExposeNumericValues
           : v8::HeapProfiler::NumericsMode::kHideNumericValues;
   options.stack_state = stackState;
-  const v8::HeapSnapshot* snapshot = profiler->TakeHeapSnapshot(options);
-  if (!snapshot) return Response::ServerError("Failed to take heap snapshot");
   HeapSnapshotOutputStream stream(&m_frontend);
-  snapshot->Serialize(&stream);
-  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+  if (!profiler->TakeHeapSnapshotToStream(&stream, options))
+    return Response::ServerError("Failed to take heap snapshot");
   return Response::Success();
 }
 
@@ -271,20 +271,34 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaTheHole:
       case Bytecode::kLdaConstant:
       case Bytecode::kLdaUndefined:
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
       case Bytecode::kLdaGlobal:
       case Bytecode::kGetNamedProperty:
+      case Bytecode::kGetNamedPropertyFromSuper:
       case Bytecode::kGetKeyedProperty:
       case Bytecode::kLdaContextSlot:
       case Bytecode::kLdaImmutableContextSlot:
       case Bytecode::kLdaCurrentContextSlot:
       case Bytecode::kLdaImmutableCurrentContextSlot:
+      case Bytecode::kLdaModuleVariable:
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
+      case Bytecode::kDiv:
+      case Bytecode::kMod:
+      case Bytecode::kBitwiseOr:
+      case Bytecode::kBitwiseAnd:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
+      case Bytecode::kMulSmi:
+      case Bytecode::kBitwiseOrSmi:
+      case Bytecode::kBitwiseAndSmi:
+      case Bytecode::kShiftLeftSmi:
+      case Bytecode::kShiftRightSmi:
       case Bytecode::kInc:
       case Bytecode::kDec:
+      case Bytecode::kNegate:
       case Bytecode::kTypeOf:
       case Bytecode::kCallAnyReceiver:
       case Bytecode::kCallProperty:
@@ -297,8 +311,12 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kCallUndefinedReceiver2:
       case Bytecode::kConstruct:
       case Bytecode::kConstructWithSpread:
+      case Bytecode::kCallRuntime:
+      case Bytecode::kCreateClosure:
       case Bytecode::kCreateObjectLiteral:
+      case Bytecode::kCreateEmptyObjectLiteral:
       case Bytecode::kCreateArrayLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
       case Bytecode::kThrowReferenceErrorIfHole:
       case Bytecode::kGetTemplateObject:
         return true;
@@ -6,6 +6,9 @@
 
 #include <optional>
 
+#include "src/base/bits.h"
+#include "src/base/functional.h"
+#include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
 #include "src/common/assert-scope.h"
@@ -28,11 +31,72 @@
 #include "src/strings/string-hasher.h"
 #include "src/utils/boxed-float.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available).
+#define NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
 namespace {
 
+// Returns the first character in [start, end) that may terminate a JSON
+// string, i.e. '"', '\\' or a control character, scanning 16 characters at a
+// time. Returns a pointer into the last incomplete block (or `end`) if no such
+// character is found in the complete blocks; the caller finishes the scan.
+const uint8_t* SkipToJsonStringTerminatorCandidate(const uint8_t* start,
+                                                    const uint8_t* end) {
+  constexpr size_t kBlockSize = 16;
+  const uint8_t* cursor = start;
+#if defined(__SSE2__)
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+  for (; static_cast<size_t>(end - cursor) >= kBlockSize;
+       cursor += kBlockSize) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    // Unsigned c <= 0x1F iff max(c, 0x1F) == 0x1F.
+    __m128i is_control =
+        _mm_cmpeq_epi8(_mm_max_epu8(chars, max_control), max_control);
+    __m128i matches =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                                  _mm_cmpeq_epi8(chars, backslash)),
+                     is_control);
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros(mask);
+    }
+  }
+#elif defined(NEON64)
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t min_non_control = vdupq_n_u8(0x20);
+  for (; static_cast<size_t>(end - cursor) >= kBlockSize;
+       cursor += kBlockSize) {
+    uint8x16_t chars = vld1q_u8(cursor);
+    uint8x16_t matches =
+        vorrq_u8(vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+                 vcltq_u8(chars, min_non_control));
+    if (vmaxvq_u8(matches) != 0) {
+      // Narrow each byte of the mask to 4 bits to find the first match.
+      uint64_t mask = vget_lane_u64(
+          vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)),
+          0);
+      return cursor + (base::bits::CountTrailingZeros(mask) >> 2);
+    }
+  }
+#endif
+  USE(end);
+  return cursor;
+}
+
 constexpr JsonToken GetOneCharJsonToken(uint8_t c) {
   // clang-format off
   return
@@ -297,6 +361,95 @@ bool JsonParseInternalizer::RecurseAndApply(Handle<JSReceiver> holder,
   return true;
 }
 
+// static
+bool JsonShapeCache::IsCacheableMap(Isolate* isolate, Tagged<Map> map,
+                                    Tagged<NativeContext> native_context) {
+  return map->instance_type() == JS_OBJECT_TYPE &&
+         !map->is_dictionary_map() && !map->is_deprecated() &&
+         map->NumberOfOwnDescriptors() > 0 && !map->IsDetached(isolate) &&
+         map->prototype() == native_context->initial_object_prototype();
+}
+
+// static
+MaybeHandle<Map> JsonShapeCache::Lookup(Isolate* isolate,
+                                        uint32_t shape_hash) {
+  DisallowGarbageCollection no_gc;
+  Tagged<WeakFixedArray> cache = isolate->heap()->json_shape_cache();
+  int index = (shape_hash & (kJsonShapeCacheSize - 1)) * kEntrySize;
+  if (cache->get(index + kHashOffset) !=
+      Smi::FromInt(static_cast<int>(shape_hash))) {
+    return {};
+  }
+  Tagged<HeapObject> map;
+  if (!cache->get(index + kMapOffset).GetHeapObjectIfWeak(&map)) return {};
+  Tagged<Map> raw_map = Cast<Map>(map);
+  if (raw_map->prototype() !=
+      isolate->raw_native_context()->initial_object_prototype()) {
+    return {};
+  }
+  // The map may have been deprecated since it was entered, in which case the
+  // parser updates it.
+  return handle(raw_map, isolate);
+}
+
+// static
+void JsonShapeCache::Enter(Isolate* isolate, uint32_t shape_hash,
+                           Tagged<Map> map) {
+  DisallowGarbageCollection no_gc;
+  if (!IsCacheableMap(isolate, map, isolate->raw_native_context())) return;
+  Set(isolate->heap()->json_shape_cache(), shape_hash, map);
+}
+
+// static
+void JsonShapeCache::Set(Tagged<WeakFixedArray> cache, uint32_t shape_hash,
+                         Tagged<Map> map) {
+  int index = (shape_hash & (kJsonShapeCacheSize - 1)) * kEntrySize;
+  cache->set(index + kHashOffset, Smi::FromInt(static_cast<int>(shape_hash)));
+  cache->set(index + kMapOffset, MakeWeak(map));
+}
+
+// static
+bool JsonShapeCache::Register(Isolate* isolate,
+                              DirectHandle<NativeContext> native_context,
+                              DirectHandle<JSObject> object) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Map> map = object->map();
+  if (!IsCacheableMap(isolate, map, *native_context)) return false;
+  if (map->elements_kind() != HOLEY_ELEMENTS) return false;
+
+  uint32_t shape_hash = 0;
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    Tagged<Name> key = descriptors->GetKey(i);
+    // Only plain data fields with string keys can be created by JSON.parse.
+    if (details.kind() != PropertyKind::kData ||
+        details.location() != PropertyLocation::kField ||
+        details.attributes() != NONE || !IsString(key)) {
+      return false;
+    }
+    shape_hash = AddKey(shape_hash, Cast<String>(key));
+  }
+  Set(isolate->heap()->json_shape_cache(), shape_hash, map);
+  return true;
+}
+
+// static
+void JsonShapeCache::Clear(Tagged<WeakFixedArray> cache) {
+  for (int i = 0; i < cache->length(); i++) {
+    cache->set(i, Smi::zero());
+  }
+}
+
+// static
+uint32_t JsonShapeCache::AddKey(uint32_t shape_hash, Tagged<String> key) {
+  DCHECK(IsInternalizedString(key));
+  uint32_t key_hash = key->hash();
+  // Keep the hash in Smi range so that it can be stored in the cache.
+  return static_cast<uint32_t>(base::hash_combine(shape_hash, key_hash)) &
+         static_cast<uint32_t>(Smi::kMaxValue);
+}
+
 template <typename Char>
 JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source)
     : isolate_(isolate),
@@ -1237,9 +1390,12 @@ class NamedPropertyValueIterator {
 template <typename Char>
 class JsonParser<Char>::NamedPropertyIterator {
  public:
+  // |keys| optionally holds the already internalized keys of the named
+  // properties.
   NamedPropertyIterator(JsonParser<Char>& parser, const JsonProperty* it,
-                        const JsonProperty* end)
-      : parser_(parser), it_(it), end_(end) {
+                        const JsonProperty* end,
+                        const Handle<String>* keys = nullptr)
+      : parser_(parser), it_(it), end_(end), keys_(keys) {
     DCHECK_LE(it_, end_);
     while (it_ != end_ && it_->string.is_index()) {
       it_++;
@@ -1252,6 +1408,7 @@ class JsonParser<Char>::NamedPropertyIterator {
     do {
       it_++;
     } while (it_ != end_ && it_->string.is_index());
+    if (keys_ != nullptr) keys_++;
   }
 
   bool Done() const {
@@ -1263,6 +1420,7 @@ class JsonParser<Char>::NamedPropertyIterator {
     return parser_.GetKeyChars(it_->string);
   }
   Handle<String> GetKey(Handle<String> expected_key_hint) {
+    if (keys_ != nullptr) return *keys_;
     return parser_.MakeString(it_->string, expected_key_hint);
   }
   Handle<Object> GetValue(bool will_revisit_value) {
@@ -1279,20 +1437,41 @@ class JsonParser<Char>::NamedPropertyIterator {
   const JsonProperty* start_;
   const JsonProperty* it_;
   const JsonProperty* end_;
+  const Handle<String>* keys_;
 };
 
 template <typename Char>
 Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
                                                    Handle<Map> feedback) {
-  if (!feedback.is_null() && feedback->is_deprecated()) {
-    feedback = Map::Update(isolate_, feedback);
-  }
   size_t start = cont.index;
   DCHECK_LE(start, property_stack_.size());
   int length = static_cast<int>(property_stack_.size() - start);
   int named_length = length - cont.elements;
   DCHECK_LE(0, named_length);
 
+  // Without feedback from a sibling object, fall back to the map of the last
+  // object with the same property names. Without feedback the keys have to be
+  // internalized anyway, so do that up front and combine the hashes that it
+  // caches on them.
+  uint32_t shape_hash = 0;
+  base::SmallVector<Handle<String>, 16> keys;
+  bool use_shape_cache =
+      v8_flags.json_shape_cache && feedback.is_null() && named_length > 0;
+  if (use_shape_cache) {
+    for (int i = 0; i < length; i++) {
+      const JsonString& key = property_stack_[start + i].string;
+      if (key.is_index()) continue;
+      Handle<String> internalized = MakeString(key);
+      keys.push_back(internalized);
+      shape_hash = JsonShapeCache::AddKey(shape_hash, *internalized);
+    }
+    JsonShapeCache::Lookup(isolate_, shape_hash).ToHandle(&feedback);
+  }
+
+  if (!feedback.is_null() && feedback->is_deprecated()) {
+    feedback = Map::Update(isolate_, feedback);
+  }
+
   Handle<FixedArrayBase> elements;
   ElementsKind elements_kind = HOLEY_ELEMENTS;
 
@@ -1338,9 +1517,16 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
       JSDataObjectBuilder::kHeapNumbersGuaranteedUniquelyOwned);
 
   NamedPropertyIterator it(*this, property_stack_.begin() + start,
-                           property_stack_.end());
+                           property_stack_.end(),
+                           keys.empty() ? nullptr : keys.data());
 
-  return js_data_object_builder.BuildFromIterator(it, elements);
+  Handle<JSObject> object =
+      js_data_object_builder.BuildFromIterator(it, elements);
+  if (use_shape_cache &&
+      (feedback.is_null() || object->map() != *feedback)) {
+    JsonShapeCache::Enter(isolate_, shape_hash, object->map());
+  }
+  return object;
 }
 
 template <typename Char>
@@ -2113,6 +2299,11 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if constexpr (sizeof(Char) == 1) {
+      // One-byte strings are mostly long runs of ordinary characters, so skip
+      // over them a block at a time. {bits} is irrelevant here.
+      cursor_ = SkipToJsonStringTerminatorCandidate(cursor_, end_);
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -2202,5 +2393,9 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
 
+#ifdef NEON64
+#undef NEON64
+#endif
+
 }  // namespace internal
 }  // namespace v8
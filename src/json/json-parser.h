@@ -133,6 +133,43 @@ class JsonParseInternalizer {
   Handle<String> source_;
 };
 
+// Per-isolate cache from the sequence of property names of a JSON object to
+// the map of the last object parsed with that sequence. JsonParser uses the
+// cached map as the expected final map of objects without other feedback, so
+// that documents sharing a schema skip the transition lookups. Maps are held
+// weakly, and collisions are harmless since each key is checked against the
+// map when the object is built.
+class JsonShapeCache final : public AllStatic {
+ public:
+  // Returns the cached map for |shape_hash| if it can be used for objects in
+  // the current native context.
+  static MaybeHandle<Map> Lookup(Isolate* isolate, uint32_t shape_hash);
+  static void Enter(Isolate* isolate, uint32_t shape_hash, Tagged<Map> map);
+  // Adds the map of |object| to the cache so that JSON objects with the same
+  // property names in |native_context| start out with it. Returns false if
+  // JSON.parse could never produce that map.
+  static bool Register(Isolate* isolate,
+                       DirectHandle<NativeContext> native_context,
+                       DirectHandle<JSObject> object);
+  static void Clear(Tagged<WeakFixedArray> cache);
+
+  // Extends |shape_hash| by the next property name, whose hash is cached in
+  // its raw hash field since it is internalized.
+  static uint32_t AddKey(uint32_t shape_hash, Tagged<String> key);
+
+  static constexpr int kJsonShapeCacheSize = 64;
+  static constexpr int kEntrySize = 2;
+
+ private:
+  static bool IsCacheableMap(Isolate* isolate, Tagged<Map> map,
+                             Tagged<NativeContext> native_context);
+  static void Set(Tagged<WeakFixedArray> cache, uint32_t shape_hash,
+                  Tagged<Map> map);
+
+  static constexpr int kHashOffset = 0;
+  static constexpr int kMapOffset = 1;
+};
+
 enum class JsonToken : uint8_t {
   NUMBER,
   STRING,
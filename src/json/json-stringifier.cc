@@ -4,6 +4,8 @@
 
 #include "src/json/json-stringifier.h"
 
+#include "include/v8-profiler.h"
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
@@ -20,13 +22,115 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available).
+#define NEON64
+#include <arm_neon.h>
+#endif
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Returns the first character in [start, end) that JSON.stringify may have to
+// escape, i.e. '"', '\\', a control character or (for two-byte strings) a
+// surrogate, scanning a vector of characters at a time. If there is none in
+// the complete vectors, returns the start of the remaining tail, which the
+// caller scans one character at a time.
+template <typename Char>
+const Char* SkipCharactersNotToEscape(const Char* start, const Char* end) {
+  static_assert(sizeof(Char) == 1 || sizeof(Char) == 2);
+  const Char* cursor = start;
+#if defined(__SSE2__)
+  constexpr size_t kCharsPerVector = sizeof(__m128i) / sizeof(Char);
+  for (; static_cast<size_t>(end - cursor) >= kCharsPerVector;
+       cursor += kCharsPerVector) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i matches;
+    if constexpr (sizeof(Char) == 1) {
+      // Unsigned c <= 0x1F iff saturating c - 0x1F == 0.
+      matches = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('"')),
+                       _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\'))),
+          _mm_cmpeq_epi8(_mm_subs_epu8(chars, _mm_set1_epi8(0x1F)),
+                         _mm_setzero_si128()));
+    } else {
+      __m128i surrogate_bits =
+          _mm_and_si128(chars, _mm_set1_epi16(static_cast<int16_t>(0xF800)));
+      matches = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi16(chars, _mm_set1_epi16('"')),
+                       _mm_cmpeq_epi16(chars, _mm_set1_epi16('\\'))),
+          _mm_or_si128(
+              _mm_cmpeq_epi16(_mm_subs_epu16(chars, _mm_set1_epi16(0x1F)),
+                              _mm_setzero_si128()),
+              _mm_cmpeq_epi16(surrogate_bits,
+                              _mm_set1_epi16(static_cast<int16_t>(0xD800)))));
+    }
+    // One bit per byte, so two-byte characters have two bits each.
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros(mask) / sizeof(Char);
+    }
+  }
+#elif defined(NEON64)
+  if constexpr (sizeof(Char) == 1) {
+    constexpr size_t kCharsPerVector = sizeof(uint8x16_t);
+    for (; static_cast<size_t>(end - cursor) >= kCharsPerVector;
+         cursor += kCharsPerVector) {
+      uint8x16_t chars = vld1q_u8(cursor);
+      uint8x16_t matches = vorrq_u8(
+          vorrq_u8(vceqq_u8(chars, vdupq_n_u8('"')),
+                   vceqq_u8(chars, vdupq_n_u8('\\'))),
+          vcltq_u8(chars, vdupq_n_u8(0x20)));
+      if (vmaxvq_u8(matches) != 0) {
+        // Narrow each byte of the mask to 4 bits to find the first match.
+        uint64_t mask = vget_lane_u64(
+            vreinterpret_u64_u8(
+                vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)),
+            0);
+        return cursor + (base::bits::CountTrailingZeros(mask) >> 2);
+      }
+    }
+  } else {
+    constexpr size_t kCharsPerVector = sizeof(uint16x8_t) / sizeof(uint16_t);
+    for (; static_cast<size_t>(end - cursor) >= kCharsPerVector;
+         cursor += kCharsPerVector) {
+      uint16x8_t chars = vld1q_u16(cursor);
+      uint16x8_t matches = vorrq_u16(
+          vorrq_u16(vceqq_u16(chars, vdupq_n_u16('"')),
+                    vceqq_u16(chars, vdupq_n_u16('\\'))),
+          vorrq_u16(vcltq_u16(chars, vdupq_n_u16(0x20)),
+                    vceqq_u16(vandq_u16(chars, vdupq_n_u16(0xF800)),
+                              vdupq_n_u16(0xD800))));
+      if (vmaxvq_u16(matches) != 0) {
+        // Narrow each lane of the mask to 8 bits to find the first match.
+        uint64_t mask =
+            vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(matches)), 0);
+        return cursor + (base::bits::CountTrailingZeros(mask) >> 3);
+      }
+    }
+  }
+#endif
+  USE(end);
+  return cursor;
+}
+
+}  // namespace
+
 class JsonStringifier {
  public:
-  explicit JsonStringifier(Isolate* isolate);
+  // If |output_stream| is given, the result is written to it in chunks
+  // instead of being returned as a string.
+  explicit JsonStringifier(Isolate* isolate,
+                           v8::OutputStream* output_stream = nullptr);
 
   ~JsonStringifier() {
     if (one_byte_ptr_ != one_byte_array_) delete[] one_byte_ptr_;
@@ -39,6 +143,8 @@ class JsonStringifier {
                                                       Handle<Object> gap);
 
  private:
+  // EXCEPTION is also returned, without a pending exception, once the output
+  // stream aborted.
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
   bool InitializeReplacer(Handle<Object> replacer);
@@ -254,6 +360,12 @@ class JsonStringifier {
       cursor_ += length;
     }
 
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, size_t length) {
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
+
    private:
     int* current_index_;
     DestChar* start_;
@@ -373,6 +485,11 @@ class JsonStringifier {
   V8_NOINLINE void Extend();
   V8_NOINLINE void ChangeEncoding();
 
+  // Writes the current part to the output stream as UTF-8 and starts a new
+  // part. A trailing lead surrogate is kept unless this is the last part.
+  void FlushToOutputStream(bool is_last_part);
+  void WriteToOutputStream(char* data, int length);
+
   Isolate* isolate_;
   String::Encoding encoding_;
   Handle<FixedArray> property_list_;
@@ -388,6 +505,11 @@ class JsonStringifier {
   bool overflowed_;
   bool need_stack_;
 
+  v8::OutputStream* output_stream_;
+  int output_chunk_size_ = 0;
+  bool output_aborted_ = false;
+  std::vector<char> output_buffer_;
+
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
 
@@ -405,6 +527,19 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<Object> object,
+                                  Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  JsonStringifier stringifier(isolate, stream);
+  Handle<Object> result;
+  if (!stringifier
+           .Stringify(object, isolate->factory()->undefined_value(), gap)
+           .ToHandle(&result)) {
+    return Nothing<bool>();
+  }
+  return Just(IsTrue(*result, isolate));
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -447,7 +582,8 @@ const bool JsonStringifier::JsonDoNotEscapeFlagTable[] = {
     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
 };
 
-JsonStringifier::JsonStringifier(Isolate* isolate)
+JsonStringifier::JsonStringifier(Isolate* isolate,
+                                 v8::OutputStream* output_stream)
     : isolate_(isolate),
       encoding_(String::ONE_BYTE_ENCODING),
       gap_(nullptr),
@@ -457,11 +593,17 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       current_index_(0),
       stack_nesting_level_(0),
       overflowed_(false),
-      need_stack_(false),
+      // Output that was already streamed can't be discarded, so don't start
+      // with the optimistic pass that would restart on NEED_STACK.
+      need_stack_(output_stream != nullptr),
+      output_stream_(output_stream),
       stack_(),
       key_cache_(isolate) {
   one_byte_ptr_ = one_byte_array_;
   part_ptr_ = one_byte_ptr_;
+  if (output_stream_ != nullptr) {
+    output_chunk_size_ = std::max(output_stream_->GetChunkSize(), 1);
+  }
 }
 
 MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
@@ -482,6 +624,15 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
     result = SerializeObject(object);
   }
   if (result == UNCHANGED) return factory()->undefined_value();
+  if (result == EXCEPTION && output_aborted_ && !isolate_->has_exception()) {
+    return factory()->false_value();
+  }
+  if (result == SUCCESS && output_stream_ != nullptr) {
+    FlushToOutputStream(true);
+    if (output_aborted_) return factory()->false_value();
+    output_stream_->EndOfStream();
+    return factory()->true_value();
+  }
   if (result == SUCCESS) {
     if (overflowed_ || current_index_ > String::kMaxLength) {
       THROW_NEW_ERROR(isolate_, NewInvalidStringLengthError());
@@ -814,6 +965,8 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
       IsException(isolate_->stack_guard()->HandleInterrupts(), isolate_)) {
     return EXCEPTION;
   }
+  // Don't run any more user code once the output stream aborted.
+  if (output_aborted_) return EXCEPTION;
 
   DirectHandle<Object> initial_value = object;
   PtrComprCageBase cage_base(isolate_);
@@ -1098,6 +1251,7 @@ JsonStringifier::Result JsonStringifier::SerializeFixedArrayWithInterruptCheck(
       }
     }
     if (i >= length) return SUCCESS;
+    if (output_aborted_) return EXCEPTION;
     DCHECK_LT(limit, kMaxAllowedFastPackedLength);
     limit = std::min(length, limit + kInterruptLength);
     if (interrupt_check.InterruptRequested() &&
@@ -1191,6 +1345,7 @@ JsonStringifier::Result JsonStringifier::SerializeArrayLikeSlow(
   }
   HandleScope handle_scope(isolate_);
   for (uint32_t i = start; i < length; i++) {
+    if (output_aborted_) return EXCEPTION;
     Separator(i == 0);
     Handle<Object> element;
     ASSIGN_RETURN_ON_EXCEPTION_VALUE(
@@ -1294,6 +1449,7 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
         need_stack_ = true;
         return NEED_STACK;
       }
+      if (output_aborted_) return EXCEPTION;
       ASSIGN_RETURN_ON_EXCEPTION_VALUE(
           isolate_, property,
           Object::GetPropertyOrElement(isolate_, object, key_name), EXCEPTION);
@@ -1324,6 +1480,7 @@ JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
   Indent();
   bool comma = false;
   for (int i = 0; i < contents->length(); i++) {
+    if (output_aborted_) return EXCEPTION;
     Handle<String> key(Cast<String>(contents->get(i)), isolate_);
     Handle<Object> property;
     ASSIGN_RETURN_ON_EXCEPTION_VALUE(
@@ -1382,10 +1539,20 @@ bool JsonStringifier::SerializeStringUnchecked_(
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   bool required_escaping = false;
+  if (raw_json) {
+    dest->AppendChars(src.begin(), src.size());
+    return required_escaping;
+  }
   for (int i = 0; i < src.length(); i++) {
     SrcChar c = src[i];
-    if (raw_json || DoNotEscape(c)) {
-      dest->Append(c);
+    if (DoNotEscape(c)) {
+      // Copy the whole run of characters that don't need escaping at once.
+      const SrcChar* run_end =
+          SkipCharactersNotToEscape(src.begin() + i + 1, src.end());
+      while (run_end != src.end() && DoNotEscape(*run_end)) run_end++;
+      int run_length = static_cast<int>(run_end - (src.begin() + i));
+      dest->AppendChars(src.begin() + i, run_length);
+      i += run_length - 1;
     } else if (sizeof(SrcChar) != 1 &&
                base::IsInRange(c, static_cast<SrcChar>(0xD800),
                                static_cast<SrcChar>(0xDFFF))) {
@@ -1632,6 +1799,13 @@ bool JsonStringifier::SerializeString(Handle<String> object) {
 }
 
 void JsonStringifier::Extend() {
+  // When streaming, a full part is written out and reused. The part only
+  // grows if a single append needs more space than it has, or if all that is
+  // left after flushing is a kept lead surrogate.
+  if (output_stream_ != nullptr && current_index_ > 1) {
+    FlushToOutputStream(false);
+    return;
+  }
   if (part_length_ >= String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
     current_index_ = 0;
@@ -1667,5 +1841,57 @@ void JsonStringifier::ChangeEncoding() {
   one_byte_ptr_ = nullptr;
 }
 
+void JsonStringifier::FlushToOutputStream(bool is_last_part) {
+  DCHECK_NOT_NULL(output_stream_);
+  int length = current_index_;
+  current_index_ = 0;
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    output_buffer_.resize(length * 2);
+    char* out = output_buffer_.data();
+    for (int i = 0; i < length; i++) {
+      out += unibrow::Utf8::EncodeOneByte(out, one_byte_ptr_[i]);
+    }
+    WriteToOutputStream(output_buffer_.data(),
+                        static_cast<int>(out - output_buffer_.data()));
+    return;
+  }
+  // Keep a trailing lead surrogate for the next part, since its trail
+  // surrogate may still follow.
+  bool keep_lead_surrogate =
+      !is_last_part && length > 0 &&
+      unibrow::Utf16::IsLeadSurrogate(two_byte_ptr_[length - 1]);
+  if (keep_lead_surrogate) length--;
+  output_buffer_.resize(length * unibrow::Utf8::kMaxEncodedSize);
+  char* out = output_buffer_.data();
+  int previous = unibrow::Utf16::kNoPreviousCharacter;
+  for (int i = 0; i < length; i++) {
+    base::uc16 c = two_byte_ptr_[i];
+    out += unibrow::Utf8::Encode(out, c, previous, true);
+    previous = c;
+  }
+  WriteToOutputStream(output_buffer_.data(),
+                      static_cast<int>(out - output_buffer_.data()));
+  if (keep_lead_surrogate) {
+    two_byte_ptr_[current_index_++] = two_byte_ptr_[length];
+  }
+}
+
+void JsonStringifier::WriteToOutputStream(char* data, int length) {
+  // After the stream aborted, the rest of the output is dropped.
+  while (!output_aborted_ && length > 0) {
+    int chunk_length = std::min(length, output_chunk_size_);
+    if (output_stream_->WriteAsciiChunk(data, chunk_length) ==
+        v8::OutputStream::kAbort) {
+      output_aborted_ = true;
+    }
+    data += chunk_length;
+    length -= chunk_length;
+  }
+}
+
+#ifdef NEON64
+#undef NEON64
+#endif
+
 }  // namespace internal
 }  // namespace v8
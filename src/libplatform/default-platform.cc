@@ -35,7 +35,7 @@ constexpr int kMaxThreadPoolSize = 16;
 int GetActualThreadPoolSize(int thread_pool_size) {
   DCHECK_GE(thread_pool_size, 0);
   if (thread_pool_size < 1) {
-    thread_pool_size = base::SysInfo::NumberOfProcessors() - 1;
+    thread_pool_size = base::SysInfo::NumberOfAvailableProcessors() - 1;
   }
   return std::max(std::min(thread_pool_size, kMaxThreadPoolSize), 1);
 }
@@ -47,6 +47,11 @@ namespace internal {
   HR(wasm_wasm_module_size_bytes, V8.WasmModuleSizeBytes.wasm, 1, GB, 51)      \
   HR(wasm_compile_huge_function_peak_memory_bytes,                             \
      V8.WasmCompileHugeFunctionPeakMemoryBytes, 1, GB, 51)                     \
+  /* Function body bytes compiled per second by one compile task, in KiB. */   \
+  HR(wasm_baseline_compile_throughput_kb,                                      \
+     V8.WasmBaselineCompileThroughputKiBPerSecond, 1, 1024 * 1024, 51)         \
+  HR(wasm_top_tier_compile_throughput_kb,                                      \
+     V8.WasmTopTierCompileThroughputKiBPerSecond, 1, 1024 * 1024, 51)          \
   HR(asm_module_size_bytes, V8.AsmModuleSizeBytes, 1, GB, 51)                  \
   HR(compile_script_cache_behaviour, V8.CompileScript.CacheBehaviour, 0, 20,   \
      21)                                                                       \
@@ -101,6 +106,10 @@ namespace internal {
   /* Counted after sweeping the table at the end of mark-compact GC. */        \
   HR(external_pointers_count, V8.SandboxedExternalPointersCount, 0,            \
      kMaxExternalPointers, 101)                                                \
+  /* Percentage of the entries in its segments that a swept external */        \
+  /* pointer table space still uses. */                                        \
+  HR(external_pointer_table_occupancy_percent,                                 \
+     V8.SandboxedExternalPointerTableOccupancyPercent, 0, 100, 101)            \
   HR(code_pointers_count, V8.SandboxedCodePointersCount, 0, kMaxCodePointers,  \
      101)                                                                      \
   HR(trusted_pointers_count, V8.SandboxedTrustedPointersCount, 0,              \
@@ -242,6 +251,12 @@ namespace internal {
   HT(maglev_optimize_finalize, V8.MaglevOptimizeFinalize, 100000, MICROSECOND) \
   HT(maglev_optimize_total_time, V8.MaglevOptimizeTotalTime, 1000000,          \
      MICROSECOND)                                                              \
+  HT(maglev_optimize_queue_time, V8.MaglevOptimizeQueueTime, 1000000,          \
+     MICROSECOND)                                                              \
+  /* Sparkplug timers. */                                                      \
+  HT(sparkplug_batch_compile_background, V8.SparkplugBatchCompileBackground,   \
+     1000000, MICROSECOND)                                                     \
+  HT(sparkplug_batch_install, V8.SparkplugBatchInstall, 100000, MICROSECOND)   \
   /* TurboFan timers. */                                                       \
   HT(turbofan_optimize_prepare, V8.TurboFanOptimizePrepare, 1000000,           \
      MICROSECOND)                                                              \
@@ -354,6 +369,19 @@ namespace internal {
   /* Number of times the cache contained a reusable Script but not */          \
   /* the root SharedFunctionInfo. */                                           \
   SC(compilation_cache_partial_hits, V8.CompilationCachePartialHits)           \
+  /* SharedFunctionInfos seen when merging a new script into a cached one: */  \
+  /* cached ones kept as they were, cached ones that took over the new */      \
+  /* compiled data, and new ones added to the cached script. */                \
+  SC(code_merge_reused_sfis, V8.CodeMergeReusedSharedFunctionInfos)            \
+  SC(code_merge_updated_sfis, V8.CodeMergeUpdatedSharedFunctionInfos)          \
+  SC(code_merge_new_sfis, V8.CodeMergeNewSharedFunctionInfos)                  \
+  /* Functions whose bytecode was flushed, and flushed ones compiled again. */ \
+  SC(bytecode_flushed_functions, V8.BytecodeFlushedFunctions)                  \
+  SC(bytecode_recompiled_functions, V8.BytecodeRecompiledFunctions)            \
+  /* Atomics.Mutex locks that did not succeed on the fast path. */             \
+  SC(atomics_mutex_contended_locks, V8.AtomicsMutexContendedLocks)             \
+  /* Contended locks that failed to spin and put the thread to sleep. */       \
+  SC(atomics_mutex_parked_locks, V8.AtomicsMutexParkedLocks)                   \
   SC(objs_since_last_young, V8.ObjsSinceLastYoung)                             \
   SC(objs_since_last_full, V8.ObjsSinceLastFull)                               \
   SC(gc_compactor_caused_by_request, V8.GCCompactorCausedByRequest)            \
@@ -363,8 +391,15 @@ namespace internal {
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(maps_created, V8.MapsCreated)                                             \
+  /* Allocation sites whose elements kind was generalized by a transition. */  \
+  SC(allocation_site_elements_kind_updates,                                    \
+     V8.AllocationSiteElementsKindUpdates)                                     \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  /* Stores whose write barrier an optimizing compiler removed. */             \
+  SC(write_barriers_elided, V8.WriteBarriersElided)                            \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
+  SC(regexp_native_code_size, V8.RegExpNativeCodeBytes)                        \
+  SC(regexp_bytecode_size, V8.RegExpBytecodeBytes)                             \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
@@ -389,12 +424,15 @@ namespace internal {
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
-#define STATS_COUNTER_NATIVE_CODE_LIST(SC)                         \
-  /* Number of write barriers executed at runtime. */              \
-  SC(write_barriers, V8.WriteBarriers)                             \
-  SC(regexp_entry_native, V8.RegExpEntryNative)                    \
-  SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes) \
-  SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)
+#define STATS_COUNTER_NATIVE_CODE_LIST(SC)                             \
+  /* Number of write barriers executed at runtime. */                  \
+  SC(write_barriers, V8.WriteBarriers)                                 \
+  SC(regexp_entry_native, V8.RegExpEntryNative)                        \
+  SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)     \
+  SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)     \
+  /* Elements kind transitions, in the runtime or in stubs, that */    \
+  /* copied the backing store. Literal boilerplates are left out. */   \
+  SC(elements_kind_transition_copies, V8.ElementsKindTransitionCopies)
 
 }  // namespace internal
 }  // namespace v8
@@ -130,7 +130,10 @@ void RuntimeCallTimer::Snapshot() {
 }
 
 RuntimeCallStats::RuntimeCallStats(ThreadType thread_type)
-    : in_use_(false), thread_type_(thread_type) {
+    : in_use_(false),
+      sampling_rate_(v8_flags.runtime_call_stats_sampling_rate),
+      sampling_countdown_(sampling_rate_),
+      thread_type_(thread_type) {
   static const char* const kNames[] = {
 #define CALL_BUILTIN_COUNTER(name) "GC_" #name,
       FOR_EACH_GC_COUNTER(CALL_BUILTIN_COUNTER)  //
@@ -199,6 +202,13 @@ bool RuntimeCallStats::IsBackgroundThreadSpecificVariant(
 void RuntimeCallStats::Enter(RuntimeCallTimer* timer,
                              RuntimeCallCounterId counter_id) {
   DCHECK(IsCalledOnTheSameThread());
+  if (V8_UNLIKELY(sampling_rate_ > 1) && current_timer() == nullptr) {
+    if (unsampled_depth_ > 0 || --sampling_countdown_ > 0) {
+      unsampled_depth_++;
+      return;
+    }
+    sampling_countdown_ = sampling_rate_;
+  }
   RuntimeCallCounter* counter = GetCounter(counter_id);
   DCHECK_NOT_NULL(counter->name());
   timer->Start(counter, current_timer());
@@ -209,7 +219,11 @@ void RuntimeCallStats::Enter(RuntimeCallTimer* timer,
 void RuntimeCallStats::Leave(RuntimeCallTimer* timer) {
   DCHECK(IsCalledOnTheSameThread());
   RuntimeCallTimer* stack_top = current_timer();
-  if (stack_top == nullptr) return;  // Missing timer is a result of Reset().
+  if (stack_top == nullptr) {
+    // Missing timer is a result of Reset() or of an unsampled scope.
+    if (unsampled_depth_ > 0) unsampled_depth_--;
+    return;
+  }
   CHECK(stack_top == timer);
   current_timer_.SetValue(timer->Stop());
   RuntimeCallTimer* cur_timer = current_timer();
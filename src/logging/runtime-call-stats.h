@@ -179,6 +179,7 @@ class RuntimeCallTimer final {
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyToStream)                                \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -267,6 +268,7 @@ class RuntimeCallTimer final {
   V(SharedArrayBuffer_New)                                 \
   V(SharedArrayBuffer_NewBackingStore)                     \
   V(String_Concat)                                         \
+  V(String_NewExternalFromUtf8)                            \
   V(String_NewExternalOneByte)                             \
   V(String_NewExternalTwoByte)                             \
   V(String_NewFromOneByte)                                 \
@@ -698,6 +700,12 @@ class RuntimeCallStats final {
   base::AtomicValue<RuntimeCallCounter*> current_counter_;
   // Used to track nested tracing scopes.
   bool in_use_;
+  // With --runtime-call-stats-sampling-rate, only every {sampling_rate_}th
+  // top-level scope is timed. Scopes nested in one that is not are skipped
+  // as well, and counted in {unsampled_depth_}.
+  int sampling_rate_;
+  int sampling_countdown_;
+  int unsampled_depth_ = 0;
   ThreadType thread_type_;
   ThreadId thread_id_;
   RuntimeCallCounter counters_[kNumberOfCounters];
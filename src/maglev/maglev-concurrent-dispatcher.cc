@@ -4,6 +4,8 @@
 
 #include "src/maglev/maglev-concurrent-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/codegen/compiler.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-heap-broker.h"
@@ -14,11 +16,13 @@
 #include "src/handles/persistent-handles.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/logging/metrics.h"
 #include "src/maglev/maglev-code-generator.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-compiler.h"
 #include "src/maglev/maglev-graph-labeller.h"
 #include "src/maglev/maglev-pipeline-statistics.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/identity-map.h"
 #include "src/utils/locked-queue-inl.h"
@@ -204,6 +208,24 @@ void MaglevCompilationJob::RecordCompilationStats(Isolate* isolate) const {
   // Don't record samples from machines without high-resolution timers,
   // as that can cause serious reporting issues. See the thread at
   // http://g/chrome-metrics-team/NwwJEyL8odU/discussion for more details.
+  if (base::TimeTicks::IsHighResolution() &&
+      isolate->metrics_recorder()->HasEmbedderRecorder()) {
+    v8::metrics::JavaScriptFunctionCompiled event;
+    event.tier = v8::metrics::JavaScriptTier::kMaglev;
+    event.concurrent = !time_spent_in_queue_.IsZero();
+    event.osr = is_osr();
+    event.bytecode_size_in_bytes =
+        function()->shared()->GetBytecodeArray(isolate)->length();
+    if (event.concurrent) {
+      event.wait_duration_in_us = time_spent_in_queue_.InMicroseconds();
+    }
+    event.compile_duration_in_us =
+        (time_taken_to_prepare_ + time_taken_to_execute_).InMicroseconds();
+    event.install_duration_in_us = time_taken_to_finalize_.InMicroseconds();
+    isolate->metrics_recorder()->AddMainThreadEvent(
+        event, isolate->GetOrRegisterRecorderContextId(
+                   direct_handle(function()->native_context(), isolate)));
+  }
   if (base::TimeTicks::IsHighResolution()) {
     Counters* const counters = isolate->counters();
     counters->maglev_optimize_prepare()->AddSample(
@@ -214,6 +236,10 @@ void MaglevCompilationJob::RecordCompilationStats(Isolate* isolate) const {
         static_cast<int>(time_taken_to_finalize_.InMicroseconds()));
     counters->maglev_optimize_total_time()->AddSample(
         static_cast<int>(ElapsedTime().InMicroseconds()));
+    if (!time_spent_in_queue_.IsZero()) {
+      counters->maglev_optimize_queue_time()->AddSample(
+          static_cast<int>(time_spent_in_queue_.InMicroseconds()));
+    }
   }
   if (v8_flags.trace_opt_stats) {
     static double compilation_time = 0.0;
@@ -253,6 +279,34 @@ void MaglevCompilationJob::EndPhaseKind() {
   }
 }
 
+void MaglevConcurrentDispatcher::PriorityJobQueue::Enqueue(
+    std::unique_ptr<MaglevCompilationJob>&& job, int priority, bool is_small) {
+  base::MutexGuard guard(&mutex_);
+  heap_.push_back({priority, next_sequence_++, is_small, std::move(job)});
+  std::push_heap(heap_.begin(), heap_.end(), IsLowerPriority);
+}
+
+bool MaglevConcurrentDispatcher::PriorityJobQueue::Dequeue(
+    std::unique_ptr<MaglevCompilationJob>* job, bool* is_small) {
+  base::MutexGuard guard(&mutex_);
+  if (heap_.empty()) return false;
+  std::pop_heap(heap_.begin(), heap_.end(), IsLowerPriority);
+  *job = std::move(heap_.back().job);
+  if (is_small) *is_small = heap_.back().is_small;
+  heap_.pop_back();
+  return true;
+}
+
+bool MaglevConcurrentDispatcher::PriorityJobQueue::IsEmpty() const {
+  base::MutexGuard guard(&mutex_);
+  return heap_.empty();
+}
+
+size_t MaglevConcurrentDispatcher::PriorityJobQueue::size() const {
+  base::MutexGuard guard(&mutex_);
+  return heap_.size();
+}
+
 // The JobTask is posted to V8::GetCurrentPlatform(). It's responsible for
 // processing the incoming queue on a worker thread.
 class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
@@ -269,10 +323,15 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
     DCHECK(local_isolate.heap()->IsParked());
 
     std::unique_ptr<MaglevCompilationJob> job_to_destruct;
+    // Small functions compile quickly, so the code of several of them is
+    // installed with a single interrupt instead of one each.
+    int pending_installs = 0;
     while (!delegate->ShouldYield()) {
       std::unique_ptr<MaglevCompilationJob> job;
-      if (incoming_queue()->Dequeue(&job)) {
+      bool is_small;
+      if (incoming_queue()->Dequeue(&job, &is_small)) {
         DCHECK_NOT_NULL(job);
+        job->RecordDequeueTime();
         TRACE_EVENT_WITH_FLOW0(
             TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.MaglevBackground",
             job->trace_id(),
@@ -283,6 +342,13 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
             job->ExecuteJob(local_isolate.runtime_call_stats(), &local_isolate);
         if (status == CompilationJob::SUCCEEDED) {
           outgoing_queue()->Enqueue(std::move(job));
+          if (is_small &&
+              ++pending_installs <
+                  v8_flags.concurrent_maglev_install_batch_size &&
+              !incoming_queue()->IsEmpty()) {
+            continue;
+          }
+          pending_installs = 0;
           isolate()->stack_guard()->RequestInstallMaglevCode();
         }
       } else if (destruction_queue()->Dequeue(&job)) {
@@ -298,6 +364,9 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
         break;
       }
     }
+    if (pending_installs > 0) {
+      isolate()->stack_guard()->RequestInstallMaglevCode();
+    }
   }
 
   size_t GetMaxConcurrency(size_t worker_count) const override {
@@ -312,7 +381,9 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
 
  private:
   Isolate* isolate() const { return dispatcher_->isolate_; }
-  QueueT* incoming_queue() const { return &dispatcher_->incoming_queue_; }
+  PriorityJobQueue* incoming_queue() const {
+    return &dispatcher_->incoming_queue_;
+  }
   QueueT* outgoing_queue() const { return &dispatcher_->outgoing_queue_; }
   QueueT* destruction_queue() const { return &dispatcher_->destruction_queue_; }
 
@@ -358,7 +429,19 @@ MaglevConcurrentDispatcher::~MaglevConcurrentDispatcher() {
 void MaglevConcurrentDispatcher::EnqueueJob(
     std::unique_ptr<MaglevCompilationJob>&& job) {
   DCHECK(is_enabled());
-  incoming_queue_.Enqueue(std::move(job));
+  // The invocation count tells how much of the interrupt budget the function
+  // has used up so far, which makes it a good measure of hotness.
+  Tagged<JSFunction> function = *job->function();
+  int priority = 0;
+  if (v8_flags.concurrent_maglev_prioritize_hot_functions &&
+      function->has_feedback_vector()) {
+    priority = function->feedback_vector()->invocation_count(kRelaxedLoad);
+  }
+  bool is_small =
+      function->shared()->GetBytecodeArray(isolate_)->length() <=
+      v8_flags.concurrent_maglev_small_function_size;
+  job->set_enqueue_time(base::TimeTicks::Now());
+  incoming_queue_.Enqueue(std::move(job), priority, is_small);
   job_handle_->NotifyConcurrencyIncrease();
 }
 
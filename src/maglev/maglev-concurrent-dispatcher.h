@@ -8,7 +8,10 @@
 #ifdef V8_ENABLE_MAGLEV
 
 #include <memory>
+#include <vector>
 
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/codegen/compiler.h"  // For OptimizedCompilationJob.
 #include "src/maglev/maglev-pipeline-statistics.h"
 #include "src/utils/locked-queue.h"
@@ -67,6 +70,12 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
   base::TimeDelta time_taken_to_execute() { return time_taken_to_execute_; }
   base::TimeDelta time_taken_to_finalize() { return time_taken_to_finalize_; }
 
+  // Time between enqueueing the job and starting to execute it.
+  void set_enqueue_time(base::TimeTicks time) { enqueue_time_ = time; }
+  void RecordDequeueTime() {
+    time_spent_in_queue_ = base::TimeTicks::Now() - enqueue_time_;
+  }
+
   void RecordCompilationStats(Isolate* isolate) const;
 
   void DisposeOnMainThread(Isolate* isolate);
@@ -89,6 +98,8 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
   // Currently only totals are collected.
   compiler::ZoneStats zone_stats_;
   std::unique_ptr<MaglevPipelineStatistics> pipeline_statistics_;
+  base::TimeTicks enqueue_time_;
+  base::TimeDelta time_spent_in_queue_;
 };
 
 // The public API for Maglev concurrent compilation.
@@ -100,6 +111,35 @@ class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
   // them for simplicity - consider replacing with lock-free data structures.
   using QueueT = LockedQueue<std::unique_ptr<MaglevCompilationJob>>;
 
+  // The incoming queue is ordered by the hotness of the functions, so that the
+  // hottest functions are compiled first when many requests come in at once.
+  // Jobs of equal hotness are processed in FIFO order.
+  class PriorityJobQueue final {
+   public:
+    void Enqueue(std::unique_ptr<MaglevCompilationJob>&& job, int priority,
+                 bool is_small);
+    bool Dequeue(std::unique_ptr<MaglevCompilationJob>* job,
+                 bool* is_small = nullptr);
+    bool IsEmpty() const;
+    size_t size() const;
+
+   private:
+    struct Entry {
+      int priority;
+      uint64_t sequence;
+      bool is_small;
+      std::unique_ptr<MaglevCompilationJob> job;
+    };
+    static bool IsLowerPriority(const Entry& a, const Entry& b) {
+      if (a.priority != b.priority) return a.priority < b.priority;
+      return a.sequence > b.sequence;
+    }
+
+    mutable base::Mutex mutex_;
+    std::vector<Entry> heap_;
+    uint64_t next_sequence_ = 0;
+  };
+
  public:
   explicit MaglevConcurrentDispatcher(Isolate* isolate);
   ~MaglevConcurrentDispatcher();
@@ -119,7 +159,7 @@ class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
  private:
   Isolate* const isolate_;
   std::unique_ptr<JobHandle> job_handle_;
-  QueueT incoming_queue_;
+  PriorityJobQueue incoming_queue_;
   QueueT outgoing_queue_;
   QueueT destruction_queue_;
 };
@@ -107,9 +107,11 @@ bool IsSupported(CpuOperation op) {
 
 class FunctionContextSpecialization final : public AllStatic {
  public:
+  // Contexts are constants when specializing to the function context, and in
+  // functions inlined at calls to a known JSFunction, even without function
+  // context specialization.
   static compiler::OptionalContextRef TryToRef(
       const MaglevCompilationUnit* unit, ValueNode* context, size_t* depth) {
-    DCHECK(unit->info()->specialize_to_function_context());
     if (Constant* n = context->TryCast<Constant>()) {
       return n->ref().AsContext().previous(unit->broker(), depth);
     }
@@ -2878,8 +2880,6 @@ void MaglevGraphBuilder::VisitLdaConstant() {
 bool MaglevGraphBuilder::TrySpecializeLoadContextSlotToFunctionContext(
     ValueNode** context, size_t* depth, int slot_index,
     ContextSlotMutability slot_mutability) {
-  DCHECK(compilation_unit_->info()->specialize_to_function_context());
-
   size_t new_depth = *depth;
   compiler::OptionalContextRef maybe_context_ref =
       FunctionContextSpecialization::TryToRef(compilation_unit_, *context,
@@ -3033,8 +3033,7 @@ void MaglevGraphBuilder::BuildLoadContextSlot(
     ContextSlotMutability slot_mutability) {
   MinimizeContextChainDepth(&context, &depth);
 
-  if (compilation_unit_->info()->specialize_to_function_context() &&
-      TrySpecializeLoadContextSlotToFunctionContext(
+  if (TrySpecializeLoadContextSlotToFunctionContext(
           &context, &depth, slot_index, slot_mutability)) {
     return;  // Our work here is done.
   }
@@ -3058,13 +3057,10 @@ void MaglevGraphBuilder::BuildStoreContextSlotHelper(
     bool update_const_tracking_let_side_data) {
   MinimizeContextChainDepth(&context, &depth);
 
-  if (compilation_unit_->info()->specialize_to_function_context()) {
-    compiler::OptionalContextRef maybe_ref =
-        FunctionContextSpecialization::TryToRef(compilation_unit_, context,
-                                                &depth);
-    if (maybe_ref.has_value()) {
-      context = GetConstant(maybe_ref.value());
-    }
+  if (compiler::OptionalContextRef maybe_ref =
+          FunctionContextSpecialization::TryToRef(compilation_unit_, context,
+                                                  &depth)) {
+    context = GetConstant(maybe_ref.value());
   }
 
   for (size_t i = 0; i < depth; ++i) {
@@ -6563,13 +6559,10 @@ void MaglevGraphBuilder::VisitLdaModuleVariable() {
   ValueNode* context = GetContext();
   MinimizeContextChainDepth(&context, &depth);
 
-  if (compilation_unit_->info()->specialize_to_function_context()) {
-    compiler::OptionalContextRef maybe_ref =
-        FunctionContextSpecialization::TryToRef(compilation_unit_, context,
-                                                &depth);
-    if (maybe_ref.has_value()) {
-      context = GetConstant(maybe_ref.value());
-    }
+  if (compiler::OptionalContextRef maybe_ref =
+          FunctionContextSpecialization::TryToRef(compilation_unit_, context,
+                                                  &depth)) {
+    context = GetConstant(maybe_ref.value());
   }
 
   for (size_t i = 0; i < depth; i++) {
@@ -6612,13 +6605,10 @@ void MaglevGraphBuilder::VisitStaModuleVariable() {
   size_t depth = iterator_.GetUnsignedImmediateOperand(1);
   MinimizeContextChainDepth(&context, &depth);
 
-  if (compilation_unit_->info()->specialize_to_function_context()) {
-    compiler::OptionalContextRef maybe_ref =
-        FunctionContextSpecialization::TryToRef(compilation_unit_, context,
-                                                &depth);
-    if (maybe_ref.has_value()) {
-      context = GetConstant(maybe_ref.value());
-    }
+  if (compiler::OptionalContextRef maybe_ref =
+          FunctionContextSpecialization::TryToRef(compilation_unit_, context,
+                                                  &depth)) {
+    context = GetConstant(maybe_ref.value());
   }
 
   for (size_t i = 0; i < depth; i++) {
@@ -9121,11 +9111,14 @@ ReduceResult MaglevGraphBuilder::ReduceCallForApiFunction(
     CHECK_NOT_NULL(receiver);
   }
 
+  // Inlined API calls are not supported by the Maglev->Turboshaft translation.
+  bool inline_api_calls =
+      v8_flags.maglev_inline_api_calls &&
+      !compilation_unit()->info()->for_turboshaft_frontend();
   CallKnownApiFunction::Mode mode =
       broker()->dependencies()->DependOnNoProfilingProtector()
-          ? (v8_flags.maglev_inline_api_calls
-                 ? CallKnownApiFunction::kNoProfilingInlined
-                 : CallKnownApiFunction::kNoProfiling)
+          ? (inline_api_calls ? CallKnownApiFunction::kNoProfilingInlined
+                              : CallKnownApiFunction::kNoProfiling)
           : CallKnownApiFunction::kGeneric;
 
   return AddNewNode<CallKnownApiFunction>(
@@ -9482,6 +9475,48 @@ ReduceResult MaglevGraphBuilder::ReduceCallForTarget(
   return ReduceCallForConstant(target, args, feedback_source);
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceCallForBoundFunction(
+    compiler::JSBoundFunctionRef target, CallArguments& args,
+    const compiler::FeedbackSource& feedback_source) {
+  if (args.mode() != CallArguments::kDefault) return ReduceResult::Fail();
+  compiler::JSReceiverRef bound_target = target.bound_target_function(broker());
+  if (!bound_target.IsJSFunction()) return ReduceResult::Fail();
+  if (bound_target.AsJSFunction().native_context(broker()) !=
+      broker()->target_native_context()) {
+    return ReduceResult::Fail();
+  }
+
+  // The fields of a JSBoundFunction are immutable, so a constant bound
+  // function can be flattened into a call to its target with the bound
+  // receiver and arguments as constants.
+  // An implicit receiver (kNullOrUndefined) is materialized as undefined, so
+  // only an undefined bound receiver may be dropped; a bound null must stay
+  // explicit for strict-mode targets to observe it.
+  compiler::ObjectRef bound_this = target.bound_this(broker());
+  const bool bound_this_is_undefined = bound_this.IsUndefined();
+  compiler::FixedArrayRef bound_arguments = target.bound_arguments(broker());
+  base::SmallVector<ValueNode*, 8> call_args;
+  if (!bound_this_is_undefined) {
+    call_args.push_back(GetConstant(bound_this));
+  }
+  for (int i = 0; i < bound_arguments.length(); ++i) {
+    compiler::OptionalObjectRef maybe_arg =
+        bound_arguments.TryGet(broker(), i);
+    if (!maybe_arg.has_value()) return ReduceResult::Fail();
+    call_args.push_back(GetConstant(maybe_arg.value()));
+  }
+  for (size_t i = 0; i < args.count(); ++i) {
+    call_args.push_back(args[i]);
+  }
+  ConvertReceiverMode receiver_mode =
+      bound_this_is_undefined ? ConvertReceiverMode::kNullOrUndefined
+      : bound_this.IsNull()   ? ConvertReceiverMode::kAny
+                              : ConvertReceiverMode::kNotNullOrUndefined;
+  CallArguments bound_call_args(receiver_mode, std::move(call_args));
+  return ReduceCallForConstant(bound_target.AsJSFunction(), bound_call_args,
+                               feedback_source);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCallForNewClosure(
     ValueNode* target_node, ValueNode* target_context,
     compiler::SharedFunctionInfoRef shared,
@@ -9577,6 +9612,14 @@ void MaglevGraphBuilder::BuildCallWithFeedback(
       DCHECK_EQ(CallFeedbackContent::kTarget, content);
     }
     RETURN_VOID_IF_ABORT(BuildCheckValue(target_node, feedback_target));
+  } else if (call_feedback.target().has_value() &&
+             call_feedback.target()->IsJSBoundFunction() &&
+             call_feedback.call_feedback_content() ==
+                 CallFeedbackContent::kTarget) {
+    // Bound functions stored in fields (e.g. callbacks) are usually not
+    // constants, so specialize on the monomorphic target from the feedback.
+    RETURN_VOID_IF_ABORT(
+        BuildCheckValue(target_node, call_feedback.target().value()));
   }
 
   PROCESS_AND_RETURN_IF_DONE(ReduceCall(target_node, args, feedback_source),
@@ -9728,6 +9771,10 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
       ReduceResult result = ReduceCallForTarget(
           target_node, maybe_constant->AsJSFunction(), args, feedback_source);
       RETURN_IF_DONE(result);
+    } else if (maybe_constant->IsJSBoundFunction()) {
+      ReduceResult result = TryReduceCallForBoundFunction(
+          maybe_constant->AsJSBoundFunction(), args, feedback_source);
+      RETURN_IF_DONE(result);
     }
   }
 
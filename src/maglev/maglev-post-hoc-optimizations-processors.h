@@ -54,10 +54,7 @@ class LoopOptimizationProcessor {
   }
 
   bool CanHoist(Node* candidate) {
-    DCHECK_EQ(candidate->input_count(), 1);
     DCHECK(current_block->is_loop());
-    ValueNode* input = candidate->input(0).node();
-    DCHECK(!IsLoopPhi(input));
     // For hoisting an instruction we need:
     // * A unique loop entry block.
     // * Inputs live before the loop (i.e., not defined inside the loop).
@@ -69,8 +66,24 @@ class LoopOptimizationProcessor {
     if (loop_entry->successors().size() != 1) {
       return false;
     }
-    if (IsConstantNode(input->opcode())) return true;
-    return input->owner() != current_block;
+    for (Input& input : *candidate) {
+      ValueNode* node = input.node();
+      if (IsConstantNode(node->opcode())) continue;
+      if (IsLoopPhi(node) || node->owner() == current_block) return false;
+    }
+    return true;
+  }
+
+  // Moves the eager deopt of a hoisted |check| to the checkpoint of the loop
+  // entry. Returns false if the loop entry has no checkpoint.
+  bool MoveCheckToLoopEntry(NodeBase* check) {
+    auto j = current_block->predecessor_at(0)
+                 ->control_node()
+                 ->TryCast<CheckpointedJump>();
+    if (!j) return false;
+    check->SetEagerDeoptInfo(zone, j->eager_deopt_info()->top_frame(),
+                             check->eager_deopt_info()->feedback_to_update());
+    return true;
   }
 
   ProcessResult Process(LoadTaggedFieldForContextSlot* ltf,
@@ -132,19 +145,27 @@ class LoopOptimizationProcessor {
       return ProcessResult::kContinue;
     }
     if (!loop_effects->unstable_aspects_cleared && CanHoist(maps)) {
-      if (auto j = current_block->predecessor_at(0)
-                       ->control_node()
-                       ->TryCast<CheckpointedJump>()) {
-        maps->SetEagerDeoptInfo(zone, j->eager_deopt_info()->top_frame(),
-                                maps->eager_deopt_info()->feedback_to_update());
-      } else {
-        return ProcessResult::kContinue;
-      }
+      if (!MoveCheckToLoopEntry(maps)) return ProcessResult::kContinue;
       return ProcessResult::kHoist;
     }
     return ProcessResult::kContinue;
   }
 
+  ProcessResult Process(CheckInt32Condition* check,
+                        const ProcessingState& state) {
+    DCHECK(loop_effects);
+    // Bounds checks of a loop-invariant index against a loop-invariant length
+    // only depend on int32 values, so no loop effect can invalidate them. As
+    // for map checks, don't hoist if we ever deoptimized this function. Like
+    // everything else here, only checks in the loop header block are hoisted.
+    if (!was_deoptimized && CanHoist(check) && MoveCheckToLoopEntry(check)) {
+      return ProcessResult::kHoist;
+    }
+    // Ensure we are not hoisting over checks.
+    loop_effects = nullptr;
+    return ProcessResult::kSkipBlock;
+  }
+
   template <typename NodeT>
   ProcessResult Process(NodeT* node, const ProcessingState& state) {
     // Ensure we are not hoisting over checks.
@@ -11,7 +11,6 @@
 #include <optional>
 
 #include "src/base/numbers/dtoa.h"
-#include "src/base/numbers/strtod.h"
 #include "src/base/small-vector.h"
 #include "src/bigint/bigint.h"
 #include "src/common/assert-scope.h"
@@ -561,28 +560,19 @@ class NumberParseIntHelper : public StringToIntHelper {
 
   template <class Char>
   void HandleBaseTenCase(const Char* current, const Char* end) {
-    // Parsing with strtod.
-    const int kMaxSignificantDigits = 309;  // Doubles are less than 1.8e308.
-    // The buffer may contain up to kMaxSignificantDigits + 1 digits and a zero
-    // end.
-    const int kBufferSize = kMaxSignificantDigits + 2;
-    char buffer[kBufferSize];
-    int buffer_pos = 0;
-    while (*current >= '0' && *current <= '9') {
-      if (buffer_pos <= kMaxSignificantDigits) {
-        // If the number has more than kMaxSignificantDigits it will be parsed
-        // as infinity.
-        DCHECK_LT(buffer_pos, kBufferSize);
-        buffer[buffer_pos++] = static_cast<char>(*current);
-      }
-      ++current;
-      if (current == end) break;
+    const Char* digits_end = current;
+    while (digits_end != end && *digits_end >= '0' && *digits_end <= '9') {
+      ++digits_end;
     }
-
-    SLOW_DCHECK(buffer_pos < kBufferSize);
-    buffer[buffer_pos] = '\0';
-    base::Vector<const char> buffer_vector(buffer, buffer_pos);
-    result_ = Strtod(buffer_vector, 0);
+    // Parsing with fast_float, which falls back to a bignum comparison only
+    // for the rare inputs that Eisel-Lemire can't round correctly. Numbers
+    // with too many digits are parsed as infinity.
+    using UC =
+        std::conditional_t<std::is_same_v<Char, uint8_t>, char, char16_t>;
+    static_assert(sizeof(UC) == sizeof(Char));
+    fast_float::from_chars(reinterpret_cast<const UC*>(current),
+                           reinterpret_cast<const UC*>(digits_end), result_,
+                           fast_float::chars_format::fixed);
     set_state(State::kDone);
   }
 
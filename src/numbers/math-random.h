@@ -21,7 +21,9 @@ class MathRandom : public AllStatic {
   // Returns a tagged Smi as a raw Address.
   static Address RefillCache(Isolate* isolate, Address raw_native_context);
 
-  static const int kCacheSize = 64;
+  // Each refill is a call from the MathRandom builtin into C++, so the cache
+  // is sized to amortize that call over a reasonable number of values.
+  static const int kCacheSize = 128;
   static const int kStateSize = 2 * kInt64Size;
 
   struct State {
@@ -239,7 +239,8 @@ bool AllocationSite::DigestTransitionFeedback(DirectHandle<AllocationSite> site,
                  ElementsKindToString(to_kind));
         }
         CHECK_NE(to_kind, DICTIONARY_ELEMENTS);
-        JSObject::TransitionElementsKind(boilerplate, to_kind);
+        JSObject::TransitionElementsKind(boilerplate, to_kind,
+                                         /*is_boilerplate=*/true);
         DependentCode::DeoptimizeDependencyGroups(
             isolate, *site,
             DependentCode::kAllocationSiteTransitionChangedGroup);
@@ -320,7 +320,8 @@ int Code::SizeIncludingMetadata() const {
   int size = InstructionStreamObjectSize();
   size += relocation_size();
   if (uses_deoptimization_data()) {
-    size += deoptimization_data()->Size();
+    size += Cast<DeoptimizationData>(deoptimization_data())
+                ->SizeIncludingMetadata();
   }
   return size;
 }
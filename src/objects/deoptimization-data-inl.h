@@ -56,6 +56,15 @@ int DeoptimizationData::DeoptCount() const {
   return (length() - kFirstDeoptEntryIndex) / kDeoptEntrySize;
 }
 
+int DeoptimizationData::SizeIncludingMetadata() const {
+  int size = Size();
+  if (length() == 0) return size;
+  size += FrameTranslation()->Size();
+  size += LiteralArray()->Size();
+  size += InliningPositions()->Size();
+  return size;
+}
+
 inline DeoptimizationLiteralArray::DeoptimizationLiteralArray(Address ptr)
     : TrustedWeakFixedArray(ptr) {
   // No type check is possible beyond that for WeakFixedArray.
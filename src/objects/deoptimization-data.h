@@ -338,6 +338,10 @@ class DeoptimizationData : public ProtectedFixedArray {
 
   inline int DeoptCount() const;
 
+  // The size of this array plus the frame translations, literals and inlining
+  // positions that it owns.
+  inline int SizeIncludingMetadata() const;
+
   static const int kNotInlinedIndex = -1;
 
   // Returns the inlined function at the given position in LiteralArray, or the
@@ -200,6 +200,11 @@ class EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) BaseNameDictionary
   static Handle<FixedArray> IterationIndices(Isolate* isolate,
                                              Handle<Derived> dictionary);
 
+  // Sorts the first |length| elements of |indices|, which are Smi entry
+  // indices into |dictionary|, by the enumeration index of their entries.
+  static void SortByEnumerationIndex(Tagged<Derived> dictionary,
+                                     Tagged<FixedArray> indices, int length);
+
   template <typename IsolateT>
   V8_WARN_UNUSED_RESULT static Handle<Derived> AddNoUpdateNextEnumerationIndex(
       IsolateT* isolate, Handle<Derived> dictionary, Key key,
@@ -7,6 +7,7 @@
 #include "src/base/macros.h"
 #include "src/base/platform/yield-processor.h"
 #include "src/execution/isolate-inl.h"
+#include "src/logging/counters.h"
 #include "src/objects/js-atomics-synchronization-inl.h"
 #include "src/objects/js-promise-inl.h"
 #include "src/objects/waiter-queue-node.h"
@@ -729,6 +730,7 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
                                   DirectHandle<JSAtomicsMutex> mutex,
                                   std::atomic<StateT>* state,
                                   std::optional<base::TimeDelta> timeout) {
+  requester->counters()->atomics_mutex_contended_locks()->Increment();
   for (;;) {
     // Spin for a little bit to try to acquire the lock, so as to be fast under
     // microcontention.
@@ -741,6 +743,7 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
     // sleep and will be blocked anyway.
     SyncWaiterQueueNode this_waiter(requester);
     if (!MaybeEnqueueNode(requester, mutex, state, &this_waiter)) return true;
+    requester->counters()->atomics_mutex_parked_locks()->Increment();
 
     bool rv;
     // Wait for another thread to release the lock and wake us up.
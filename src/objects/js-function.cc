@@ -13,6 +13,7 @@
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
 #include "src/execution/tiering-manager.h"
+#include "src/execution/tiering-profile.h"
 #include "src/heap/heap-inl.h"
 #include "src/ic/ic.h"
 #include "src/init/bootstrapper.h"
@@ -616,6 +617,9 @@ void JSFunction::CreateAndAttachFeedbackVector(
   DCHECK(function->raw_feedback_cell() !=
          isolate->heap()->many_closures_cell());
   DCHECK_EQ(function->raw_feedback_cell()->value(), *feedback_vector);
+  if (V8_UNLIKELY(v8_flags.tiering_profile_input)) {
+    TieringProfile::MaybeApply(isolate, *shared);
+  }
   function->SetInterruptBudget(isolate);
 
   DCHECK_EQ(v8_flags.log_function_events,
@@ -5472,8 +5472,15 @@ bool JSObject::UpdateAllocationSite(DirectHandle<JSObject> object,
     // Walk through to the Allocation Site
     site = handle(memento->GetAllocationSite(), heap->isolate());
   }
-  return AllocationSite::DigestTransitionFeedback<update_or_check>(site,
-                                                                   to_kind);
+  bool result =
+      AllocationSite::DigestTransitionFeedback<update_or_check>(site, to_kind);
+  if (update_or_check == AllocationSiteUpdateMode::kUpdate && result) {
+    site->GetIsolate()
+        ->counters()
+        ->allocation_site_elements_kind_updates()
+        ->Increment();
+  }
+  return result;
 }
 
 template bool
@@ -5484,7 +5491,8 @@ template bool JSObject::UpdateAllocationSite<AllocationSiteUpdateMode::kUpdate>(
     DirectHandle<JSObject> object, ElementsKind to_kind);
 
 void JSObject::TransitionElementsKind(Handle<JSObject> object,
-                                      ElementsKind to_kind) {
+                                      ElementsKind to_kind,
+                                      bool is_boilerplate) {
   ElementsKind from_kind = object->GetElementsKind();
 
   if (IsHoleyElementsKind(from_kind)) {
@@ -5514,6 +5522,9 @@ void JSObject::TransitionElementsKind(Handle<JSObject> object,
   } else {
     DCHECK((IsSmiElementsKind(from_kind) && IsDoubleElementsKind(to_kind)) ||
            (IsDoubleElementsKind(from_kind) && IsObjectElementsKind(to_kind)));
+    if (!is_boilerplate) {
+      isolate->counters()->elements_kind_transition_copies()->Increment();
+    }
     uint32_t c = static_cast<uint32_t>(object->elements()->length());
     if (ElementsAccessor::ForKind(to_kind)
             ->GrowCapacityAndConvert(object, c)
@@ -665,8 +665,11 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
   // map and the ElementsKind set.
   static Handle<Map> GetElementsTransitionMap(DirectHandle<JSObject> object,
                                               ElementsKind to_kind);
-  V8_EXPORT_PRIVATE static void TransitionElementsKind(Handle<JSObject> object,
-                                                       ElementsKind to_kind);
+  // |is_boilerplate| keeps transitions of literal boilerplates, which follow
+  // allocation site feedback, out of V8.ElementsKindTransitionCopies.
+  V8_EXPORT_PRIVATE static void TransitionElementsKind(
+      Handle<JSObject> object, ElementsKind to_kind,
+      bool is_boilerplate = false);
 
   // Always use this to migrate an object to a new map.
   // |expected_additional_properties| is only used for fast-to-slow transitions
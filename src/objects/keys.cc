@@ -894,11 +894,7 @@ void CopyEnumKeysTo(Isolate* isolate, Handle<Dictionary> dictionary,
   DisallowGarbageCollection no_gc;
   Tagged<Dictionary> raw_dictionary = *dictionary;
   Tagged<FixedArray> raw_storage = *storage;
-  EnumIndexComparator<Dictionary> cmp(raw_dictionary);
-  // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-  // store operations that are safe for concurrent marking.
-  AtomicSlot start(storage->RawFieldOfFirstElement());
-  std::sort(start, start + length, cmp);
+  Dictionary::SortByEnumerationIndex(raw_dictionary, raw_storage, length);
   for (int i = 0; i < length; i++) {
     InternalIndex index(Smi::ToInt(raw_storage->get(i)));
     raw_storage->set(i, raw_dictionary->NameAt(index));
@@ -964,15 +960,10 @@ ExceptionStatus CollectKeysFromDictionary(Handle<Dictionary> dictionary,
       // in case of ordered dictionary type.
       array->set(array_size++, Smi::FromInt(i.as_int()));
     }
-    if (!Dictionary::kIsOrderedDictionaryType) {
+    if constexpr (!Dictionary::kIsOrderedDictionaryType) {
       // Sorting only needed if it's an unordered dictionary,
       // otherwise we traversed elements in insertion order
-
-      EnumIndexComparator<Dictionary> cmp(*dictionary);
-      // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-      // store operations that are safe for concurrent marking.
-      AtomicSlot start(array->RawFieldOfFirstElement());
-      std::sort(start, start + array_size, cmp);
+      Dictionary::SortByEnumerationIndex(*dictionary, *array, array_size);
     }
   }
 
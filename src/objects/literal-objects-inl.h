@@ -58,6 +58,15 @@ SMI_ACCESSORS(ObjectBoilerplateDescription, backing_store_size,
               Shape::kBackingStoreSizeOffset)
 SMI_ACCESSORS(ObjectBoilerplateDescription, flags, Shape::kFlagsOffset)
 
+bool ObjectBoilerplateDescription::pretenure_hint() const {
+  return (flags() & kPretenureHintFlag) != 0;
+}
+
+void ObjectBoilerplateDescription::set_pretenure_hint(bool value) {
+  set_flags(value ? flags() | kPretenureHintFlag
+                  : flags() & ~kPretenureHintFlag);
+}
+
 Tagged<Object> ObjectBoilerplateDescription::name(int index) const {
   return get(NameIndex(index));
 }
@@ -105,11 +114,20 @@ ACCESSORS(ClassBoilerplate, instance_computed_properties, Tagged<FixedArray>,
 TQ_OBJECT_CONSTRUCTORS_IMPL(ArrayBoilerplateDescription)
 
 ElementsKind ArrayBoilerplateDescription::elements_kind() const {
-  return static_cast<ElementsKind>(flags());
+  return ElementsKindBits::decode(flags());
 }
 
 void ArrayBoilerplateDescription::set_elements_kind(ElementsKind kind) {
-  set_flags(kind);
+  // Only used on initialization, which also clears the pretenure hint.
+  set_flags(ElementsKindBits::encode(kind));
+}
+
+bool ArrayBoilerplateDescription::pretenure_hint() const {
+  return PretenureHintBit::decode(flags());
+}
+
+void ArrayBoilerplateDescription::set_pretenure_hint(bool value) {
+  set_flags(PretenureHintBit::update(flags(), value));
 }
 
 bool ArrayBoilerplateDescription::is_empty() const {
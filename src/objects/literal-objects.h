@@ -63,6 +63,13 @@ class ObjectBoilerplateDescription
   inline int flags() const;
   inline void set_flags(int value);
 
+  // Whether allocation sites created for this literal should start out
+  // tenured. Carried over in the code cache. Stored in {flags} above the
+  // ObjectLiteral::Flags bits.
+  inline bool pretenure_hint() const;
+  inline void set_pretenure_hint(bool value);
+  static constexpr int kPretenureHintFlag = 1 << 8;
+
   // Number of boilerplate properties and properties with computed names.
   inline int backing_store_size() const;
   inline void set_backing_store_size(int backing_store_size);
@@ -97,6 +104,14 @@ class ArrayBoilerplateDescription
   inline ElementsKind elements_kind() const;
   inline void set_elements_kind(ElementsKind kind);
 
+  // Whether allocation sites created for this literal should start out
+  // tenured. Carried over in the code cache.
+  inline bool pretenure_hint() const;
+  inline void set_pretenure_hint(bool value);
+
+  using ElementsKindBits = base::BitField<ElementsKind, 0, 8>;
+  using PretenureHintBit = ElementsKindBits::Next<bool, 1>;
+
   inline bool is_empty() const;
 
   // Dispatched behavior.
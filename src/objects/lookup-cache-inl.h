@@ -18,15 +18,17 @@ int DescriptorLookupCache::Hash(Tagged<Map> source, Tagged<Name> name) {
   // Uses only lower 32 bits if pointers are larger.
   uint32_t source_hash = static_cast<uint32_t>(source.ptr()) >> kTaggedSizeLog2;
   uint32_t name_hash = name->hash();
-  return (source_hash ^ name_hash) % kLength;
+  return ((source_hash ^ name_hash) & (kSets - 1)) * kWays;
 }
 
 int DescriptorLookupCache::Lookup(Tagged<Map> source, Tagged<Name> name) {
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  // Pointers in the table might be stale, so use SafeEquals.
-  if (key.source.SafeEquals(source) && key.name.SafeEquals(name)) {
-    return results_[index];
+  int set = Hash(source, name);
+  for (int index = set; index < set + kWays; ++index) {
+    Key& key = keys_[index];
+    // Pointers in the table might be stale, so use SafeEquals.
+    if (key.source.SafeEquals(source) && key.name.SafeEquals(name)) {
+      return results_[index];
+    }
   }
   return kAbsent;
 }
@@ -34,11 +36,19 @@ int DescriptorLookupCache::Lookup(Tagged<Map> source, Tagged<Name> name) {
 void DescriptorLookupCache::Update(Tagged<Map> source, Tagged<Name> name,
                                    int result) {
   DCHECK_NE(result, kAbsent);
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  key.source = source;
-  key.name = name;
-  results_[index] = result;
+  int set = Hash(source, name);
+  // Demote the current occupants of the set by one way, dropping the last
+  // one, unless the first way already holds this key.
+  Key& first = keys_[set];
+  if (!first.source.SafeEquals(source) || !first.name.SafeEquals(name)) {
+    for (int index = set + kWays - 1; index > set; --index) {
+      keys_[index] = keys_[index - 1];
+      results_[index] = results_[index - 1];
+    }
+  }
+  first.source = source;
+  first.name = name;
+  results_[set] = result;
 }
 
 }  // namespace internal
@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_H_
 #define V8_OBJECTS_LOOKUP_CACHE_H_
 
+#include "src/base/bits.h"
 #include "src/objects/map.h"
 #include "src/objects/name.h"
 #include "src/objects/objects.h"
@@ -13,6 +14,9 @@ namespace v8 {
 namespace internal {
 
 // Cache for mapping (map, property name) into descriptor index.
+// The cache is two-way set associative: a new entry is placed in the first
+// way of its set and the previous occupant is demoted to the second way, so
+// two (map, name) pairs that collide on the same set do not evict each other.
 // The cache contains both positive and negative results.
 // Descriptor index equals kNotFound means the property is absent.
 // Cleared at startup and prior to any gc.
@@ -41,9 +45,14 @@ class DescriptorLookupCache {
     }
   }
 
+  // Returns the index of the first way of the set for (source, name).
   static inline int Hash(Tagged<Map> source, Tagged<Name> name);
 
-  static const int kLength = 64;
+  static const int kWays = 2;
+  static const int kSets = 128;
+  static const int kLength = kSets * kWays;
+  static_assert(base::bits::IsPowerOfTwo(kSets));
+
   struct Key {
     Tagged<Map> source;
     Tagged<Name> name;
@@ -4308,6 +4308,45 @@ bool Script::ContainsAsmModule() {
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+// static
+void Script::AddLiteralSite(Isolate* isolate, DirectHandle<Script> script,
+                            DirectHandle<AllocationSite> site,
+                            DirectHandle<HeapObject> description) {
+  Handle<WeakArrayList> list;
+  if (IsUndefined(script->literal_sites(), isolate)) {
+    list = isolate->factory()->NewWeakArrayList(2, AllocationType::kOld);
+  } else {
+    list = handle(Cast<WeakArrayList>(script->literal_sites()), isolate);
+    if (list->length() + 2 > list->capacity()) {
+      // Drop the pairs of dead sites before growing the list.
+      DisallowGarbageCollection no_gc;
+      Tagged<WeakArrayList> raw = *list;
+      int new_length = 0;
+      for (int i = 0; i < raw->length(); i += 2) {
+        if (raw->Get(i).IsCleared() || raw->Get(i + 1).IsCleared()) continue;
+        raw->Set(new_length, raw->Get(i));
+        raw->Set(new_length + 1, raw->Get(i + 1));
+        new_length += 2;
+      }
+      for (int i = new_length; i < raw->length(); i++) {
+        raw->Set(i, ClearedValue(isolate));
+      }
+      raw->set_length(new_length);
+    }
+  }
+  list = WeakArrayList::EnsureSpace(isolate, list, list->length() + 2,
+                                    AllocationType::kOld);
+  {
+    DisallowGarbageCollection no_gc;
+    Tagged<WeakArrayList> raw = *list;
+    int length = raw->length();
+    raw->Set(length, MakeWeak(*site));
+    raw->Set(length + 1, MakeWeak(*description));
+    raw->set_length(length + 2);
+  }
+  script->set_literal_sites(*list);
+}
+
 namespace {
 
 template <typename Char>
@@ -5758,15 +5797,55 @@ Handle<FixedArray> BaseNameDictionary<Derived, Shape>::IterationIndices(
       DCHECK_EQ(array_size, dictionary->NumberOfElements());
     }
 
-    EnumIndexComparator<Derived> cmp(raw_dictionary);
-    // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-    // store operations that are safe for concurrent marking.
-    AtomicSlot start(array->RawFieldOfFirstElement());
-    std::sort(start, start + array_size, cmp);
+    SortByEnumerationIndex(raw_dictionary, *array, array_size);
   }
   return FixedArray::RightTrimOrEmpty(isolate, array, array_size);
 }
 
+// static
+template <typename Derived, typename Shape>
+void BaseNameDictionary<Derived, Shape>::SortByEnumerationIndex(
+    Tagged<Derived> dictionary, Tagged<FixedArray> indices, int length) {
+  DisallowGarbageCollection no_gc;
+  // Enumeration indices are unique and below next_enumeration_index(), which
+  // is renumbered when it grows too large. Unless deletions left the range
+  // sparse, the entries can thus be put in order by a single bucket pass
+  // rather than a comparison sort.
+  static constexpr int kMinLengthForBuckets = 16;
+  static constexpr int kMaxRangePerEntry = 4;
+  const int range =
+      dictionary->next_enumeration_index() - PropertyDetails::kInitialIndex;
+  if (length >= kMinLengthForBuckets && range <= kMaxRangePerEntry * length) {
+    std::vector<int> buckets(range, -1);
+    bool fits = true;
+    for (int i = 0; i < length; i++) {
+      int entry = Smi::ToInt(indices->get(i));
+      int bucket = dictionary->DetailsAt(InternalIndex(entry))
+                       .dictionary_index() -
+                   PropertyDetails::kInitialIndex;
+      // Entries added without updating the next enumeration index don't fit.
+      if (bucket < 0 || bucket >= range || buckets[bucket] != -1) {
+        fits = false;
+        break;
+      }
+      buckets[bucket] = entry;
+    }
+    if (fits) {
+      int i = 0;
+      for (int entry : buckets) {
+        if (entry != -1) indices->set(i++, Smi::FromInt(entry));
+      }
+      DCHECK_EQ(length, i);
+      return;
+    }
+  }
+  EnumIndexComparator<Derived> cmp(dictionary);
+  // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
+  // store operations that are safe for concurrent marking.
+  AtomicSlot start(indices->RawFieldOfFirstElement());
+  std::sort(start, start + length, cmp);
+}
+
 // Backwards lookup (slow).
 template <typename Derived, typename Shape>
 Tagged<Object> Dictionary<Derived, Shape>::SlowReverseLookup(
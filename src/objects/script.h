@@ -25,6 +25,7 @@ namespace v8 {
 
 namespace internal {
 
+class AllocationSite;
 class FunctionLiteral;
 class StructBodyDescriptor;
 
@@ -150,6 +151,15 @@ class Script : public TorqueGeneratedScript<Script, Struct> {
 
   DECL_ACCESSORS(compiled_lazy_function_positions, Tagged<Object>)
 
+  DECL_ACCESSORS(literal_sites, Tagged<Object>)
+
+  // Remembers that {site} was created for the literal described by
+  // {description}, so that its pretenuring decision can later be stored on
+  // the description.
+  static void AddLiteralSite(Isolate* isolate, DirectHandle<Script> script,
+                             DirectHandle<AllocationSite> site,
+                             DirectHandle<HeapObject> description);
+
   // If script source is an external string, check that the underlying
   // resource is accessible. Otherwise, always return true.
   inline bool HasValidSource();
@@ -870,6 +870,8 @@ void SharedFunctionInfo::EnsureOldForTesting(Tagged<SharedFunctionInfo> sfi) {
   if (v8_flags.flush_code_based_on_time ||
       v8_flags.flush_code_based_on_tab_visibility) {
     sfi->set_age(kMaxAge);
+  } else if (v8_flags.flush_code_based_on_memory_pressure) {
+    sfi->set_age(v8_flags.bytecode_max_old_age);
   } else {
     sfi->set_age(v8_flags.bytecode_old_age);
   }
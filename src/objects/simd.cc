@@ -204,11 +204,16 @@ inline uintptr_t fast_search_noavx(T* array, uintptr_t array_len,
 #undef MOVEMASK
 #undef EXTRACT
   } else if constexpr (is_uint64) {
-#define SET1(x) _mm_castsi128_ps(_mm_set1_epi64x(x))
-#define CMP(a, b) _mm_cmpeq_pd(_mm_castps_pd(a), _mm_castps_pd(b))
+    // SSE3 has no 64-bit integer equality, so compare the 32-bit halves and
+    // require both halves of a lane to match. A floating-point comparison
+    // would not find NaN bit patterns such as the double hole.
+#define CMP(a, b)                                                        \
+  _mm_castsi128_pd(_mm_and_si128(                                        \
+      _mm_cmpeq_epi32(a, b),                                             \
+      _mm_shuffle_epi32(_mm_cmpeq_epi32(a, b), _MM_SHUFFLE(2, 3, 0, 1))))
 #define EXTRACT(x) base::bits::CountTrailingZeros32(x)
-    VECTORIZED_LOOP_x86(__m128, __m128d, SET1, CMP, _mm_movemask_pd, EXTRACT)
-#undef SET1
+    VECTORIZED_LOOP_x86(__m128i, __m128d, _mm_set1_epi64x, CMP,
+                        _mm_movemask_pd, EXTRACT)
 #undef CMP
 #undef EXTRACT
   } else if constexpr (is_double) {
@@ -426,6 +431,28 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
       array_start, array_len, from_index, search_element);
 }
 
+// The hole is a NaN, so holes are found by comparing bit patterns.
+uintptr_t ArrayIndexOfHoleDouble(Address array_start, uintptr_t array_len,
+                                 uintptr_t from_index) {
+  Tagged<FixedDoubleArray> fixed_array =
+      Cast<FixedDoubleArray>(Tagged<Object>(array_start));
+  uint64_t* array = static_cast<uint64_t*>(
+      fixed_array->RawField(FixedDoubleArray::OffsetOfElementAt(0))
+          .ToVoidPtr());
+
+  if (reinterpret_cast<uintptr_t>(array) % sizeof(uint64_t) != 0) {
+    // Slow scalar search for unaligned double array.
+    for (; from_index < array_len; from_index++) {
+      if (fixed_array->is_the_hole(static_cast<int>(from_index))) {
+        return from_index;
+      }
+    }
+    return Smi::FromInt(-1).ptr();
+  }
+
+  return search<uint64_t>(array, array_len, from_index, kHoleNanInt64);
+}
+
 #ifdef NEON64
 #undef NEON64
 #endif
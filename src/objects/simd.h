@@ -16,6 +16,10 @@ uintptr_t ArrayIndexOfIncludesSmiOrObject(Address array_start,
                                           uintptr_t array_len,
                                           uintptr_t from_index,
                                           Address search_element);
+// Returns the index of the first hole at or after |from_index| in the holey
+// FixedDoubleArray at |array_start|, or -1.
+uintptr_t ArrayIndexOfHoleDouble(Address array_start, uintptr_t array_len,
+                                 uintptr_t from_index);
 uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
                                      uintptr_t from_index,
                                      Address search_element);
@@ -494,6 +494,81 @@ template DirectHandle<String> StringTable::LookupKey(
 template DirectHandle<String> StringTable::LookupKey(
     LocalIsolate* isolate, StringTableInsertionKey* key);
 
+template <typename StringTableKey, typename IsolateT>
+void StringTable::LookupOrInsertMany(IsolateT* isolate,
+                                     base::Vector<StringTableKey* const> keys,
+                                     base::Vector<Handle<String>> results) {
+  DCHECK_EQ(keys.size(), results.size());
+  // See LookupKey for the reasoning behind the lock-free reads. The only
+  // difference here is that all misses are prepared for insertion (which may
+  // allocate) first, and only then inserted under a single critical section.
+  Data* const current_data = data_.load(std::memory_order_acquire);
+  OffHeapStringHashSet& current_table = current_data->table();
+
+  size_t misses = 0;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    StringTableKey* key = keys[i];
+    InternalIndex entry = current_table.FindEntry(isolate, key, key->hash());
+    if (entry.is_found()) {
+      results[i] = Handle<String>(
+          Cast<String>(current_table.GetKey(isolate, entry)), isolate);
+      DCHECK_IMPLIES(v8_flags.shared_string_table,
+                     InAnySharedSpace(*results[i]));
+      continue;
+    }
+    results[i] = Handle<String>();
+    ++misses;
+  }
+  if (misses == 0) return;
+
+  // Prepare all misses outside of the lock, as this may allocate.
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (results[i].is_null()) keys[i]->PrepareForInsertion(isolate);
+  }
+
+  base::MutexGuard table_write_guard(&write_mutex_);
+
+  Data* data = EnsureCapacity(isolate, static_cast<int>(misses));
+  OffHeapStringHashSet& table = data->table();
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (!results[i].is_null()) continue;
+    StringTableKey* key = keys[i];
+    // Check one last time if the key is present in the table, in case it was
+    // added after the check, possibly by an earlier key of this batch.
+    InternalIndex entry =
+        table.FindEntryOrInsertionEntry(isolate, key, key->hash());
+
+    Tagged<Object> element = table.GetKey(isolate, entry);
+    if (element == OffHeapStringHashSet::empty_element()) {
+      DirectHandle<String> new_string = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+      table.AddAt(isolate, entry, *new_string);
+      results[i] = indirect_handle(new_string, isolate);
+    } else if (element == OffHeapStringHashSet::deleted_element()) {
+      DirectHandle<String> new_string = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+      table.OverwriteDeletedAt(isolate, entry, *new_string);
+      results[i] = indirect_handle(new_string, isolate);
+    } else {
+      results[i] = Handle<String>(Cast<String>(element), isolate);
+    }
+  }
+}
+
+template void StringTable::LookupOrInsertMany(
+    Isolate* isolate, base::Vector<OneByteStringKey* const> keys,
+    base::Vector<Handle<String>> results);
+template void StringTable::LookupOrInsertMany(
+    Isolate* isolate, base::Vector<TwoByteStringKey* const> keys,
+    base::Vector<Handle<String>> results);
+template void StringTable::LookupOrInsertMany(
+    LocalIsolate* isolate, base::Vector<OneByteStringKey* const> keys,
+    base::Vector<Handle<String>> results);
+template void StringTable::LookupOrInsertMany(
+    LocalIsolate* isolate, base::Vector<TwoByteStringKey* const> keys,
+    base::Vector<Handle<String>> results);
+
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
   // This call is only allowed while the write mutex is held.
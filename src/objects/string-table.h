@@ -66,6 +66,15 @@ class V8_EXPORT_PRIVATE StringTable {
   template <typename StringTableKey, typename IsolateT>
   DirectHandle<String> LookupKey(IsolateT* isolate, StringTableKey* key);
 
+  // Batched version of LookupKey. All keys are first looked up without taking
+  // the write lock; the write lock is then taken at most once to insert all
+  // misses. |results| must have the same length as |keys| and receives the
+  // string found or inserted for the key at the same index.
+  template <typename StringTableKey, typename IsolateT>
+  void LookupOrInsertMany(IsolateT* isolate,
+                          base::Vector<StringTableKey* const> keys,
+                          base::Vector<Handle<String>> results);
+
   // {raw_string} must be a tagged String pointer.
   // Returns a tagged pointer: either a Smi if the string is an array index, an
   // internalized string, or a Smi sentinel.
@@ -1242,6 +1242,82 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+// Bounds the buffers for matches that straddle segments.
+constexpr int kMaxRopeSearchPatternLength = 32;
+// Searching segment by segment only pays off if the segments are long, so
+// give up after seeing this many short ones.
+constexpr int kMinRopeSearchSegmentLength = 256;
+constexpr int kMaxShortRopeSearchSegments = 16;
+constexpr int kRopeSearchGaveUp = -2;
+
+// Searches |receiver| one segment at a time, without flattening it. Returns
+// kRopeSearchGaveUp if the rope consists of too many short segments.
+template <typename PatternChar>
+int SearchRope(Isolate* isolate, Tagged<ConsString> receiver,
+               base::Vector<const PatternChar> pattern, int start_index) {
+  DisallowGarbageCollection no_gc;
+  const int keep = pattern.length() - 1;
+  // The last |keep| characters before the current segment. These are the only
+  // ones at which a match can start that isn't contained in a single segment.
+  base::SmallVector<base::uc16, kMaxRopeSearchPatternLength> carry;
+  int carry_start = start_index;
+  base::SmallVector<base::uc16, 2 * kMaxRopeSearchPatternLength> window;
+  int short_segments = 0;
+
+  int offset;
+  ConsStringIterator iter(receiver, start_index);
+  for (Tagged<String> segment = iter.Next(&offset); !segment.is_null();
+       segment = iter.Next(&offset)) {
+    const int segment_chars = segment->length() - offset;
+    if (segment_chars < kMinRopeSearchSegmentLength &&
+        ++short_segments > kMaxShortRopeSearchSegments) {
+      return kRopeSearchGaveUp;
+    }
+    const int segment_start = carry_start + static_cast<int>(carry.size());
+    String::FlatContent content = segment->GetFlatContent(no_gc);
+
+    if (!carry.empty()) {
+      window.clear();
+      window.insert(window.end(), carry.begin(), carry.end());
+      for (int i = 0; i < std::min(segment_chars, keep); i++) {
+        window.push_back(content.Get(offset + i));
+      }
+      int index = SearchString(
+          isolate, base::Vector<const base::uc16>(window.data(), window.size()),
+          pattern, 0);
+      if (index != -1 && index < static_cast<int>(carry.size())) {
+        return carry_start + index;
+      }
+    }
+
+    int index = content.IsOneByte()
+                    ? SearchString(isolate, content.ToOneByteVector(), pattern,
+                                   offset)
+                    : SearchString(isolate, content.ToUC16Vector(), pattern,
+                                   offset);
+    if (index != -1) return segment_start + index - offset;
+
+    if (segment_chars >= keep) {
+      carry.clear();
+      for (int i = segment->length() - keep; i < segment->length(); i++) {
+        carry.push_back(content.Get(i));
+      }
+      carry_start = segment_start + segment_chars - keep;
+    } else {
+      for (int i = offset; i < segment->length(); i++) {
+        carry.push_back(content.Get(i));
+      }
+      const int excess = static_cast<int>(carry.size()) - keep;
+      if (excess > 0) {
+        std::copy(carry.begin() + excess, carry.end(), carry.begin());
+        carry.resize_no_init(keep);
+        carry_start += excess;
+      }
+    }
+  }
+  return -1;
+}
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1255,8 +1331,23 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
-  receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
+  if (v8_flags.string_search_ropes && IsConsString(*receiver) &&
+      !receiver->IsFlat() && receiver_length >= kMinRopeSearchLength &&
+      search_length <= kMaxRopeSearchPatternLength) {
+    // A single search doesn't need the rope to be flattened. If the rope turns
+    // out to be made of many short segments, flattening it is cheaper.
+    DisallowGarbageCollection no_gc;
+    String::FlatContent search_content = search->GetFlatContent(no_gc);
+    int result =
+        search_content.IsOneByte()
+            ? SearchRope(isolate, Cast<ConsString>(*receiver),
+                         search_content.ToOneByteVector(), start_index)
+            : SearchRope(isolate, Cast<ConsString>(*receiver),
+                         search_content.ToUC16Vector(), start_index);
+    if (result != kRopeSearchGaveUp) return result;
+  }
+  receiver = String::Flatten(isolate, receiver);
 
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
@@ -334,6 +334,9 @@ V8_OBJECT class String : public Name {
   // check any arguments.
   static int IndexOf(Isolate* isolate, Handle<String> receiver,
                      Handle<String> search, int start_index);
+  // With --string-search-ropes, IndexOf searches cons strings of at least this
+  // length without flattening them.
+  static const int kMinRopeSearchLength = 4 * KB;
 
   static Tagged<Object> LastIndexOf(Isolate* isolate, Handle<Object> receiver,
                                     Handle<Object> search,
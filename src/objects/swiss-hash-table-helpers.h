@@ -36,6 +36,17 @@
 #endif
 #endif
 
+// Neon is always available on arm64. We only use it there, since on 32-bit ARM
+// some of the required instructions are not available.
+#ifndef V8_SWISS_TABLE_HAVE_NEON_HOST
+#if (defined(__aarch64__) || defined(_M_ARM64)) && \
+    (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 1
+#else
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 0
+#endif
+#endif
+
 #if V8_SWISS_TABLE_HAVE_SSSE3_HOST && !V8_SWISS_TABLE_HAVE_SSE2_HOST
 #error "Bad configuration!"
 #endif
@@ -64,6 +75,10 @@
 #include <tmmintrin.h>
 #endif
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 namespace swiss_table {
@@ -322,6 +337,35 @@ struct GroupPortableImpl {
   uint64_t ctrl;
 };
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+// A Neon version of GroupPortableImpl. It uses the same group width and byte
+// mask layout, so the two are interchangeable, including for snapshots. Unlike
+// the portable version, Match never yields false positives.
+struct GroupNeonImpl {
+  static constexpr size_t kWidth = 8;  // the number of slots per group
+
+  explicit GroupNeonImpl(const ctrl_t* pos) {
+    ctrl = vld1_u8(reinterpret_cast<const uint8_t*>(pos));
+  }
+
+  static constexpr uint64_t kMsbs = GroupPortableImpl::kMsbs;
+
+  // Returns a bitmask representing the positions of slots that match |hash|.
+  BitMask<uint64_t, kWidth, 3> Match(h2_t hash) const {
+    uint8x8_t matches = vceq_u8(vdup_n_u8(hash), ctrl);
+    return BitMask<uint64_t, kWidth, 3>(
+        vget_lane_u64(vreinterpret_u64_u8(matches), 0) & kMsbs);
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmpty() const {
+    return Match(static_cast<h2_t>(kEmpty));
+  }
+
+  uint8x8_t ctrl;
+};
+#endif  // V8_SWISS_TABLE_HAVE_NEON_HOST
+
 // Determine which Group implementation SwissNameDictionary uses.
 #if defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG
 // TODO(v8:11388) If v8_enable_swiss_name_dictionary is enabled, we are supposed
@@ -353,6 +397,10 @@ using Group = GroupSse2Impl;
 #endif
 using Group = GroupSse2Polyfill;
 #endif
+#elif V8_SWISS_TABLE_HAVE_NEON_HOST
+// GroupNeonImpl has the same group width as GroupPortableImpl, so it doesn't
+// matter which target the snapshot is created for.
+using Group = GroupNeonImpl;
 #else
 using Group = GroupPortableImpl;
 #endif
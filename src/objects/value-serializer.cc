@@ -6,6 +6,7 @@
 
 #include <type_traits>
 
+#include "include/v8-array-buffer.h"
 #include "include/v8-maybe.h"
 #include "include/v8-value-serializer-version.h"
 #include "include/v8-value-serializer.h"
@@ -148,6 +149,11 @@ enum class SerializationTag : uint8_t {
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
   kEndJSObject = '{',
+  // A JS object whose property keys are given by a shape. shapeID:uint32_t
+  // If shapeID is the number of shapes read so far, it defines a new shape and
+  // is followed by numKeys:uint32_t and that many string keys. Then come the
+  // values of the properties, in the order of the keys.
+  kShapedJSObject = 'h',
   // Beginning of a sparse JS array. length:uint32_t
   // Elements and properties are written as key/value pairs, like objects.
   kBeginSparseJSArray = 'a',
@@ -196,6 +202,9 @@ enum class SerializationTag : uint8_t {
   kArrayBufferView = 'V',
   // Shared array buffer. transferID:uint32_t
   kSharedArrayBuffer = 'u',
+  // Array buffer whose backing store is passed out of band by the delegate.
+  // backingStoreID:uint32_t
+  kArrayBufferBackingStore = 'j',
   // A HeapObject shared across Isolates. sharedValueID:uint32_t
   kSharedObject = 'p',
   // A wasm module object transfer. next value is its index.
@@ -293,7 +302,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {
+                                 ZoneAllocationPolicy(&zone_)),
+      shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {
   if (delegate_) {
     v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
     has_custom_host_objects_ = delegate_->HasCustomHostObject(v8_isolate);
@@ -319,6 +329,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetUseObjectShapes(bool mode) {
+  use_object_shapes_ = mode;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -669,6 +683,9 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   const bool can_serialize_fast =
       object->HasFastProperties(isolate_) && object->elements()->length() == 0;
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
+  if (use_object_shapes_ && CanWriteShapedJSObject(object->map())) {
+    return WriteShapedJSObject(object);
+  }
 
   DirectHandle<Map> map(object->map(), isolate_);
   WriteTag(SerializationTag::kBeginJSObject);
@@ -712,6 +729,60 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+// Objects can be written with a shape if all of their enumerable string-keyed
+// properties are data fields, which can be read without side effects.
+bool ValueSerializer::CanWriteShapedJSObject(Tagged<Map> map) {
+  if (shape_map_.Find(map)) return true;
+  DisallowGarbageCollection no_gc;
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate_);
+  bool has_keys = false;
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (!IsString(descriptors->GetKey(i), isolate_)) continue;
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.IsDontEnum()) continue;
+    if (details.location() != PropertyLocation::kField) return false;
+    DCHECK_EQ(PropertyKind::kData, details.kind());
+    has_keys = true;
+  }
+  return has_keys;
+}
+
+Maybe<bool> ValueSerializer::WriteShapedJSObject(
+    DirectHandle<JSObject> object) {
+  DirectHandle<Map> map(object->map(), isolate_);
+  auto find_result = shape_map_.FindOrInsert(*map);
+  const bool is_new_shape = !find_result.already_exists;
+  if (is_new_shape) *find_result.entry = next_shape_id_++;
+  WriteTag(SerializationTag::kShapedJSObject);
+  WriteVarint<uint32_t>(*find_result.entry);
+
+  // Read all values before writing any of them, since writing a value may
+  // call into the delegate, which could change the object and its map.
+  base::SmallVector<Handle<String>, 16> keys;
+  base::SmallVector<Handle<Object>, 16> values;
+  DirectHandle<DescriptorArray> descriptors(map->instance_descriptors(isolate_),
+                                            isolate_);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (!IsString(descriptors->GetKey(i), isolate_)) continue;
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.IsDontEnum()) continue;
+    if (is_new_shape) {
+      keys.push_back(handle(Cast<String>(descriptors->GetKey(i)), isolate_));
+    }
+    FieldIndex field_index = FieldIndex::ForDetails(*map, details);
+    values.push_back(handle(object->RawFastPropertyAt(field_index), isolate_));
+  }
+
+  if (is_new_shape) {
+    WriteVarint<uint32_t>(static_cast<uint32_t>(keys.size()));
+    for (Handle<String> key : keys) WriteString(key);
+  }
+  for (Handle<Object> value : values) {
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObjectSlow(Handle<JSObject> object) {
   WriteTag(SerializationTag::kBeginJSObject);
   Handle<FixedArray> keys;
@@ -977,6 +1048,19 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     return ThrowDataCloneError(
         MessageTemplate::kDataCloneErrorDetachedArrayBuffer);
   }
+  if (delegate_ && !array_buffer->is_resizable_by_js() &&
+      array_buffer->is_detachable()) {
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    uint32_t backing_store_id;
+    Maybe<bool> is_out_of_band = delegate_->GetBackingStoreId(
+        v8_isolate, Utils::ToLocal(array_buffer), &backing_store_id);
+    RETURN_VALUE_IF_EXCEPTION(isolate_, Nothing<bool>());
+    if (is_out_of_band.FromJust()) {
+      WriteTag(SerializationTag::kArrayBufferBackingStore);
+      WriteVarint(backing_store_id);
+      return ThrowIfOutOfMemory();
+    }
+  }
   size_t byte_length = array_buffer->byte_length();
   if (byte_length > std::numeric_limits<uint32_t>::max()) {
     return ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
@@ -1300,6 +1384,11 @@ ValueDeserializer::~ValueDeserializer() {
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
     GlobalHandles::Destroy(transfer_map_handle.location());
   }
+
+  Handle<Object> shape_table_handle;
+  if (shape_table_.ToHandle(&shape_table_handle)) {
+    GlobalHandles::Destroy(shape_table_handle.location());
+  }
 }
 
 Maybe<bool> ValueDeserializer::ReadHeader() {
@@ -1610,6 +1699,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     }
     case SerializationTag::kBeginJSObject:
       return ReadJSObject();
+    case SerializationTag::kShapedJSObject:
+      return ReadShapedJSObject();
     case SerializationTag::kBeginSparseJSArray:
       return ReadSparseJSArray();
     case SerializationTag::kBeginDenseJSArray:
@@ -1641,6 +1732,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kArrayBufferBackingStore:
+      return ReadOutOfBandJSArrayBuffer();
     case SerializationTag::kSharedArrayBuffer: {
       constexpr bool is_shared = true;
       constexpr bool is_resizable = false;
@@ -2092,6 +2185,26 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadOutOfBandJSArrayBuffer() {
+  uint32_t id = next_id_++;
+  uint32_t backing_store_id;
+  if (!ReadVarint<uint32_t>().To(&backing_store_id) || delegate_ == nullptr) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  std::shared_ptr<v8::BackingStore> backing_store =
+      delegate_->GetBackingStoreFromId(v8_isolate, backing_store_id);
+  RETURN_EXCEPTION_IF_EXCEPTION(isolate_);
+  if (!backing_store || backing_store->IsShared() ||
+      backing_store->IsResizableByUserJavaScript()) {
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer = Utils::OpenHandle(
+      *v8::ArrayBuffer::New(v8_isolate, std::move(backing_store)));
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     DirectHandle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->GetByteLength());
@@ -2586,6 +2699,129 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
   }
 }
 
+MaybeHandle<JSObject> ValueDeserializer::ReadShapedJSObject() {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  uint32_t shape_id;
+  if (!ReadVarint<uint32_t>().To(&shape_id) || shape_id > num_shapes_ ||
+      (shape_id == num_shapes_ && !ReadJSObjectShape())) {
+    return MaybeHandle<JSObject>();
+  }
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function());
+  AddObjectWithID(id, object);
+
+  DirectHandle<FixedArray> keys(
+      Cast<FixedArray>(shape_table_.ToHandleChecked()->get(2 * shape_id)),
+      isolate_);
+  std::vector<Handle<Object>> values;
+  values.reserve(keys->length());
+  for (int i = 0; i < keys->length(); i++) {
+    Handle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return MaybeHandle<JSObject>();
+    values.push_back(value);
+  }
+
+  // Objects with the same shape usually end up with the same map, so reuse
+  // the map of the previous one if the values fit its fields.
+  Handle<Map> map;
+  if (GetShapeMap(shape_id, values).ToHandle(&map)) {
+    CommitProperties(object, map, values);
+  } else {
+    for (int i = 0; i < keys->length(); i++) {
+      PropertyKey lookup_key(isolate_,
+                             handle(Cast<String>(keys->get(i)), isolate_));
+      LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+      if (it.state() != LookupIterator::NOT_FOUND ||
+          JSObject::DefineOwnPropertyIgnoreAttributes(&it, values[i], NONE)
+              .is_null()) {
+        return MaybeHandle<JSObject>();
+      }
+    }
+    if (!object->map()->is_dictionary_map()) {
+      shape_table_.ToHandleChecked()->set(2 * shape_id + 1, object->map());
+    }
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
+bool ValueDeserializer::ReadJSObjectShape() {
+  uint32_t num_keys;
+  if (!ReadVarint<uint32_t>().To(&num_keys) || num_keys == 0 ||
+      num_keys > static_cast<size_t>(end_ - position_)) {
+    return false;
+  }
+  HandleScope scope(isolate_);
+  Handle<FixedArray> keys = isolate_->factory()->NewFixedArray(num_keys);
+  for (uint32_t i = 0; i < num_keys; i++) {
+    Handle<String> key;
+    if (!ReadString().ToHandle(&key)) return false;
+    keys->set(i, *isolate_->factory()->InternalizeString(key));
+  }
+
+  Handle<FixedArray> shape_table;
+  if (!shape_table_.ToHandle(&shape_table)) {
+    shape_table = isolate_->factory()->empty_fixed_array();
+  }
+  uint32_t index = 2 * num_shapes_;
+  Handle<FixedArray> new_table =
+      FixedArray::SetAndGrow(isolate_, shape_table, index, keys);
+  new_table = FixedArray::SetAndGrow(isolate_, new_table, index + 1,
+                                     isolate_->factory()->undefined_value());
+
+  // If the table was reallocated, update the global handle.
+  if (!new_table.is_identical_to(shape_table)) {
+    if (!shape_table_.is_null()) {
+      GlobalHandles::Destroy(shape_table.location());
+    }
+    shape_table_ = isolate_->global_handles()->Create(*new_table);
+  }
+  num_shapes_++;
+  return true;
+}
+
+// Returns the map of the last object read with this shape if |values| can be
+// stored into its fields directly, generalizing field types where needed.
+MaybeHandle<Map> ValueDeserializer::GetShapeMap(
+    uint32_t shape_id, const std::vector<Handle<Object>>& values) {
+  Tagged<Object> cached_map =
+      shape_table_.ToHandleChecked()->get(2 * shape_id + 1);
+  if (!IsMap(cached_map)) return MaybeHandle<Map>();
+  Handle<Map> map =
+      Map::Update(isolate_, handle(Cast<Map>(cached_map), isolate_));
+  if (map->is_dictionary_map() ||
+      map->NumberOfOwnDescriptors() != static_cast<int>(values.size())) {
+    return MaybeHandle<Map>();
+  }
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    PropertyDetails details =
+        map->instance_descriptors(isolate_)->GetDetails(i);
+    if (details.location() != PropertyLocation::kField) {
+      return MaybeHandle<Map>();
+    }
+    Handle<Object> value = values[i.as_int()];
+    Representation representation = details.representation();
+    if (!Object::FitsRepresentation(*value, representation)) {
+      return MaybeHandle<Map>();
+    }
+    if (representation.IsHeapObject() &&
+        !FieldType::NowContains(
+            map->instance_descriptors(isolate_)->GetFieldType(i), value)) {
+      Handle<FieldType> value_type =
+          Object::OptimalType(*value, isolate_, representation);
+      MapUpdater::GeneralizeField(isolate_, map, i, details.constness(),
+                                  representation, value_type);
+    }
+  }
+  return map;
+}
+
 bool ValueDeserializer::HasObjectWithID(uint32_t id) {
   return id < static_cast<unsigned>(id_map_->length()) &&
          !IsTheHole(id_map_->get(id), isolate_);
@@ -97,6 +97,12 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Indicate whether to write the keys of fast-mode objects once per map and
+   * only their values afterwards. See v8::ValueSerializer::SetUseObjectShapes.
+   */
+  void SetUseObjectShapes(bool mode);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -122,6 +128,9 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObjectSlow(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
+  bool CanWriteShapedJSObject(Tagged<Map> map);
+  Maybe<bool> WriteShapedJSObject(DirectHandle<JSObject> object)
+      V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArray(Handle<JSArray> array) V8_WARN_UNUSED_RESULT;
   void WriteJSDate(Tagged<JSDate> date);
   Maybe<bool> WriteJSPrimitiveWrapper(DirectHandle<JSPrimitiveWrapper> value)
@@ -177,6 +186,7 @@ class ValueSerializer {
   size_t buffer_capacity_ = 0;
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  bool use_object_shapes_ = false;
   bool out_of_memory_ = false;
   Zone zone_;
 
@@ -189,6 +199,10 @@ class ValueSerializer {
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
+  // Maps the maps of objects written with kShapedJSObject to their shape IDs.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> shape_map_;
+  uint32_t next_shape_id_ = 0;
+
   // The conveyor used to keep shared objects alive.
   SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
 };
@@ -285,6 +299,10 @@ class ValueDeserializer {
   MaybeHandle<String> ReadTwoByteString(
       AllocationType allocation = AllocationType::kYoung) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadShapedJSObject() V8_WARN_UNUSED_RESULT;
+  bool ReadJSObjectShape() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<Map> GetShapeMap(uint32_t shape_id,
+                               const std::vector<Handle<Object>>& values);
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
@@ -295,6 +313,8 @@ class ValueDeserializer {
   MaybeHandle<JSSet> ReadJSSet() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadJSArrayBuffer(
       bool is_shared, bool is_resizable) V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadOutOfBandJSArrayBuffer()
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
@@ -335,6 +355,9 @@ class ValueDeserializer {
   // Always global handles.
   Handle<FixedArray> id_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
+  // Pairs of (keys, map or undefined) for every shape read so far.
+  MaybeHandle<FixedArray> shape_table_;
+  uint32_t num_shapes_ = 0;
 
   // The conveyor used to keep shared objects alive.
   const SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
@@ -5,10 +5,13 @@
 #ifndef V8_PARSING_LITERAL_BUFFER_H_
 #define V8_PARSING_LITERAL_BUFFER_H_
 
+#include <algorithm>
+
 #include "include/v8config.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/strings/unicode-decoder.h"
+#include "src/utils/memcopy.h"
 
 namespace v8 {
 namespace internal {
@@ -38,6 +41,23 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds |length| ASCII code units at once, e.g. straight from the buffer
+  // of a character stream.
+  V8_INLINE void AddAsciiChars(const uint16_t* chars, int length) {
+    DCHECK(std::all_of(chars, chars + length, [](uint16_t c) {
+      return c <= unibrow::Utf8::kMaxOneByteChar;
+    }));
+    int byte_length = is_one_byte() ? length : length * base::kUC16Size;
+    while (position_ + byte_length > backing_store_.length()) ExpandBuffer();
+    if (is_one_byte()) {
+      CopyChars(&backing_store_[position_], chars, length);
+    } else {
+      CopyChars(reinterpret_cast<uint16_t*>(&backing_store_[position_]), chars,
+                length);
+    }
+    position_ += byte_length;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
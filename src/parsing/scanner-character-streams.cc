@@ -52,6 +52,19 @@ namespace {
 const unibrow::uchar kUtf8Bom = 0xFEFF;
 }  // namespace
 
+// Frees the data of a chunk returned by ExternalSourceStream::GetMoreData,
+// unless the source stream kept ownership of it.
+template <typename Char>
+struct ChunkDeleter {
+  void operator()(const Char* data) const {
+    if (owns_data) delete[] data;
+  }
+  bool owns_data;
+};
+
+template <typename Char>
+using ChunkData = std::unique_ptr<const Char[], ChunkDeleter<Char>>;
+
 template <typename Char>
 struct Range {
   const Char* start;
@@ -174,9 +187,12 @@ class ChunkedStream {
 
  private:
   struct Chunk {
-    Chunk(const Char* const data, size_t position, size_t length)
-        : data(data), position(position), length(length) {}
-    std::unique_ptr<const Char[]> data;
+    Chunk(const Char* const data, bool owns_data, size_t position,
+          size_t length)
+        : data(data, ChunkDeleter<Char>{owns_data}),
+          position(position),
+          length(length) {}
+    ChunkData<Char> data;
     // The logical position of data.
     const size_t position;
     const size_t length;
@@ -201,12 +217,12 @@ class ChunkedStream {
     UNREACHABLE();
   }
 
-  virtual void ProcessChunk(const uint8_t* data, size_t position,
-                            size_t length) {
+  virtual void ProcessChunk(const uint8_t* data, bool owns_data,
+                            size_t position, size_t length) {
     // Incoming data has to be aligned to Char size.
     DCHECK_EQ(0, length % sizeof(Char));
-    chunks_->emplace_back(reinterpret_cast<const Char*>(data), position,
-                          length / sizeof(Char));
+    chunks_->emplace_back(reinterpret_cast<const Char*>(data), owns_data,
+                          position, length / sizeof(Char));
   }
 
   void FetchChunk(size_t position, RuntimeCallStats* stats) {
@@ -220,7 +236,7 @@ class ChunkedStream {
       RCS_SCOPE(stats, RuntimeCallCounterId::kGetMoreDataCallback);
       length = source_->GetMoreData(&data);
     }
-    ProcessChunk(data, position, length);
+    ProcessChunk(data, source_->TransfersChunkOwnership(), position, length);
   }
 
   ScriptCompiler::ExternalSourceStream* source_;
@@ -559,9 +575,12 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
   // - The chunk data (data pointer and length), and
   // - the position at the first byte of the chunk.
   struct Chunk {
-    Chunk(const uint8_t* data, size_t length, StreamPosition start)
-        : data(data), length(length), start(start) {}
-    std::unique_ptr<const uint8_t[]> data;
+    Chunk(const uint8_t* data, bool owns_data, size_t length,
+          StreamPosition start)
+        : data(data, ChunkDeleter<uint8_t>{owns_data}),
+          length(length),
+          start(start) {}
+    ChunkData<uint8_t> data;
     size_t length;
     StreamPosition start;
   };
@@ -740,7 +759,8 @@ bool Utf8ExternalStreamingStream::FetchChunk() {
 
   const uint8_t* chunk = nullptr;
   size_t length = source_stream_->GetMoreData(&chunk);
-  chunks_->emplace_back(chunk, length, current_.pos);
+  chunks_->emplace_back(chunk, source_stream_->TransfersChunkOwnership(),
+                        length, current_.pos);
   return length > 0;
 }
 
@@ -277,7 +277,7 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](base::uc32 c0) {
+      AdvanceUntilAddingAsciiLiteralChars([&scan_flags](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
           // path.
@@ -289,12 +289,7 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
         }
         uint8_t char_flags = character_scan_flags[c0];
         scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
-        }
+        return TerminatesLiteral(char_flags);
       });
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
@@ -95,6 +95,32 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil above, but also hands every run of characters that it
+  // skips over to |take| as a [start, end) range of the buffer, so that the
+  // caller can process the run in bulk instead of from |check|.
+  template <typename FunctionType, typename RunType>
+  V8_INLINE base::uc32 AdvanceUntil(FunctionType check, RunType take) {
+    while (true) {
+      auto next_cursor_pos =
+          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
+            base::uc32 c0_ = static_cast<base::uc32>(raw_c0_);
+            return check(c0_);
+          });
+      take(buffer_cursor_, next_cursor_pos);
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked(pos())) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<base::uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -536,6 +562,11 @@ class V8_EXPORT_PRIVATE Scanner {
 
   V8_INLINE void AddLiteralChar(char c) { next().literal_chars.AddChar(c); }
 
+  V8_INLINE void AddAsciiLiteralChars(const uint16_t* start,
+                                      const uint16_t* end) {
+    next().literal_chars.AddAsciiChars(start, static_cast<int>(end - start));
+  }
+
   V8_INLINE void AddRawLiteralChar(base::uc32 c) {
     next().raw_literal_chars.AddChar(c);
   }
@@ -559,6 +590,16 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  // Advances over ASCII characters that are part of the current literal,
+  // adding them to it in bulk.
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntilAddingAsciiLiteralChars(FunctionType check) {
+    c0_ = source_->AdvanceUntil(
+        check, [this](const uint16_t* start, const uint16_t* end) {
+          AddAsciiLiteralChars(start, end);
+        });
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
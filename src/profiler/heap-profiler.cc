@@ -116,9 +116,17 @@ const char* HeapProfiler::CopyNameForHeapSnapshot(const char* name) {
 
 HeapSnapshot* HeapProfiler::TakeSnapshot(
     const v8::HeapProfiler::HeapSnapshotOptions options) {
+  std::unique_ptr<HeapSnapshot> result = GenerateSnapshot(options);
+  if (!result) return nullptr;
+  snapshots_.push_back(std::move(result));
+  return snapshots_.back().get();
+}
+
+std::unique_ptr<HeapSnapshot> HeapProfiler::GenerateSnapshot(
+    const v8::HeapProfiler::HeapSnapshotOptions& options) {
   is_taking_snapshot_ = true;
-  HeapSnapshot* result =
-      new HeapSnapshot(this, options.snapshot_mode, options.numerics_mode);
+  std::unique_ptr<HeapSnapshot> result = std::make_unique<HeapSnapshot>(
+      this, options.snapshot_mode, options.numerics_mode);
 
   // We need a stack marker here to allow deterministic passes over the stack.
   // The garbage collection and the filling of references in GenerateSnapshot
@@ -129,15 +137,10 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
       use_cpp_class_name.emplace(heap()->cpp_heap());
     }
 
-    HeapSnapshotGenerator generator(result, options.control,
+    HeapSnapshotGenerator generator(result.get(), options.control,
                                     options.global_object_name_resolver, heap(),
                                     options.stack_state);
-    if (!generator.GenerateSnapshot()) {
-      delete result;
-      result = nullptr;
-    } else {
-      snapshots_.emplace_back(result);
-    }
+    if (!generator.GenerateSnapshot()) result.reset();
   });
   ids_->RemoveDeadEntries();
   if (native_move_listener_) {
@@ -181,7 +184,8 @@ void HeapProfiler::WriteSnapshotToDiskAfterGC() {
                                     options.stack_state);
     if (!generator.GenerateSnapshotAfterGC()) return;
     FileOutputStream stream(filename.c_str());
-    HeapSnapshotJSONSerializer serializer(result.get());
+    HeapSnapshotJSONSerializer serializer(
+        result.get(), HeapSnapshotJSONSerializer::GraphMode::kRelease);
     serializer.Serialize(&stream);
     PrintF("Wrote heap snapshot to %s.\n", filename.c_str());
   });
@@ -189,10 +193,21 @@ void HeapProfiler::WriteSnapshotToDiskAfterGC() {
 
 void HeapProfiler::TakeSnapshotToFile(
     const v8::HeapProfiler::HeapSnapshotOptions options, std::string filename) {
-  HeapSnapshot* snapshot = TakeSnapshot(options);
   FileOutputStream stream(filename.c_str());
-  HeapSnapshotJSONSerializer serializer(snapshot);
-  serializer.Serialize(&stream);
+  TakeSnapshotToStream(options, &stream);
+}
+
+bool HeapProfiler::TakeSnapshotToStream(
+    const v8::HeapProfiler::HeapSnapshotOptions options,
+    v8::OutputStream* stream) {
+  std::unique_ptr<HeapSnapshot> snapshot = GenerateSnapshot(options);
+  if (!snapshot) return false;
+  HeapSnapshotJSONSerializer serializer(
+      snapshot.get(), HeapSnapshotJSONSerializer::GraphMode::kRelease);
+  serializer.Serialize(stream);
+  snapshot.reset();
+  MaybeClearStringsStorage();
+  return true;
 }
 
 bool HeapProfiler::StartSamplingHeapProfiler(
@@ -66,6 +66,10 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   // Just takes a snapshot performing GC as part of the snapshot.
   void TakeSnapshotToFile(const v8::HeapProfiler::HeapSnapshotOptions options,
                           std::string filename);
+  // Takes a snapshot and serializes it to |stream| without retaining it. The
+  // snapshot graph is released while it is being serialized.
+  bool TakeSnapshotToStream(const v8::HeapProfiler::HeapSnapshotOptions options,
+                            v8::OutputStream* stream);
 
   bool StartSamplingHeapProfiler(uint64_t sample_interval, int stack_depth,
                                  v8::HeapProfiler::SamplingFlags);
@@ -140,6 +144,11 @@ class HeapProfiler : public HeapObjectAllocationTracker {
  private:
   void MaybeClearStringsStorage();
 
+  // Generates a snapshot without registering it with the profiler. Returns
+  // nullptr if generation was aborted.
+  std::unique_ptr<HeapSnapshot> GenerateSnapshot(
+      const v8::HeapProfiler::HeapSnapshotOptions& options);
+
   Heap* heap() const;
 
   // Mapping from HeapObject addresses to objects' uids.
@@ -4,6 +4,7 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <algorithm>
 #include <optional>
 #include <utility>
 
@@ -506,6 +507,18 @@ void HeapSnapshot::FillChildren() {
   }
 }
 
+void HeapSnapshot::ReleaseGraph() {
+  root_entry_ = nullptr;
+  gc_roots_entry_ = nullptr;
+  std::fill(std::begin(gc_subroot_entries_), std::end(gc_subroot_entries_),
+            nullptr);
+  // Swap with empty containers, clear() does not return the memory.
+  std::unordered_map<SnapshotObjectId, HeapEntry*>().swap(entries_by_id_cache_);
+  std::vector<HeapGraphEdge*>().swap(children_);
+  std::deque<HeapGraphEdge>().swap(edges_);
+  std::deque<HeapEntry>().swap(entries_);
+}
+
 HeapEntry* HeapSnapshot::GetEntryById(SnapshotObjectId id) {
   if (entries_by_id_cache_.empty()) {
     CHECK(is_complete());
@@ -3276,6 +3289,8 @@ void HeapSnapshotJSONSerializer::SerializeImpl() {
   SerializeEdges();
   if (writer_->aborted()) return;
   writer_->AddString("],\n");
+  // None of the remaining sections refer to nodes or edges.
+  if (graph_mode_ == GraphMode::kRelease) snapshot_->ReleaseGraph();
 
   writer_->AddString("\"trace_function_infos\":[");
   SerializeTraceNodeInfos();
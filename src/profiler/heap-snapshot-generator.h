@@ -264,6 +264,9 @@ class HeapSnapshot {
   void AddSyntheticRootEntries();
   HeapEntry* GetEntryById(SnapshotObjectId id);
   void FillChildren();
+  // Frees all nodes and edges. Only locations, script line ends and the
+  // snapshot's metadata remain accessible afterwards.
+  void ReleaseGraph();
 
   void AddScriptLineEnds(int script_id, String::LineEndsVector&& line_ends);
   String::LineEndsVector& GetScriptLineEnds(int script_id);
@@ -732,8 +735,18 @@ class OutputStreamWriter;
 
 class HeapSnapshotJSONSerializer {
  public:
-  explicit HeapSnapshotJSONSerializer(HeapSnapshot* snapshot)
+  enum class GraphMode {
+    // The snapshot is left intact and can be serialized again.
+    kKeep,
+    // Nodes and edges are released as soon as they are written, which lowers
+    // the peak memory usage of one-shot serialization.
+    kRelease,
+  };
+
+  explicit HeapSnapshotJSONSerializer(HeapSnapshot* snapshot,
+                                      GraphMode graph_mode = GraphMode::kKeep)
       : snapshot_(snapshot),
+        graph_mode_(graph_mode),
         strings_(StringsMatch),
         next_node_id_(1),
         next_string_id_(1),
@@ -773,6 +786,7 @@ class HeapSnapshotJSONSerializer {
   static const int kNodeFieldsCount;
 
   HeapSnapshot* snapshot_;
+  const GraphMode graph_mode_;
   base::CustomMatcherHashMap strings_;
   int next_node_id_;
   int next_string_id_;
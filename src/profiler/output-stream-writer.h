@@ -61,6 +61,11 @@ class OutputStreamWriter {
   void AddSubstring(const char* s, int n) {
     if (n <= 0) return;
     DCHECK_LE(n, strlen(s));
+    AddBytes(s, n);
+  }
+  // Like AddSubstring, but |s| may contain '\0', as in binary formats.
+  void AddBytes(const char* s, int n) {
+    if (n <= 0) return;
     const char* s_end = s + n;
     while (s < s_end) {
       int s_chunk_size =
@@ -5,6 +5,7 @@
 #include "src/profiler/profile-generator.h"
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 #include "include/v8-profiler.h"
@@ -919,6 +920,198 @@ void CpuProfileJSONSerializer::SerializeImpl() {
   writer_->Finalize();
 }
 
+namespace {
+
+// Field numbers and wire types of the pprof profile.proto messages.
+constexpr int kProfileSampleType = 1;
+constexpr int kProfileSample = 2;
+constexpr int kProfileLocation = 4;
+constexpr int kProfileFunction = 5;
+constexpr int kProfileStringTable = 6;
+constexpr int kProfileDurationNanos = 10;
+constexpr int kProfilePeriodType = 11;
+constexpr int kProfilePeriod = 12;
+constexpr int kValueTypeType = 1;
+constexpr int kValueTypeUnit = 2;
+constexpr int kSampleLocationId = 1;
+constexpr int kSampleValue = 2;
+constexpr int kLocationId = 1;
+constexpr int kLocationLine = 4;
+constexpr int kLineFunctionId = 1;
+constexpr int kLineLine = 2;
+constexpr int kFunctionId = 1;
+constexpr int kFunctionName = 2;
+constexpr int kFunctionSystemName = 3;
+constexpr int kFunctionFilename = 4;
+constexpr int kFunctionStartLine = 5;
+
+constexpr int kWireTypeVarint = 0;
+constexpr int kWireTypeLengthDelimited = 2;
+
+void AppendVarint(std::string* out, uint64_t value) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+void AppendTag(std::string* out, int field, int wire_type) {
+  AppendVarint(out, (static_cast<uint64_t>(field) << 3) | wire_type);
+}
+
+void AppendVarintField(std::string* out, int field, uint64_t value) {
+  AppendTag(out, field, kWireTypeVarint);
+  AppendVarint(out, value);
+}
+
+void AppendBytesField(std::string* out, int field, const char* data,
+                      size_t size) {
+  AppendTag(out, field, kWireTypeLengthDelimited);
+  AppendVarint(out, size);
+  out->append(data, size);
+}
+
+void AppendBytesField(std::string* out, int field, const std::string& data) {
+  AppendBytesField(out, field, data.data(), data.size());
+}
+
+}  // namespace
+
+void CpuProfilePprofSerializer::Serialize(v8::OutputStream* stream) {
+  DCHECK_NULL(writer_);
+  writer_ = new OutputStreamWriter(stream);
+  SerializeImpl();
+  delete writer_;
+  writer_ = nullptr;
+}
+
+void CpuProfilePprofSerializer::WriteMessage(int field,
+                                             const std::string& message) {
+  std::string header;
+  AppendTag(&header, field, kWireTypeLengthDelimited);
+  AppendVarint(&header, message.size());
+  writer_->AddBytes(header.data(), static_cast<int>(header.size()));
+  writer_->AddBytes(message.data(), static_cast<int>(message.size()));
+}
+
+int64_t CpuProfilePprofSerializer::GetStringId(const char* str) {
+  if (str == nullptr || str[0] == '\0') return 0;
+  auto it = string_ids_.find(str);
+  if (it != string_ids_.end()) return it->second;
+  // The string table is indexed by the order of its entries, so new strings
+  // can be emitted as soon as they are seen.
+  int64_t id = static_cast<int64_t>(string_ids_.size()) + 1;
+  string_ids_.emplace(str, id);
+  std::string entry;
+  AppendBytesField(&entry, kProfileStringTable, str, strlen(str));
+  writer_->AddBytes(entry.data(), static_cast<int>(entry.size()));
+  return id;
+}
+
+uint64_t CpuProfilePprofSerializer::GetFunctionId(
+    const v8::CpuProfileNode* node) {
+  int64_t name = GetStringId(node->GetFunctionNameStr());
+  int64_t filename = GetStringId(node->GetScriptResourceNameStr());
+  int line = node->GetLineNumber();
+  int column = node->GetColumnNumber();
+  auto key = std::make_tuple(name, filename, line, column);
+  auto it = function_ids_.find(key);
+  if (it != function_ids_.end()) return it->second;
+  uint64_t id = function_ids_.size() + 1;
+  function_ids_.emplace(key, id);
+
+  std::string function;
+  AppendVarintField(&function, kFunctionId, id);
+  AppendVarintField(&function, kFunctionName, name);
+  AppendVarintField(&function, kFunctionSystemName, name);
+  AppendVarintField(&function, kFunctionFilename, filename);
+  if (line > 0) AppendVarintField(&function, kFunctionStartLine, line);
+  WriteMessage(kProfileFunction, function);
+  return id;
+}
+
+void CpuProfilePprofSerializer::SerializeValueType(int field,
+                                                   const char* type,
+                                                   const char* unit) {
+  std::string value_type;
+  AppendVarintField(&value_type, kValueTypeType, GetStringId(type));
+  AppendVarintField(&value_type, kValueTypeUnit, GetStringId(unit));
+  WriteMessage(field, value_type);
+}
+
+void CpuProfilePprofSerializer::SerializeNode(const v8::CpuProfileNode* node,
+                                              std::vector<uint64_t>* stack) {
+  uint64_t location_id = node->GetNodeId();
+  uint64_t function_id = GetFunctionId(node);
+
+  std::string line;
+  AppendVarintField(&line, kLineFunctionId, function_id);
+  if (node->GetLineNumber() > 0) {
+    AppendVarintField(&line, kLineLine, node->GetLineNumber());
+  }
+  std::string location;
+  AppendVarintField(&location, kLocationId, location_id);
+  AppendBytesField(&location, kLocationLine, line);
+  WriteMessage(kProfileLocation, location);
+  if (writer_->aborted()) return;
+
+  stack->push_back(location_id);
+  unsigned hit_count = node->GetHitCount();
+  if (hit_count > 0) {
+    // Samples list their locations leaf first.
+    std::string location_ids;
+    for (auto it = stack->rbegin(); it != stack->rend(); ++it) {
+      AppendVarint(&location_ids, *it);
+    }
+    std::string values;
+    AppendVarint(&values, hit_count);
+    AppendVarint(&values, hit_count * profile_->sampling_interval_us() * 1000);
+    std::string sample;
+    AppendBytesField(&sample, kSampleLocationId, location_ids);
+    AppendBytesField(&sample, kSampleValue, values);
+    WriteMessage(kProfileSample, sample);
+  }
+  int count = node->GetChildrenCount();
+  for (int i = 0; i < count; i++) {
+    SerializeNode(node->GetChild(i), stack);
+    if (writer_->aborted()) return;
+  }
+  stack->pop_back();
+}
+
+void CpuProfilePprofSerializer::SerializeImpl() {
+  // The first entry of the string table must be the empty string.
+  std::string empty;
+  AppendBytesField(&empty, kProfileStringTable, "", 0);
+  writer_->AddBytes(empty.data(), static_cast<int>(empty.size()));
+
+  SerializeValueType(kProfileSampleType, "samples", "count");
+  SerializeValueType(kProfileSampleType, "cpu", "nanoseconds");
+
+  // The root node only groups the top-level frames and is not a location.
+  const v8::CpuProfileNode* root =
+      reinterpret_cast<const v8::CpuProfileNode*>(profile_->top_down()->root());
+  std::vector<uint64_t> stack;
+  int count = root->GetChildrenCount();
+  for (int i = 0; i < count; i++) {
+    SerializeNode(root->GetChild(i), &stack);
+    if (writer_->aborted()) return;
+  }
+
+  std::string tail;
+  AppendVarintField(
+      &tail, kProfileDurationNanos,
+      (profile_->end_time() - profile_->start_time()).InMicroseconds() * 1000);
+  writer_->AddBytes(tail.data(), static_cast<int>(tail.size()));
+  SerializeValueType(kProfilePeriodType, "cpu", "nanoseconds");
+  tail.clear();
+  AppendVarintField(&tail, kProfilePeriod,
+                    profile_->sampling_interval_us() * 1000);
+  writer_->AddBytes(tail.data(), static_cast<int>(tail.size()));
+  writer_->Finalize();
+}
+
 void CpuProfile::Print() const {
   base::OS::Print("[Top down]:\n");
   top_down_.Print();
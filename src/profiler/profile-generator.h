@@ -10,6 +10,8 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -624,6 +626,34 @@ class CpuProfileJSONSerializer {
   OutputStreamWriter* writer_;
 };
 
+// Writes a CpuProfile as an uncompressed pprof profile.proto message. The
+// message is streamed field by field while walking the top-down tree, so no
+// intermediate copy of the profile is built. Strings are interned by their
+// StringsStorage pointer and functions by name, script and position.
+class CpuProfilePprofSerializer {
+ public:
+  explicit CpuProfilePprofSerializer(CpuProfile* profile)
+      : profile_(profile), writer_(nullptr) {}
+  CpuProfilePprofSerializer(const CpuProfilePprofSerializer&) = delete;
+  CpuProfilePprofSerializer& operator=(const CpuProfilePprofSerializer&) =
+      delete;
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  int64_t GetStringId(const char* str);
+  uint64_t GetFunctionId(const v8::CpuProfileNode* node);
+  void SerializeValueType(int field, const char* type, const char* unit);
+  void SerializeNode(const v8::CpuProfileNode* node,
+                     std::vector<uint64_t>* stack);
+  void WriteMessage(int field, const std::string& message);
+  void SerializeImpl();
+
+  CpuProfile* profile_;
+  OutputStreamWriter* writer_;
+  std::unordered_map<const char*, int64_t> string_ids_;
+  std::map<std::tuple<int64_t, int64_t, int, int>, uint64_t> function_ids_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -10,9 +10,11 @@
 #include "src/api/api-inl.h"
 #include "src/base/ieee754.h"
 #include "src/base/utils/random-number-generator.h"
+#include "src/codegen/source-position-table.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap.h"
+#include "src/objects/deoptimization-data-inl.h"
 #include "src/profiler/strings-storage.h"
 
 namespace v8 {
@@ -147,10 +149,47 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
   return parent->AddChildNode(id, std::move(new_child));
 }
 
+namespace {
+
+// Returns the script offset |frame| is currently at. For optimized frames the
+// innermost position may belong to an inlined function, in which case the
+// position of the outermost inlined call is used so that the offset is always
+// within the function of |frame|.
+int FramePosition(Isolate* isolate, JavaScriptFrame* frame) {
+  if (!frame->is_optimized()) return frame->position();
+  Tagged<Code> code = frame->LookupCode();
+  if (!code->has_source_position_table()) return 0;
+  // Subtract one because the current PC is one instruction after the call.
+  int code_offset =
+      code->GetOffsetFromInstructionStart(isolate, frame->pc()) - 1;
+  SourcePosition position = SourcePosition::Unknown();
+  for (SourcePositionTableIterator it(
+           code->source_position_table(),
+           SourcePositionTableIterator::kJavaScriptOnly,
+           SourcePositionTableIterator::kDontSkipFunctionEntry);
+       !it.done() && it.code_offset() <= code_offset; it.Advance()) {
+    position = it.source_position();
+  }
+  if (!position.IsKnown()) return 0;
+  if (position.isInlined()) {
+    Tagged<DeoptimizationData> deopt_data =
+        Cast<DeoptimizationData>(code->deoptimization_data());
+    while (position.isInlined()) {
+      position =
+          deopt_data->InliningPositions()->get(position.InliningId()).position;
+    }
+  }
+  return position.ScriptOffset();
+}
+
+}  // namespace
+
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   AllocationNode* node = &profile_root_;
 
-  std::vector<Tagged<SharedFunctionInfo>> stack;
+  const bool include_positions =
+      flags_ & v8::HeapProfiler::kSamplingIncludeAllocationPositions;
+  std::vector<std::pair<Tagged<SharedFunctionInfo>, int>> stack;
   JavaScriptStackFrameIterator frame_it(isolate_);
   int frames_captured = 0;
   bool found_arguments_marker_frames = false;
@@ -163,7 +202,9 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
     // sensitive moment belong to the formerly optimized frame anyway.
     if (IsJSFunction(frame->unchecked_function())) {
       Tagged<SharedFunctionInfo> shared = frame->function()->shared();
-      stack.push_back(shared);
+      int position = include_positions ? FramePosition(isolate_, frame)
+                                       : shared->StartPosition();
+      stack.emplace_back(shared, position);
       frames_captured++;
     } else {
       found_arguments_marker_frames = true;
@@ -211,14 +252,14 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // We need to process the stack in reverse order as the top of the stack is
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
-    Tagged<SharedFunctionInfo> shared = *it;
+    Tagged<SharedFunctionInfo> shared = it->first;
     const char* name = this->names()->GetCopy(shared->DebugNameCStr().get());
     int script_id = v8::UnboundScript::kNoScriptId;
     if (IsScript(shared->script())) {
       Tagged<Script> script = Cast<Script>(shared->script());
       script_id = script->id();
     }
-    node = FindOrAddChildNode(node, name, script_id, shared->StartPosition());
+    node = FindOrAddChildNode(node, name, script_id, it->second);
   }
 
   if (found_arguments_marker_frames) {
@@ -4,11 +4,15 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
+#include <map>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
+#include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
@@ -225,6 +229,223 @@ class FilterGroups {
   base::Vector<const RegExpInstruction> bytecode_;
 };
 
+}  // namespace
+
+// A lazily constructed deterministic automaton for the main expression of a
+// bytecode program, used to rule out that there is any match at or after a
+// given input position before running the much slower `NfaInterpreter`.
+//
+// A DFA state is the set of CONSUME_RANGE instructions that NFA threads are
+// blocked at.  States and their transitions are only built when the input
+// needs them, and are kept in a cache of bounded size that is flushed when it
+// fills up.  If the cache is flushed too often, the DFA gives up and the
+// caller falls back to the NFA simulation.
+//
+// The DFA ignores registers and thread priorities, and assumes that all other
+// zero-width instructions (assertions, lookbehind reads, loop bookkeeping)
+// succeed.  It may therefore report a match where the NFA finds none, but
+// never the other way round, which is all a prefilter needs.
+class LazyDfa {
+ public:
+  // Special values of a state id.
+  static constexpr int kAccepting = -1;
+  static constexpr int kDead = -2;
+  static constexpr int kGaveUp = -3;
+
+  LazyDfa(base::Vector<const RegExpInstruction> bytecode, int max_states)
+      : bytecode_(bytecode.begin(), bytecode.end()),
+        max_states_(std::max(max_states, 1)),
+        visited_(bytecode.length(), 0) {
+    // Split the code units into classes that no CONSUME_RANGE distinguishes,
+    // so that transitions only need to be cached per class.
+    class_begin_.push_back(0);
+    for (const RegExpInstruction& inst : bytecode_) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (range.min > range.max) continue;
+      class_begin_.push_back(range.min);
+      if (range.max != 0xFFFF) class_begin_.push_back(range.max + 1);
+    }
+    std::sort(class_begin_.begin(), class_begin_.end());
+    class_begin_.erase(std::unique(class_begin_.begin(), class_begin_.end()),
+                       class_begin_.end());
+    for (int c = 0; c <= String::kMaxOneByteCharCode; ++c) {
+      one_byte_class_[c] = ClassOfSlow(c);
+    }
+  }
+
+  // Returns the state before any input has been consumed.
+  int Start() {
+    if (start_ == kUnknown) {
+      std::vector<int> seeds = {0};
+      start_ = AddState(seeds);
+    }
+    return start_;
+  }
+
+  // Returns the state after consuming `c` in the (regular) state `state`.
+  int Next(int state, base::uc16 c) {
+    DCHECK_GE(state, 0);
+    ++characters_since_flush_;
+    int klass = c <= String::kMaxOneByteCharCode ? one_byte_class_[c]
+                                                 : ClassOfSlow(c);
+    int next = states_[state].next[klass];
+    if (next != kUnknown) return next;
+
+    std::vector<int> seeds;
+    for (int pc : states_[state].pcs) {
+      RegExpInstruction::Uc16Range range = bytecode_[pc].payload.consume_range;
+      if (class_begin_[klass] >= range.min &&
+          class_begin_[klass] <= range.max) {
+        seeds.push_back(pc + 1);
+      }
+    }
+    const int flushes = flushes_;
+    next = AddState(seeds);
+    // Adding the state may have flushed the cache, including `state`.
+    if (flushes == flushes_) states_[state].next[klass] = next;
+    return next;
+  }
+
+ private:
+  static constexpr int kUnknown = -4;
+
+  // Flushing the cache is only worth it if enough input was consumed since the
+  // last flush; otherwise the DFA is thrashing.
+  static constexpr int kMinCharactersPerState = 10;
+
+  struct State {
+    // Sorted pcs of CONSUME_RANGE instructions.
+    std::vector<int> pcs;
+    // Indexed by character class.
+    std::vector<int> next;
+  };
+
+  int ClassOfSlow(int c) const {
+    auto it = std::upper_bound(class_begin_.begin(), class_begin_.end(), c);
+    DCHECK(it != class_begin_.begin());
+    return static_cast<int>(it - class_begin_.begin()) - 1;
+  }
+
+  // Returns the state of the threads that start at `seeds`, creating it if
+  // necessary.
+  int AddState(const std::vector<int>& seeds) {
+    std::vector<int> pcs;
+    if (AddClosure(seeds, &pcs)) return kAccepting;
+    if (pcs.empty()) return kDead;
+    std::sort(pcs.begin(), pcs.end());
+
+    auto it = state_ids_.find(pcs);
+    if (it != state_ids_.end()) return it->second;
+
+    if (static_cast<int>(states_.size()) == max_states_) {
+      if (characters_since_flush_ < kMinCharactersPerState * max_states_) {
+        return kGaveUp;
+      }
+      states_.clear();
+      state_ids_.clear();
+      start_ = kUnknown;
+      characters_since_flush_ = 0;
+      ++flushes_;
+    }
+
+    int id = static_cast<int>(states_.size());
+    states_.push_back(
+        State{pcs, std::vector<int>(class_begin_.size(), kUnknown)});
+    state_ids_.emplace(std::move(pcs), id);
+    return id;
+  }
+
+  // Collects the CONSUME_RANGE pcs reachable from `seeds` without consuming
+  // input in `pcs`.  Returns true if an ACCEPT is reachable.
+  bool AddClosure(const std::vector<int>& seeds, std::vector<int>* pcs) {
+    ++generation_;
+    std::vector<int> worklist(seeds);
+    while (!worklist.empty()) {
+      int pc = worklist.back();
+      worklist.pop_back();
+      SBXCHECK_BOUNDS(pc, bytecode_.size());
+      if (visited_[pc] == generation_) continue;
+      visited_[pc] = generation_;
+
+      const RegExpInstruction& inst = bytecode_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          if (inst.payload.consume_range.min <=
+              inst.payload.consume_range.max) {
+            pcs->push_back(pc);
+          }
+          break;
+        case RegExpInstruction::FORK:
+          worklist.push_back(inst.payload.pc);
+          worklist.push_back(pc + 1);
+          break;
+        case RegExpInstruction::JMP:
+          worklist.push_back(inst.payload.pc);
+          break;
+        case RegExpInstruction::ACCEPT:
+          return true;
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        case RegExpInstruction::BEGIN_LOOP:
+        case RegExpInstruction::END_LOOP:
+        case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+          worklist.push_back(pc + 1);
+          break;
+        case RegExpInstruction::FILTER_QUANTIFIER:
+        case RegExpInstruction::FILTER_GROUP:
+        case RegExpInstruction::FILTER_CHILD:
+        case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+          // Not reachable from the main expression.
+          UNREACHABLE();
+      }
+    }
+    return false;
+  }
+
+  const std::vector<RegExpInstruction> bytecode_;
+  const int max_states_;
+
+  // First code unit of each character class, sorted.
+  std::vector<int> class_begin_;
+  int one_byte_class_[String::kMaxOneByteCharCode + 1];
+
+  std::vector<State> states_;
+  std::map<std::vector<int>, int> state_ids_;
+  int start_ = kUnknown;
+
+  int characters_since_flush_ = 0;
+  int flushes_ = 0;
+
+  // visited_[pc] == generation_ iff pc was visited by the current closure.
+  std::vector<int> visited_;
+  int generation_ = 0;
+};
+
+ExperimentalRegExpDfaCache::ExperimentalRegExpDfaCache() = default;
+ExperimentalRegExpDfaCache::~ExperimentalRegExpDfaCache() = default;
+
+LazyDfa* ExperimentalRegExpDfaCache::GetOrCreate(
+    Tagged<TrustedByteArray> bytecode) {
+  auto it = dfas_.find(bytecode.address());
+  if (it != dfas_.end()) return it->second.get();
+  if (dfas_.size() == kMaxEntries) dfas_.clear();
+  DisallowGarbageCollection no_gc;
+  // The DFA keeps its own copy of the bytecode.
+  auto dfa = std::make_unique<LazyDfa>(
+      ToInstructionVector(bytecode, no_gc),
+      v8_flags.experimental_regexp_engine_lazy_dfa_max_states);
+  LazyDfa* result = dfa.get();
+  dfas_.emplace(bytecode.address(), std::move(dfa));
+  return result;
+}
+
+void ExperimentalRegExpDfaCache::Clear() { dfas_.clear(); }
+
+namespace {
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -357,6 +578,10 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    if (v8_flags.experimental_regexp_engine_lazy_dfa) {
+      dfa_ = isolate->experimental_regexp_dfa_cache()->GetOrCreate(bytecode);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -369,6 +594,13 @@ class NfaInterpreter {
 
     int match_num = 0;
     while (match_num != max_match_num) {
+      if (dfa_ != nullptr) {
+        bool may_match;
+        int err_code = DfaMayMatch(&may_match);
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+        if (!may_match) break;
+      }
+
       int err_code = FindNextMatch();
       if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
 
@@ -503,6 +735,8 @@ class NfaInterpreter {
         bytecode_ = ToInstructionVector(bytecode_object_, no_gc_);
         input_object_ = *input_handle;
         input_ = ToCharacterVector<Character>(input_object_, no_gc_);
+        // The GC may have cleared the DFA cache, and with it `dfa_`.
+        dfa_ = nullptr;
       }
     }
     return RegExp::kInternalRegExpSuccess;
@@ -516,6 +750,32 @@ class NfaInterpreter {
     input_index_ = new_input_index;
   }
 
+  // Runs `dfa_` on the input starting at `input_index_`.  Sets `*may_match` to
+  // false if there is certainly no match at or after `input_index_`.
+  int DfaMayMatch(bool* may_match) {
+    int state = dfa_->Start();
+    int index = input_index_;
+    while (state >= 0 && index != input_.length()) {
+      state = dfa_->Next(state, input_[index]);
+      ++index;
+
+      static constexpr int kTicksBetweenInterruptHandling = 64;
+      if (index % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+        if (dfa_ == nullptr) {
+          *may_match = true;
+          return RegExp::kInternalRegExpSuccess;
+        }
+      }
+    }
+    // The DFA is thrashing, so don't try again for later matches.
+    if (state == LazyDfa::kGaveUp) dfa_ = nullptr;
+    // A regular state at the end of the input can't accept anymore.
+    *may_match = state == LazyDfa::kAccepting || state == LazyDfa::kGaveUp;
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Find the next match and return the corresponding capture registers and
   // write its capture registers to `best_match_thread_`.  The search starts
   // at the current `input_index_`.  Returns RegExp::kInternalRegExpSuccess if
@@ -1091,6 +1351,11 @@ class NfaInterpreter {
 
   uint64_t memory_consumption_per_thread_;
 
+  // Prefilter that is run before each search if
+  // --experimental-regexp-engine-lazy-dfa is enabled.  Owned by the isolate's
+  // `ExperimentalRegExpDfaCache`, so that its states are kept across calls.
+  LazyDfa* dfa_ = nullptr;
+
   Zone* zone_;
 };
 
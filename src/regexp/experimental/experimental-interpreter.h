@@ -5,16 +5,46 @@
 #ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
 #define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
 
+#include <memory>
+#include <unordered_map>
+
 #include "src/regexp/experimental/experimental-bytecode.h"
 #include "src/regexp/regexp.h"
 
 namespace v8 {
 namespace internal {
 
+class LazyDfa;
 class TrustedByteArray;
 class String;
 class Zone;
 
+// The lazily built DFAs that prefilter the searches of experimental regexps
+// (see --experimental-regexp-engine-lazy-dfa), kept per bytecode program so
+// that their states are reused across executions.  Each DFA holds at most
+// --experimental-regexp-engine-lazy-dfa-max-states states, and the cache at
+// most `kMaxEntries` DFAs.  Entries are keyed by the address of the bytecode,
+// so the cache is cleared before each full GC.
+class ExperimentalRegExpDfaCache final {
+ public:
+  ExperimentalRegExpDfaCache();
+  ~ExperimentalRegExpDfaCache();
+  ExperimentalRegExpDfaCache(const ExperimentalRegExpDfaCache&) = delete;
+  ExperimentalRegExpDfaCache& operator=(const ExperimentalRegExpDfaCache&) =
+      delete;
+
+  // Returns the DFA for `bytecode`, creating it if necessary.  The result is
+  // valid until the next call to `Clear`.
+  LazyDfa* GetOrCreate(Tagged<TrustedByteArray> bytecode);
+
+  void Clear();
+
+ private:
+  static constexpr size_t kMaxEntries = 64;
+
+  std::unordered_map<Address, std::unique_ptr<LazyDfa>> dfas_;
+};
+
 class ExperimentalRegExpInterpreter final : public AllStatic {
  public:
   // Executes a bytecode program in breadth-first NFA mode, without
@@ -6,6 +6,8 @@
 
 #include "src/regexp/regexp-interpreter.h"
 
+#include <algorithm>
+
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/execution/isolate.h"
@@ -235,6 +237,26 @@ IrregexpInterpreter::Result MaybeThrowStackOverflow(
   }
 }
 
+// Returns the first index in [{from}, {subject}.length()) at which {subject}
+// contains {c}, or -1. Used for the common single-step case of the
+// SKIP_UNTIL_CHAR bytecodes, where memchr is much faster than a loop.
+template <typename Char>
+int FindCharacter(base::Vector<const Char> subject, int from, uint32_t c) {
+  DCHECK(base::IsInRange(from, 0, subject.length()));
+  if constexpr (sizeof(Char) == 1) {
+    if (c > String::kMaxOneByteCharCode) return -1;
+    const void* found = memchr(subject.begin() + from, static_cast<int>(c),
+                               subject.length() - from);
+    if (found == nullptr) return -1;
+    return static_cast<int>(static_cast<const Char*>(found) - subject.begin());
+  } else {
+    const Char* found =
+        std::find(subject.begin() + from, subject.end(), static_cast<Char>(c));
+    if (found == subject.end()) return -1;
+    return static_cast<int>(found - subject.begin());
+  }
+}
+
 template <typename Char>
 void UpdateCodeAndSubjectReferences(
     Isolate* isolate, DirectHandle<TrustedByteArray> code_array,
@@ -933,6 +955,21 @@ IrregexpInterpreter::Result RawMatch(
       int32_t load_offset = LoadPacked24Signed(insn);
       int32_t advance = Load16AlignedSigned(pc + 4);
       uint32_t c = Load16AlignedUnsigned(pc + 6);
+      if (advance == 1 &&
+          IndexIsInBounds(current + load_offset, subject.length())) {
+        int found = FindCharacter(subject, current + load_offset, c);
+        if (found >= 0) {
+          current_char = c;
+          SET_CURRENT_POSITION(found - load_offset);
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+        } else {
+          // Leave the registers as the loop below would.
+          current_char = subject[subject.length() - 1];
+          SET_CURRENT_POSITION(subject.length() - load_offset);
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+        }
+        DISPATCH();
+      }
       while (IndexIsInBounds(current + load_offset, subject.length())) {
         current_char = subject[current + load_offset];
         if (c == current_char) {
@@ -4,6 +4,13 @@
 
 #include "src/regexp/regexp.h"
 
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/strings.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
@@ -536,6 +543,73 @@ Handle<FixedArray> RegExp::CreateCaptureNameMap(
   return array;
 }
 
+namespace {
+
+// Irregexp bytecode doesn't refer to any heap objects, so the bytecode
+// compiled by one isolate can be reused by all other isolates of the process.
+// Native code embeds isolate-specific references and is not shared.
+class ProcessWideBytecodeCache {
+ public:
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count;
+    uint32_t backtrack_limit;
+  };
+
+  // The entries only depend on the inputs to RegExpImpl::Compile, apart from
+  // the sample subject, which only guides optimizations.
+  static std::string KeyFor(DirectHandle<String> pattern, RegExpFlags flags,
+                            bool is_one_byte, uint32_t backtrack_limit) {
+    std::string key;
+    auto append = [&key](const void* data, size_t size) {
+      key.append(reinterpret_cast<const char*>(data), size);
+    };
+    int flags_value = static_cast<int>(flags);
+    append(&flags_value, sizeof(flags_value));
+    append(&is_one_byte, sizeof(is_one_byte));
+    append(&backtrack_limit, sizeof(backtrack_limit));
+
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = pattern->GetFlatContent(no_gc);
+    DCHECK(content.IsFlat());
+    bool pattern_is_one_byte = content.IsOneByte();
+    append(&pattern_is_one_byte, sizeof(pattern_is_one_byte));
+    if (pattern_is_one_byte) {
+      base::Vector<const uint8_t> chars = content.ToOneByteVector();
+      append(chars.begin(), chars.length());
+    } else {
+      base::Vector<const base::uc16> chars = content.ToUC16Vector();
+      append(chars.begin(), chars.length() * sizeof(base::uc16));
+    }
+    return key;
+  }
+
+  bool Lookup(const std::string& key, Entry* entry) {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    *entry = it->second;
+    return true;
+  }
+
+  void Insert(std::string key, Entry entry) {
+    base::MutexGuard guard(&mutex_);
+    if (entries_.size() >= kMaxEntries) return;
+    entries_.emplace(std::move(key), std::move(entry));
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 1024;
+
+  base::Mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProcessWideBytecodeCache,
+                                GetProcessWideBytecodeCache)
+
+}  // namespace
+
 bool RegExpImpl::CompileIrregexp(Isolate* isolate,
                                  DirectHandle<IrRegExpData> re_data,
                                  Handle<String> sample_subject,
@@ -568,9 +642,41 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
   uint32_t backtrack_limit = re_data->backtrack_limit();
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, backtrack_limit);
+  const bool use_process_wide_cache =
+      v8_flags.regexp_process_wide_bytecode_cache &&
+      compile_data.compilation_target == RegExpCompilationTarget::kBytecode;
+  std::string cache_key;
+  ProcessWideBytecodeCache::Entry cache_entry;
+  if (use_process_wide_cache) {
+    cache_key = ProcessWideBytecodeCache::KeyFor(pattern, flags, is_one_byte,
+                                                 backtrack_limit);
+  }
+  bool compilation_succeeded;
+  if (use_process_wide_cache &&
+      GetProcessWideBytecodeCache()->Lookup(cache_key, &cache_entry)) {
+    Handle<TrustedByteArray> bytecode =
+        isolate->factory()->NewTrustedByteArray(
+            static_cast<int>(cache_entry.bytecode.size()));
+    MemCopy(bytecode->begin(), cache_entry.bytecode.data(),
+            cache_entry.bytecode.size());
+    compile_data.code = bytecode;
+    compile_data.register_count = cache_entry.register_count;
+    backtrack_limit = cache_entry.backtrack_limit;
+    compilation_succeeded = true;
+  } else {
+    compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, backtrack_limit);
+    if (use_process_wide_cache && compilation_succeeded) {
+      auto bytecode = Cast<TrustedByteArray>(compile_data.code);
+      cache_entry.bytecode.assign(bytecode->begin(),
+                                  bytecode->begin() + bytecode->length());
+      cache_entry.register_count = compile_data.register_count;
+      cache_entry.backtrack_limit = backtrack_limit;
+      GetProcessWideBytecodeCache()->Insert(std::move(cache_key),
+                                            std::move(cache_entry));
+    }
+  }
   if (!compilation_succeeded) {
     DCHECK(compile_data.error != RegExpError::kNone);
     RegExp::ThrowRegExpException(isolate, re_data, compile_data.error);
@@ -1135,8 +1241,14 @@ int32_t* RegExpGlobalCache::FetchNext() {
 
     int32_t* last_match =
         &register_array_[(current_match_index_ - 1) * registers_per_match_];
+    int last_start_index = last_match[0];
     int last_end_index = last_match[1];
 
+    // The previous batch was full, so there are likely many more matches.
+    // Let the next call to the matcher return more of them at once. This may
+    // free the old register array, so {last_match} must not be used after it.
+    MaybeGrowRegisterArray();
+
     switch (regexp_data_->type_tag()) {
       case RegExpData::Type::ATOM:
         num_matches_ = RegExpImpl::AtomExecRaw(
@@ -1153,7 +1265,6 @@ int32_t* RegExpGlobalCache::FetchNext() {
         break;
       }
       case RegExpData::Type::IRREGEXP: {
-        int last_start_index = last_match[0];
         if (last_start_index == last_end_index) {
           // Zero-length match. Advance by one code point.
           last_end_index = AdvanceZeroLength(last_end_index);
@@ -1195,6 +1306,29 @@ int32_t* RegExpGlobalCache::FetchNext() {
   }
 }
 
+void RegExpGlobalCache::MaybeGrowRegisterArray() {
+  // Atom and interpreted regexps only return one match per call.
+  if (max_matches_ == 1) return;
+  const int new_size =
+      std::min(2 * register_array_size_,
+               std::max(v8_flags.regexp_global_cache_max_registers.value(),
+                        Isolate::kJSRegexpStaticOffsetsVectorSize));
+  const int new_max_matches = new_size / registers_per_match_;
+  if (new_max_matches <= max_matches_) return;
+  DCHECK_GT(new_size, Isolate::kJSRegexpStaticOffsetsVectorSize);
+
+  // The last match of the previous batch must stay where it is, in case the
+  // next call fails and LastSuccessfulMatch() is asked for it.
+  int32_t* new_register_array = NewArray<int32_t>(new_size);
+  std::copy_n(register_array_, register_array_size_, new_register_array);
+  if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    DeleteArray(register_array_);
+  }
+  register_array_ = new_register_array;
+  register_array_size_ = new_size;
+  max_matches_ = new_max_matches;
+}
+
 int32_t* RegExpGlobalCache::LastSuccessfulMatch() {
   int index = current_match_index_ * registers_per_match_;
   if (num_matches_ == 0) {
@@ -196,6 +196,7 @@ class RegExpGlobalCache final {
 
  private:
   int AdvanceZeroLength(int last_index);
+  void MaybeGrowRegisterArray();
 
   int num_matches_;
   int max_matches_;
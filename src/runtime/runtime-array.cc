@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <vector>
+
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/protectors-inl.h"
@@ -211,6 +214,56 @@ RUNTIME_FUNCTION(Runtime_IsArray) {
   return isolate->heap()->ToBoolean(IsJSArray(obj));
 }
 
+// Sorts the first {length} elements of {work_array} the way the default
+// comparator of Array.prototype.sort would, if they are all Smis. Returns false
+// and leaves {work_array} untouched otherwise.
+RUNTIME_FUNCTION(Runtime_ArraySortSmisDefault) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  DirectHandle<FixedArray> work_array = args.at<FixedArray>(0);
+  int length = args.smi_value_at(1);
+  DCHECK_LE(length, work_array->length());
+
+  DisallowGarbageCollection no_gc;
+  Tagged<FixedArray> raw_work_array = *work_array;
+  std::vector<Tagged<Smi>> smis;
+  smis.reserve(length);
+  for (int i = 0; i < length; i++) {
+    Tagged<Object> element = raw_work_array->get(i);
+    if (!IsSmi(element)) return ReadOnlyRoots(isolate).false_value();
+    smis.push_back(Cast<Smi>(element));
+  }
+  auto less = [isolate](Tagged<Smi> x, Tagged<Smi> y) {
+    return Tagged<Smi>(Smi::LexicographicCompare(isolate, x, y)).value() < 0;
+  };
+  // Array.prototype.sort is stable.
+  std::stable_sort(smis.begin(), smis.end(), less);
+  for (int i = 0; i < length; i++) {
+    raw_work_array->set(i, smis[i]);
+  }
+  return ReadOnlyRoots(isolate).true_value();
+}
+
+// Drops the first {count} elements of {array}'s backing store by moving the
+// object start, as shift does in FastElementsAccessor::MoveElements. Returns
+// false and leaves {array} untouched if the heap cannot move the start.
+RUNTIME_FUNCTION(Runtime_ArrayLeftTrimElements) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  DirectHandle<JSArray> array = args.at<JSArray>(0);
+  int count = args.smi_value_at(1);
+
+  DisallowGarbageCollection no_gc;
+  Tagged<FixedArrayBase> elements = array->elements();
+  DCHECK(IsFastElementsKind(array->GetElementsKind()));
+  DCHECK_LT(count, elements->length());
+  if (!isolate->heap()->CanMoveObjectStart(elements)) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+  array->set_elements(isolate->heap()->LeftTrimFixedArray(elements, count));
+  return ReadOnlyRoots(isolate).true_value();
+}
+
 RUNTIME_FUNCTION(Runtime_ArraySpeciesConstructor) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -10,10 +10,12 @@
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
+#include "src/deoptimizer/deopt-hotspots.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/logging/metrics.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -363,6 +365,17 @@ void DeoptAllOsrLoopsContainingDeoptExit(Isolate* isolate,
   }
 }
 
+void ReportDeoptHotspot(Isolate* isolate, DirectHandle<JSFunction> function,
+                        BytecodeOffset bytecode_offset,
+                        DeoptimizeReason reason, int count) {
+  PrintF("[deopt hotspot: ");
+  ShortPrint(*function);
+  PrintF(" deoptimized %d times at bytecode offset %d, reason: %s]\n",
+         count, bytecode_offset.ToInt(), DeoptimizeReasonToString(reason));
+  isolate->PrintStack(stdout);
+  if (function->has_feedback_vector()) Print(function->feedback_vector());
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
@@ -393,6 +406,32 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
       deoptimizer->bytecode_offset_in_outermost_frame();
   delete deoptimizer;
 
+  const int site_deopt_count = isolate->deopt_hotspots()->Record(
+      function->shared(), deopt_exit_offset, deopt_reason);
+  if (V8_UNLIKELY(site_deopt_count == v8_flags.deopt_hotspot_threshold)) {
+    ReportDeoptHotspot(isolate, function, deopt_exit_offset, deopt_reason,
+                       site_deopt_count);
+  }
+  if (isolate->metrics_recorder()->HasEmbedderRecorder()) {
+    Tagged<SharedFunctionInfo> shared = function->shared();
+    v8::metrics::JavaScriptFunctionDeoptimized event;
+    event.tier = optimized_code->is_maglevved()
+                     ? v8::metrics::JavaScriptTier::kMaglev
+                     : v8::metrics::JavaScriptTier::kTurbofan;
+    event.lazy = deopt_kind == DeoptimizeKind::kLazy;
+    event.bytecode_size_in_bytes = shared->GetBytecodeArray(isolate)->length();
+    if (IsScript(shared->script())) {
+      event.script_id = Cast<Script>(shared->script())->id();
+    }
+    event.function_position = shared->StartPosition();
+    event.bytecode_offset = deopt_exit_offset.ToInt();
+    event.reason = DeoptimizeReasonToString(deopt_reason);
+    event.site_deopt_count = site_deopt_count;
+    isolate->metrics_recorder()->AddMainThreadEvent(
+        event, isolate->GetOrRegisterRecorderContextId(
+                   direct_handle(function->native_context(), isolate)));
+  }
+
   // Ensure the context register is updated for materialized objects.
   JavaScriptStackFrameIterator top_it(isolate);
   JavaScriptFrame* top_frame = top_it.frame();
@@ -342,6 +342,9 @@ Handle<JSObject> CreateArrayLiteral(
     DirectHandle<ArrayBoilerplateDescription> array_boilerplate_description,
     AllocationType allocation);
 
+static_assert(ObjectBoilerplateDescription::kPretenureHintFlag >
+              ObjectLiteral::kHasNullPrototype);
+
 struct ObjectLiteralHelper {
   static inline Handle<JSObject> Create(Isolate* isolate,
                                         Handle<HeapObject> description,
@@ -351,6 +354,9 @@ struct ObjectLiteralHelper {
     return CreateObjectLiteral(isolate, object_boilerplate_description, flags,
                                allocation);
   }
+  static inline bool HasPretenureHint(Tagged<HeapObject> description) {
+    return Cast<ObjectBoilerplateDescription>(description)->pretenure_hint();
+  }
 };
 
 struct ArrayLiteralHelper {
@@ -363,6 +369,9 @@ struct ArrayLiteralHelper {
     return CreateArrayLiteral(isolate, array_boilerplate_description,
                               allocation);
   }
+  static inline bool HasPretenureHint(Tagged<HeapObject> description) {
+    return Cast<ArrayBoilerplateDescription>(description)->pretenure_hint();
+  }
 };
 
 Handle<JSObject> CreateObjectLiteral(
@@ -555,6 +564,27 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
     RETURN_ON_EXCEPTION(isolate, DeepWalk(boilerplate, &creation_context));
     creation_context.ExitScope(site, boilerplate);
 
+    if (v8_flags.code_cache_pretenuring_feedback) {
+      // Reuse the pretenuring decision recorded in the code cache, if any, so
+      // that warm processes don't have to relearn it.
+      if (LiteralHelper::HasPretenureHint(*description)) {
+        DisallowGarbageCollection no_gc;
+        Tagged<Object> current = *site;
+        while (IsAllocationSite(current)) {
+          Tagged<AllocationSite> current_site = Cast<AllocationSite>(current);
+          current_site->set_pretenure_decision(AllocationSite::kTenure);
+          current = current_site->nested_site();
+        }
+      }
+      // Remember the site so that the code serializer can record its
+      // decision on the description.
+      Tagged<Object> script = vector->shared_function_info()->script();
+      if (IsScript(script)) {
+        Script::AddLiteralSite(isolate, handle(Cast<Script>(script), isolate),
+                               site, description);
+      }
+    }
+
     vector->SynchronizedSet(literals_slot, *site);
   }
 
@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <type_traits>
+
 #include "src/base/atomicops.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
@@ -95,6 +98,28 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Below this length std::sort beats clearing and scanning the histogram.
+constexpr size_t kMinCountingSortLength = 64;
+
+// Sorts one-byte elements in linear time by counting the occurrences of each
+// value and writing them back in order.
+template <typename T>
+void CountingSort(T* data, size_t length) {
+  static_assert(sizeof(T) == 1);
+  size_t counts[256] = {};
+  for (size_t i = 0; i < length; i++) {
+    counts[static_cast<uint8_t>(data[i])]++;
+  }
+  // Signed values order 0x80..0xFF (negative) before 0x00..0x7F.
+  const int first = std::is_signed<T>::value ? 0x80 : 0;
+  T* out = data;
+  for (int i = 0; i < 256; i++) {
+    const uint8_t byte = static_cast<uint8_t>(first + i);
+    out = std::fill_n(out, counts[byte], static_cast<T>(byte));
+  }
+  DCHECK_EQ(out, data + length);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -150,6 +175,12 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
+    if constexpr (sizeof(ctype) == 1) {                                    \
+      if (length >= kMinCountingSortLength) {                              \
+        CountingSort(data, length);                                        \
+        break;                                                             \
+      }                                                                    \
+    }                                                                      \
     if (kExternal##Type##Array == kExternalFloat64Array ||                 \
         kExternal##Type##Array == kExternalFloat32Array ||                 \
         kExternal##Type##Array == kExternalFloat16Array) {                 \
@@ -41,6 +41,8 @@ namespace internal {
   F(ArrayIncludes_Slow, 3, 1)          \
   F(ArrayIndexOf, 3, 1)                \
   F(ArrayIsArray, 1, 1)                \
+  F(ArrayLeftTrimElements, 2, 1)       \
+  F(ArraySortSmisDefault, 2, 1)        \
   F(ArraySpeciesConstructor, 1, 1)     \
   F(GrowArrayElements, 2, 1)           \
   F(IsArray, 1, 1)                     \
@@ -476,6 +478,7 @@ namespace internal {
   F(StringEscapeQuotes, 1, 1)             \
   F(StringGreaterThan, 2, 1)              \
   F(StringGreaterThanOrEqual, 2, 1)       \
+  F(StringIndexOfUnchecked, 3, 1)         \
   F(StringIsWellFormed, 1, 1)             \
   F(StringLastIndexOf, 2, 1)              \
   F(StringLessThan, 2, 1)                 \
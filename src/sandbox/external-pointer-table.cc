@@ -260,6 +260,10 @@ uint32_t ExternalPointerTable::EvacuateAndSweepAndCompact(Space* space,
 
   uint32_t num_live_entries = space->capacity() - current_freelist_length;
   counters->external_pointers_count()->AddSample(num_live_entries);
+  if (space->capacity() > 0) {
+    counters->external_pointer_table_occupancy_percent()->AddSample(
+        static_cast<int>(uint64_t{num_live_entries} * 100 / space->capacity()));
+  }
   return num_live_entries;
 }
 
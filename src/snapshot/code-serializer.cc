@@ -19,6 +19,8 @@
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/allocation-site-inl.h"
+#include "src/objects/literal-objects-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots.h"
@@ -46,6 +48,26 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
 
+void CodeSerializer::CollectTenuredLiteralDescriptions(Tagged<Script> script) {
+  DisallowGarbageCollection no_gc;
+  if (IsUndefined(script->literal_sites(), isolate())) return;
+  Tagged<WeakArrayList> sites = Cast<WeakArrayList>(script->literal_sites());
+  for (int i = 0; i < sites->length(); i += 2) {
+    Tagged<HeapObject> site;
+    Tagged<HeapObject> description;
+    if (!sites->Get(i).GetHeapObjectIfWeak(&site) ||
+        !sites->Get(i + 1).GetHeapObjectIfWeak(&description)) {
+      continue;
+    }
+    if (Cast<AllocationSite>(site)->GetAllocationType() !=
+        AllocationType::kOld) {
+      continue;
+    }
+    if (InReadOnlySpace(description)) continue;
+    tenured_literal_descriptions_.insert(description.address());
+  }
+}
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
     Isolate* isolate, Handle<SharedFunctionInfo> info) {
@@ -75,6 +97,9 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
                                  source, script->origin_options()));
   DisallowGarbageCollection no_gc;
+  if (v8_flags.code_cache_pretenuring_feedback) {
+    cs.CollectTenuredLiteralDescriptions(*script);
+  }
   cs.reference_map()->AddAttachedReference(*source);
   AlignedCachedData* cached_data = cs.SerializeSharedFunctionInfo(info);
 
@@ -126,6 +151,7 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
   if (InstanceTypeChecker::IsScript(instance_type)) {
     DirectHandle<FixedArray> host_options;
     DirectHandle<UnionOf<Smi, Symbol, Undefined>> context_data;
+    DirectHandle<Object> literal_sites;
     {
       DisallowGarbageCollection no_gc;
       Tagged<Script> script_obj = Cast<Script>(*obj);
@@ -146,6 +172,10 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       host_options =
           direct_handle(script_obj->host_defined_options(), isolate());
       script_obj->set_host_defined_options(roots.empty_fixed_array());
+      // Literal sites belong to this isolate; their decisions are carried by
+      // the boilerplate descriptions instead (see below).
+      literal_sites = direct_handle(script_obj->literal_sites(), isolate());
+      script_obj->set_literal_sites(roots.undefined_value());
     }
     SerializeGeneric(obj, slot_type);
     {
@@ -153,6 +183,7 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       Tagged<Script> script_obj = Cast<Script>(*obj);
       script_obj->set_host_defined_options(*host_options);
       script_obj->set_context_data(*context_data);
+      script_obj->set_literal_sites(*literal_sites);
     }
     return;
   } else if (InstanceTypeChecker::IsSharedFunctionInfo(instance_type)) {
@@ -216,6 +247,30 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
     SerializeGeneric(data, slot_type);
     data->set_job(job);
     return;
+  } else if (InstanceTypeChecker::IsObjectBoilerplateDescription(
+                 instance_type) ||
+             InstanceTypeChecker::IsArrayBoilerplateDescription(
+                 instance_type)) {
+    // Hint tenured literals only in the cache, so that the decisions of this
+    // isolate don't leak into the literals it creates from now on.
+    if (tenured_literal_descriptions_.count(obj->address()) != 0) {
+      if (InstanceTypeChecker::IsObjectBoilerplateDescription(instance_type)) {
+        Tagged<ObjectBoilerplateDescription> description =
+            Cast<ObjectBoilerplateDescription>(*obj);
+        bool hint = description->pretenure_hint();
+        description->set_pretenure_hint(true);
+        SerializeGeneric(obj, slot_type);
+        Cast<ObjectBoilerplateDescription>(*obj)->set_pretenure_hint(hint);
+      } else {
+        Tagged<ArrayBoilerplateDescription> description =
+            Cast<ArrayBoilerplateDescription>(*obj);
+        bool hint = description->pretenure_hint();
+        description->set_pretenure_hint(true);
+        SerializeGeneric(obj, slot_type);
+        Cast<ArrayBoilerplateDescription>(*obj)->set_pretenure_hint(hint);
+      }
+      return;
+    }
   }
 
   // NOTE(mmarchini): If we try to serialize an InterpreterData our process
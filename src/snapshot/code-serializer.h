@@ -5,6 +5,8 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <unordered_set>
+
 #include "src/base/macros.h"
 #include "src/codegen/script-details.h"
 #include "src/snapshot/serializer.h"
@@ -107,8 +109,14 @@ class CodeSerializer : public Serializer {
  private:
   void SerializeObjectImpl(Handle<HeapObject> o, SlotType slot_type) override;
 
+  // Remembers the boilerplate descriptions of the literals of |script| whose
+  // sites are tenured. They are serialized with a pretenure hint, so sites
+  // created from the cache for them start out tenured.
+  void CollectTenuredLiteralDescriptions(Tagged<Script> script);
+
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  std::unordered_set<Address> tenured_literal_descriptions_;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
@@ -15,6 +15,7 @@
 #include "src/heap/read-only-promotion.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
+#include "src/json/json-parser.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/js-regexp-inl.h"
@@ -262,6 +263,9 @@ void Snapshot::ClearReconstructableDataForSerialization(
     }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+    // The JSON shape cache may refer to context-specific maps.
+    JsonShapeCache::Clear(isolate->heap()->json_shape_cache());
+
     // Must happen after heap iteration since SFI::DiscardCompiled may allocate.
     for (i::DirectHandle<i::SharedFunctionInfo> shared : sfis_to_clear) {
       if (shared->CanDiscardCompiled()) {
@@ -131,10 +131,13 @@ void StartupSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
     auto info = Cast<FunctionTemplateInfo>(obj);
     info->remove_callback_redirection(isolate());
     function_template_infos_.Push(*info);
-  } else if (IsScript(*obj, cage_base) &&
-             Cast<Script>(obj)->IsUserJavaScript()) {
-    Cast<Script>(obj)->set_context_data(
-        ReadOnlyRoots(isolate()).uninitialized_symbol());
+  } else if (IsScript(*obj, cage_base)) {
+    auto script = Cast<Script>(obj);
+    if (script->IsUserJavaScript()) {
+      script->set_context_data(ReadOnlyRoots(isolate()).uninitialized_symbol());
+    }
+    // Literal sites only feed the code cache.
+    script->set_literal_sites(ReadOnlyRoots(isolate()).undefined_value());
   } else if (IsSharedFunctionInfo(*obj, cage_base)) {
     // Clear inferred name for native functions.
     auto shared = Cast<SharedFunctionInfo>(obj);
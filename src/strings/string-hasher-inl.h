@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -36,6 +37,42 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
+namespace detail {
+
+// Odd 64-bit constants with balanced bit patterns. They spread the seed and
+// derive the per-seed secrets; they are never xored with input directly.
+constexpr uint64_t kHashSecret0 = 0xa0761d6478bd642full;
+constexpr uint64_t kHashSecret1 = 0xe7037ed1a0b428dbull;
+constexpr uint64_t kHashSecret2 = 0x8ebc6af09c88c6e3ull;
+
+// Multiplies {a} and {b} to a full 128-bit product and folds the two halves.
+V8_INLINE uint64_t HashMultiplyFold(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+  return static_cast<uint64_t>(product) ^
+         static_cast<uint64_t>(product >> 64);
+#else
+  return (a * b) ^ base::bits::UnsignedMulHigh64(a, b);
+#endif
+}
+
+// Packs up to four code units into 16-bit lanes. Working on code units
+// rather than raw bytes keeps the result independent of the string's
+// representation, and assembling the lanes by shifting (instead of loading
+// the memory as a whole) keeps it independent of the host's byte order, so
+// that hashes computed by mksnapshot match those computed on the target.
+template <typename uchar>
+V8_INLINE uint64_t ReadCodeUnitBlock(const uchar* chars, int count) {
+  DCHECK_LE(count, 4);
+  uint64_t block = 0;
+  for (int i = 0; i < count; i++) {
+    block |= static_cast<uint64_t>(chars[i]) << (16 * i);
+  }
+  return block;
+}
+
+}  // namespace detail
+
 uint32_t StringHasher::GetTrivialHash(int length) {
   DCHECK_GT(length, String::kMaxHashCalcLength);
   // The hash of a large string is simply computed from the length.
@@ -79,28 +116,28 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
         // Not an array index, but it could still be an integer index.
         // Perform a regular hash computation, and additionally check
         // if there are non-digit characters.
-        String::HashFieldType type = String::HashFieldType::kIntegerIndex;
         uint32_t running_hash = static_cast<uint32_t>(seed);
         uint64_t index_big = 0;
-        const uchar* end = &chars[length];
-        while (chars != end) {
-          if (type == String::HashFieldType::kIntegerIndex &&
-              !TryAddIntegerIndexChar(&index_big, *chars)) {
-            type = String::HashFieldType::kHash;
-          }
-          running_hash = AddCharacterCore(running_hash, *chars++);
+        int i = 0;
+        for (; i < length; i++) {
+          if (!TryAddIntegerIndexChar(&index_big, chars[i])) break;
+          running_hash = AddCharacterCore(running_hash, chars[i]);
         }
-        uint32_t hash =
-            String::CreateHashFieldValue(GetHashCore(running_hash), type);
-        if (Name::ContainsCachedArrayIndex(hash)) {
-          // The hash accidentally looks like a cached index. Fix that by
-          // setting a bit that looks like a longer-than-cacheable string
-          // length.
-          hash |= (String::kMaxCachedArrayIndexLength + 1)
-                  << String::ArrayIndexLengthBits::kShift;
+        // Strings that turn out not to be integer indices use the non-index
+        // hash below, like all other strings.
+        if (i == length) {
+          uint32_t hash = String::CreateHashFieldValue(
+              GetHashCore(running_hash), String::HashFieldType::kIntegerIndex);
+          if (Name::ContainsCachedArrayIndex(hash)) {
+            // The hash accidentally looks like a cached index. Fix that by
+            // setting a bit that looks like a longer-than-cacheable string
+            // length.
+            hash |= (String::kMaxCachedArrayIndexLength + 1)
+                    << String::ArrayIndexLengthBits::kShift;
+          }
+          DCHECK(!Name::ContainsCachedArrayIndex(hash));
+          return hash;
         }
-        DCHECK(!Name::ContainsCachedArrayIndex(hash));
-        return hash;
       }
 #endif
     }
@@ -111,12 +148,27 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
     }
   }
 
-  // Non-index hash.
-  uint32_t running_hash = static_cast<uint32_t>(seed);
-  const uchar* end = &chars[length];
-  while (chars != end) {
-    running_hash = AddCharacterCore(running_hash, *chars++);
+  // Non-index hash. Consumes four code units per multiply rather than one
+  // character per step, and mixes in all 64 bits of the seed. A block that
+  // cancels against the secret it is xored with zeroes the multiplicand and
+  // drops out of the hash, so that secret is derived from the seed (as
+  // rapidhash and wyhash do) rather than being a public constant: without
+  // the seed, no input can be chosen to make a block vanish.
+  uint64_t block_secret = detail::HashMultiplyFold(
+      seed ^ detail::kHashSecret0, detail::kHashSecret1);
+  uint64_t state_secret = block_secret ^ detail::kHashSecret2;
+  uint64_t state = seed ^ detail::kHashSecret0;
+  int i = 0;
+  for (; i + 4 <= length; i += 4) {
+    uint64_t block = detail::ReadCodeUnitBlock(chars + i, 4);
+    state ^= detail::HashMultiplyFold(block ^ block_secret,
+                                      state ^ state_secret);
   }
+  uint64_t tail = detail::ReadCodeUnitBlock(chars + i, length - i);
+  state ^= detail::HashMultiplyFold(
+      tail ^ block_secret,
+      state ^ state_secret ^ static_cast<uint64_t>(length));
+  uint32_t running_hash = static_cast<uint32_t>(state ^ (state >> 32));
 
   return String::CreateHashFieldValue(GetHashCore(running_hash),
                                       String::HashFieldType::kHash);
@@ -5,11 +5,19 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
 #include "src/objects/string.h"
 
+#if defined(V8_HOST_ARCH_X64)
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -228,6 +236,75 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   return -1;
 }
 
+// Returns the first position i in [index, max_n) at which subject[i] == first
+// and subject[i + last_offset] == last, or -1 if there is none. Where SIMD is
+// available, a whole vector of candidate positions is checked with two loads
+// and compares, which filters out almost all positions that can't start a
+// match of a short pattern, regardless of how common its first character is.
+template <typename SubjectChar>
+inline int FindFirstAndLastCharacter(base::Vector<const SubjectChar> subject,
+                                     int index, int max_n, SubjectChar first,
+                                     SubjectChar last, int last_offset) {
+  DCHECK_GE(last_offset, 0);
+  DCHECK_LE(max_n + last_offset, subject.length());
+  const SubjectChar* begin = subject.begin();
+  int i = index;
+#if defined(V8_HOST_ARCH_X64)
+  constexpr int kLanes = sizeof(__m128i) / sizeof(SubjectChar);
+  __m128i first_vector, last_vector;
+  if constexpr (sizeof(SubjectChar) == 1) {
+    first_vector = _mm_set1_epi8(static_cast<char>(first));
+    last_vector = _mm_set1_epi8(static_cast<char>(last));
+  } else {
+    first_vector = _mm_set1_epi16(static_cast<int16_t>(first));
+    last_vector = _mm_set1_epi16(static_cast<int16_t>(last));
+  }
+  for (; i + kLanes <= max_n; i += kLanes) {
+    __m128i firsts =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i));
+    __m128i lasts = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(begin + i + last_offset));
+    __m128i matches;
+    if constexpr (sizeof(SubjectChar) == 1) {
+      matches = _mm_and_si128(_mm_cmpeq_epi8(firsts, first_vector),
+                              _mm_cmpeq_epi8(lasts, last_vector));
+    } else {
+      matches = _mm_and_si128(_mm_cmpeq_epi16(firsts, first_vector),
+                              _mm_cmpeq_epi16(lasts, last_vector));
+    }
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+    if (mask != 0) {
+      return i + base::bits::CountTrailingZeros(mask) / sizeof(SubjectChar);
+    }
+  }
+#elif defined(V8_HOST_ARCH_ARM64)
+  constexpr int kLanes = sizeof(uint8x16_t) / sizeof(SubjectChar);
+  for (; i + kLanes <= max_n; i += kLanes) {
+    uint8x16_t matches;
+    if constexpr (sizeof(SubjectChar) == 1) {
+      matches = vandq_u8(vceqq_u8(vld1q_u8(begin + i), vdupq_n_u8(first)),
+                         vceqq_u8(vld1q_u8(begin + i + last_offset),
+                                  vdupq_n_u8(last)));
+    } else {
+      matches = vreinterpretq_u8_u16(vandq_u16(
+          vceqq_u16(vld1q_u16(begin + i), vdupq_n_u16(first)),
+          vceqq_u16(vld1q_u16(begin + i + last_offset), vdupq_n_u16(last))));
+    }
+    // Narrow every byte of the comparison result to 4 bits.
+    uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+    if (mask != 0) {
+      return i +
+             base::bits::CountTrailingZeros(mask) / (4 * sizeof(SubjectChar));
+    }
+  }
+#endif
+  for (; i < max_n; ++i) {
+    if (begin[i] == first && begin[i + last_offset] == last) return i;
+  }
+  return -1;
+}
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -243,6 +320,12 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
       return -1;
     }
   }
+  if constexpr (sizeof(SubjectChar) == 2) {
+    // memchr can only look for one of the two bytes of the character.
+    const SubjectChar c = static_cast<SubjectChar>(pattern_first_char);
+    return FindFirstAndLastCharacter(subject, index, subject.length(), c, c,
+                                     0);
+  }
   return FindFirstCharacter(search->pattern_, subject, index);
 }
 
@@ -272,10 +355,14 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   base::Vector<const PatternChar> pattern = search->pattern_;
   DCHECK_GT(pattern.length(), 1);
   int pattern_length = pattern.length();
+  const SubjectChar first = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindFirstAndLastCharacter(subject, i, n + 1, first, last,
+                                  pattern_length - 1);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
     i++;
@@ -4,6 +4,8 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include <algorithm>
+
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
@@ -76,9 +78,13 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
       DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
+      // Skip the whole ASCII run. NonAsciiStart may stop at the start of the
+      // word containing the next non-ASCII byte, so consume at least one.
+      int run = std::max(
+          1, NonAsciiStart(cursor, static_cast<int>(end - cursor)));
+      utf16_length_ += run;
+      cursor += run;
+      previous = cursor[-1];
       continue;
     }
 
@@ -144,8 +150,11 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
     if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
+      int run = std::max(
+          1, NonAsciiStart(cursor, static_cast<int>(end - cursor)));
+      CopyChars(out, cursor, run);
+      out += run;
+      cursor += run;
       continue;
     }
 
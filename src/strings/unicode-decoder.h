@@ -48,6 +48,43 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   return static_cast<int>(chars - start);
 }
 
+// Returns the index of the first non-ASCII character in the two-byte |chars|,
+// or |length| if there is none. Unlike the one-byte version above, the result
+// is exact.
+inline int NonAsciiStart(const uint16_t* chars, int length) {
+  DCHECK(IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uint16_t)));
+  const uint16_t* start = chars;
+  const uint16_t* limit = chars + length;
+  static constexpr size_t kCharsPerWord = sizeof(uintptr_t) / sizeof(uint16_t);
+
+  if (static_cast<size_t>(length) >= kCharsPerWord) {
+    // Check unaligned chars.
+    while (!IsAligned(reinterpret_cast<intptr_t>(chars), kIntptrSize)) {
+      if (*chars > unibrow::Utf8::kMaxOneByteChar) {
+        return static_cast<int>(chars - start);
+      }
+      ++chars;
+    }
+    // Check aligned words. The mask is symmetric in each 16-bit lane, so it
+    // doesn't depend on endianness.
+    DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
+    const uintptr_t non_ascii_mask = kUintptrAllBitsSet / 0xFFFF * 0xFF80;
+    while (chars + kCharsPerWord <= limit) {
+      if (*reinterpret_cast<const uintptr_t*>(chars) & non_ascii_mask) break;
+      chars += kCharsPerWord;
+    }
+  }
+  // Check remaining chars, or find the non-ASCII char in the word.
+  while (chars < limit) {
+    if (*chars > unibrow::Utf8::kMaxOneByteChar) {
+      return static_cast<int>(chars - start);
+    }
+    ++chars;
+  }
+
+  return static_cast<int>(chars - start);
+}
+
 template <class Decoder>
 class Utf8DecoderBase {
  public:
@@ -564,6 +564,9 @@ class LiftoffAssembler : public MacroAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spills all locals except for the ones that are held in an unshared register
+  // and are not contained in {assigned}.
+  void SpillAssignedLocals(const BitVector* assigned);
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
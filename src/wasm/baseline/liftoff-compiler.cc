@@ -1409,7 +1409,20 @@ class LiftoffCompiler {
     // into registers at branches.
     // TODO(clemensb): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    BitVector* assigned = nullptr;
+    if (v8_flags.liftoff_loop_invariant_registers &&
+        for_debugging_ == kNotForDebugging) {
+      // Locals which the loop doesn't assign keep their value on every back
+      // edge, so keeping them in their registers usually saves a reload per
+      // use and only costs a reload on back edges where they got evicted.
+      assigned = WasmDecoder<ValidationTag>::AnalyzeLoopAssignment(
+          decoder, decoder->pc(), __ num_locals(), zone_);
+    }
+    if (assigned) {
+      __ SpillAssignedLocals(assigned);
+    } else {
+      __ SpillLocals();
+    }
 
     __ SpillLoopArgs(loop->start_merge.arity);
 
@@ -571,6 +571,10 @@ class CompilationStateImpl {
       baseline_compile_job_->CancelAndDetach();
     if (top_tier_compile_job_->IsValid())
       top_tier_compile_job_->CancelAndDetach();
+    if (validate_lazy_functions_job_ &&
+        validate_lazy_functions_job_->IsValid()) {
+      validate_lazy_functions_job_->CancelAndDetach();
+    }
   }
 
   // Call right after the constructor, after the {compilation_state_} field in
@@ -658,6 +662,11 @@ class CompilationStateImpl {
 
   void TierUpAllFunctions();
 
+  // With {--wasm-lazy-validation-in-background}, spawn a job which validates
+  // lazily compiled functions ahead of their first call. Must only be called
+  // once all wire bytes are available.
+  void ValidateLazyFunctionsInBackground();
+
   void AllowAnotherTopTierJob(uint32_t func_index) {
     compilation_unit_queues_.AllowAnotherTopTierJob(func_index);
   }
@@ -753,6 +762,7 @@ class CompilationStateImpl {
   std::unique_ptr<JobHandle> js_to_wasm_wrapper_job_;
   std::unique_ptr<JobHandle> baseline_compile_job_;
   std::unique_ptr<JobHandle> top_tier_compile_job_;
+  std::unique_ptr<JobHandle> validate_lazy_functions_job_;
 
   // The compilation id to identify trace events linked to this compilation.
   static constexpr int kInvalidCompilationID = -1;
@@ -912,6 +922,10 @@ void CompilationState::TierUpAllFunctions() {
   Impl(this)->TierUpAllFunctions();
 }
 
+void CompilationState::ApplyPgoInfo(ProfileInformation* pgo_info) {
+  Impl(this)->ApplyPgoInfoLate(pgo_info);
+}
+
 void CompilationState::AllowAnotherTopTierJob(uint32_t func_index) {
   Impl(this)->AllowAnotherTopTierJob(func_index);
 }
@@ -1916,11 +1930,46 @@ const char* GetCompilationEventName(const WasmCompilationUnit& unit,
 
 constexpr uint8_t kMainTaskId = 0;
 
+// Records how many bytes of function bodies one compile task compiled per
+// second, from entering {ExecuteCompilationUnits} until leaving it.
+class CompileThroughputScope {
+ public:
+  CompileThroughputScope(Counters* counters, CompilationTier tier)
+      : counters_(counters), tier_(tier) {
+    timer_.Start();
+  }
+
+  ~CompileThroughputScope() {
+    if (compiled_bytes_ == 0) return;
+    base::TimeDelta elapsed = timer_.Elapsed();
+    // Skip very short runs, they mostly measure the scheduling overhead.
+    if (elapsed < base::TimeDelta::FromMilliseconds(1)) return;
+    int kb_per_second =
+        static_cast<int>(compiled_bytes_ / elapsed.InSecondsF() / KB);
+    Histogram* histogram =
+        tier_ == kBaseline ? counters_->wasm_baseline_compile_throughput_kb()
+                           : counters_->wasm_top_tier_compile_throughput_kb();
+    histogram->AddSample(kb_per_second);
+  }
+
+  void AddCompiledBytes(size_t bytes) { compiled_bytes_ += bytes; }
+
+ private:
+  Counters* const counters_;
+  const CompilationTier tier_;
+  size_t compiled_bytes_ = 0;
+  base::ElapsedTimer timer_;
+};
+
 // Run by the {BackgroundCompileJob} (on any thread).
 CompilationExecutionResult ExecuteCompilationUnits(
     std::weak_ptr<NativeModule> native_module, Counters* counters,
     JobDelegate* delegate, CompilationTier tier) {
   TRACE_EVENT0("v8.wasm", "wasm.ExecuteCompilationUnits");
+  std::optional<CompileThroughputScope> throughput_scope;
+  if (base::TimeTicks::IsHighResolution()) {
+    throughput_scope.emplace(counters, tier);
+  }
 
   // Compilation must be disabled in jitless mode.
   CHECK(!v8_flags.wasm_jitless);
@@ -1970,6 +2019,10 @@ CompilationExecutionResult ExecuteCompilationUnits(
                                    &per_function_detected_features);
       global_detected_features.Add(per_function_detected_features);
       bool compilation_succeeded = result.succeeded();
+      if (throughput_scope) {
+        throughput_scope->AddCompiledBytes(
+            env->module->functions[unit->func_index()].code.length());
+      }
       ExecutionTier result_tier = result.result_tier;
       // We don't eagerly compile import wrappers any more.
       DCHECK_GE(unit->func_index(), env->module->num_imported_functions);
@@ -2235,6 +2288,7 @@ void CompileNativeModule(Isolate* isolate,
       return;
     }
   }
+  compilation_state->ValidateLazyFunctionsInBackground();
 
   if (!compilation_state->failed()) {
     compilation_state->FinalizeJSToWasmWrappers(isolate, module);
@@ -2414,6 +2468,60 @@ class BackgroundCompileJob final : public JobTask {
   const CompilationTier tier_;
 };
 
+// Validates lazily compiled functions in the background with
+// {--wasm-lazy-validation}, so that their first call does not have to. Errors
+// are ignored here; they are reported when the invalid function is compiled.
+class BackgroundValidateLazyFunctionsJob final : public JobTask {
+ public:
+  explicit BackgroundValidateLazyFunctionsJob(
+      std::weak_ptr<NativeModule> native_module, const WasmModule* module)
+      : native_module_(std::move(native_module)),
+        engine_barrier_(GetWasmEngine()->GetBarrierForBackgroundCompile()),
+        next_function_(module->num_imported_functions),
+        after_last_function_(next_function_ + module->num_declared_functions) {}
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0("v8.wasm", "wasm.ValidateLazyFunctionsInBackground");
+    auto engine_scope = engine_barrier_->TryLock();
+    if (!engine_scope) return;
+    Zone validation_zone{GetWasmEngine()->allocator(), ZONE_NAME};
+    do {
+      BackgroundCompileScope compile_scope(native_module_);
+      if (compile_scope.cancelled()) return;
+      NativeModule* native_module = compile_scope.native_module();
+      const WasmModule* module = native_module->module();
+      int func_index = next_function_.fetch_add(1, std::memory_order_relaxed);
+      if (func_index >= after_last_function_) return;
+      if (module->function_was_validated(func_index)) continue;
+      CompileStrategy strategy =
+          GetCompileStrategy(module, native_module->enabled_features(),
+                             func_index, IsLazyModule(module));
+      if (strategy != CompileStrategy::kLazy &&
+          strategy != CompileStrategy::kLazyBaselineEagerTopTier) {
+        continue;
+      }
+      const WasmFunction& func = module->functions[func_index];
+      validation_zone.Reset();
+      USE(ValidateSingleFunction(
+          &validation_zone, module, func_index,
+          native_module->wire_bytes().SubVector(func.code.offset(),
+                                                func.code.end_offset()),
+          native_module->enabled_features()));
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    int next_func = next_function_.load(std::memory_order_relaxed);
+    return std::max(0, after_last_function_ - next_func);
+  }
+
+ private:
+  std::weak_ptr<NativeModule> native_module_;
+  std::shared_ptr<OperationsBarrier> engine_barrier_;
+  std::atomic<int> next_function_;
+  const int after_last_function_;
+};
+
 }  // namespace
 
 std::shared_ptr<NativeModule> CompileToNativeModule(
@@ -2690,6 +2798,9 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   std::unique_ptr<CompilationUnitBuilder> compilation_unit_builder_;
+  // Size of the function bodies added to {compilation_unit_builder_} since
+  // the last commit.
+  size_t uncommitted_bytes_ = 0;
   int num_functions_ = 0;
   bool prefix_cache_hit_ = false;
   bool before_code_section_ = true;
@@ -2793,6 +2904,7 @@ void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
       compilation_state->ApplyPgoInfoLate(pgo_info.get());
     }
   }
+  compilation_state->ValidateLazyFunctionsInBackground();
 
   bool is_after_deserialization = !module_object_.is_null();
   if (!is_after_deserialization) {
@@ -3419,12 +3531,20 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
   auto* compilation_state = Impl(job_->native_module_->compilation_state());
   compilation_state->AddCompilationUnit(compilation_unit_builder_.get(),
                                         func_index);
+  // Large chunks can hold many functions; don't let the compile tasks wait
+  // for all of them to be decoded.
+  uncommitted_bytes_ += bytes.length();
+  if (v8_flags.wasm_streaming_commit_batch_kb > 0 &&
+      uncommitted_bytes_ >= v8_flags.wasm_streaming_commit_batch_kb * KB) {
+    CommitCompilationUnits();
+  }
   return true;
 }
 
 void AsyncStreamingProcessor::CommitCompilationUnits() {
   DCHECK(compilation_unit_builder_);
   compilation_unit_builder_->Commit();
+  uncommitted_bytes_ = 0;
 }
 
 void AsyncStreamingProcessor::OnFinishedChunk() {
@@ -3628,6 +3748,27 @@ void CompilationStateImpl::InitCompileJob() {
           native_module_weak_, async_counters_, CompilationTier::kTopTier));
 }
 
+void CompilationStateImpl::ValidateLazyFunctionsInBackground() {
+  if (!v8_flags.wasm_lazy_validation ||
+      !v8_flags.wasm_lazy_validation_in_background) {
+    return;
+  }
+  const WasmModule* module = native_module_->module();
+  // asm.js modules are valid by construction.
+  if (module->origin != kWasmOrigin) return;
+  if (!MayCompriseLazyFunctions(module, native_module_->enabled_features())) {
+    return;
+  }
+  // Modules can be shared via the native module cache, so only the first
+  // caller spawns the job.
+  base::MutexGuard guard(&mutex_);
+  if (validate_lazy_functions_job_) return;
+  validate_lazy_functions_job_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kBestEffort,
+      std::make_unique<BackgroundValidateLazyFunctionsJob>(native_module_weak_,
+                                                           module));
+}
+
 void CompilationStateImpl::CancelCompilation(
     CompilationStateImpl::CancellationPolicy cancellation_policy) {
   base::MutexGuard callbacks_guard(&callbacks_mutex_);
@@ -29,6 +29,16 @@ class ProfileGenerator {
     return base::OwnedVector<uint8_t>::Of(buffer);
   }
 
+  base::OwnedVector<uint8_t> GetTieringProfile(uint32_t wire_bytes_hash) {
+    ZoneBuffer buffer{&zone_};
+
+    buffer.write_u32(wire_bytes_hash);
+    buffer.write_u32v(module_->num_declared_functions);
+    SerializeTieringInfo(buffer);
+
+    return base::OwnedVector<uint8_t>::Of(buffer);
+  }
+
  private:
   void SerializeTypeFeedback(ZoneBuffer& buffer) {
     const std::unordered_map<uint32_t, FunctionTypeFeedback>&
@@ -251,4 +261,35 @@ std::unique_ptr<ProfileInformation> LoadProfileFromFile(
   return RestoreProfileData(module, profile_data.as_vector());
 }
 
+base::OwnedVector<uint8_t> GetTieringProfile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    const std::atomic<uint32_t>* tiering_budget_array) {
+  uint32_t hash = static_cast<uint32_t>(GetWireBytesHash(wire_bytes));
+  ProfileGenerator profile_generator{module, tiering_budget_array};
+  return profile_generator.GetTieringProfile(hash);
+}
+
+std::unique_ptr<ProfileInformation> RestoreTieringProfile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    base::Vector<const uint8_t> profile) {
+  // The profile comes from the embedder, so validate it fully before handing
+  // it to {DeserializeTieringInformation}, which CHECKs its input.
+  Decoder decoder{profile.begin(), profile.end()};
+  uint32_t hash = decoder.consume_u32("wire bytes hash", nullptr);
+  uint32_t num_functions = decoder.consume_u32v("num declared functions");
+  if (decoder.failed()) return {};
+  if (hash != static_cast<uint32_t>(GetWireBytesHash(wire_bytes))) return {};
+  if (num_functions != module->num_declared_functions) return {};
+  if (decoder.available_bytes() != num_functions) return {};
+  for (const uint8_t* p = decoder.pc(); p != decoder.end(); ++p) {
+    if (*p & ~(kFunctionExecutedBit | kFunctionTieredUpBit)) return {};
+  }
+
+  std::unique_ptr<ProfileInformation> pgo_info =
+      DeserializeTieringInformation(decoder, module);
+  DCHECK(decoder.ok());
+  DCHECK_EQ(decoder.pc(), decoder.end());
+  return pgo_info;
+}
+
 }  // namespace v8::internal::wasm
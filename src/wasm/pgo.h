@@ -47,6 +47,21 @@ void DumpProfileToFile(const WasmModule* module,
 V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> LoadProfileFromFile(
     const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
 
+// Returns the tiering part of the profile of {module}, prefixed with a hash of
+// the wire bytes so it can be checked against the module it is applied to.
+// This is exposed through the API, hence type feedback is not included: the
+// embedder's copy cannot be trusted, and deserializing it would let it pick
+// the size of feedback vectors.
+base::OwnedVector<uint8_t> GetTieringProfile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    const std::atomic<uint32_t>* tiering_budget_array);
+
+// Restores a profile generated by {GetTieringProfile}. Returns nullptr if the
+// profile is malformed or was generated for different wire bytes.
+V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> RestoreTieringProfile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    base::Vector<const uint8_t> profile);
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_PGO_H_
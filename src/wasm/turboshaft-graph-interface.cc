@@ -45,6 +45,7 @@ using compiler::TrapId;
 using TSBlock = compiler::turboshaft::Block;
 using compiler::turboshaft::BuiltinCallDescriptor;
 using compiler::turboshaft::CallOp;
+using compiler::turboshaft::ChangeOp;
 using compiler::turboshaft::ConditionWithHint;
 using compiler::turboshaft::ConstantOp;
 using compiler::turboshaft::ConstOrV;
@@ -6991,7 +6992,9 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     if (bounds_checks == kTrapHandler &&
         enforce_bounds_check ==
             compiler::EnforceBoundsCheck::kCanOmitBoundsCheck) {
-      if (memory->is_memory64) {
+      if (memory->is_memory64 &&
+          !IsKnownBelow(V<Word64>::Cast(converted_index),
+                        memory->GetMemory64GuardsSize())) {
         V<Word32> cond = __ __ Uint64LessThan(
             V<Word64>::Cast(converted_index),
             __ Word64Constant(memory->GetMemory64GuardsSize()));
@@ -7017,6 +7020,32 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     return {converted_index, compiler::BoundsCheckResult::kDynamicallyChecked};
   }
 
+  // Returns whether the value of {index} is statically known to be below
+  // {limit}, based on the operation that produces it. This lets memory64
+  // accesses rely on the guard regions alone when the index is e.g. a
+  // zero-extended i32 or masked to a small range.
+  bool IsKnownBelow(V<Word64> index, uint64_t limit) {
+    // The index can be invalid if we are generating unreachable operations.
+    if (!index.valid()) return false;
+    OperationMatcher matcher(__ output_graph());
+    uint64_t constant;
+    if (matcher.MatchIntegralWord64Constant(index, &constant)) {
+      return constant < limit;
+    }
+    OpIndex input;
+    if (matcher.MatchChange(index, &input, ChangeOp::Kind::kZeroExtend,
+                            RegisterRepresentation::Word32(),
+                            RegisterRepresentation::Word64())) {
+      return limit > uint64_t{kMaxUInt32};
+    }
+    V<Word64> value;
+    if (matcher.MatchBitwiseAndWithConstant(index, &value, &constant,
+                                            WordRepresentation::Word64())) {
+      return constant < limit;
+    }
+    return false;
+  }
+
   V<WordPtr> MemStart(uint32_t index) {
     if (index == 0) {
       // TODO(14108): Port TF's dynamic "cached_memory_index" infrastructure.
@@ -6,9 +6,11 @@
 
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -75,7 +77,75 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
+
+Segment* AccountingAllocator::TryAllocateSegmentFromPool(size_t bytes) {
+  if (bytes > (size_t{1} << kMaxPoolSizeClassLog2) ||
+      pooled_memory_usage_.load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+  int size_class = 0;
+  if (bytes > (size_t{1} << kMinPoolSizeClassLog2)) {
+    size_class = base::bits::WhichPowerOfTwo(
+                     base::bits::RoundUpToPowerOfTwo(bytes)) -
+                 kMinPoolSizeClassLog2;
+  }
+  base::MutexGuard guard(&pool_mutex_);
+  // Larger classes can serve the request too, but that wastes memory, so
+  // only look one class up.
+  for (int i = size_class;
+       i < std::min(size_class + 2, kNumberOfPoolSizeClasses); ++i) {
+    Segment* segment = pool_[i];
+    if (segment == nullptr) continue;
+    pool_[i] = segment->next();
+    segment->set_next(nullptr);
+    pooled_memory_usage_.fetch_sub(segment->total_size(),
+                                   std::memory_order_relaxed);
+    pooled_segment_hits_.fetch_add(1, std::memory_order_relaxed);
+    DCHECK_GE(segment->total_size(), bytes);
+    return segment;
+  }
+  return nullptr;
+}
+
+bool AccountingAllocator::TryReturnSegmentToPool(Segment* segment) {
+  size_t size = segment->total_size();
+  if (size < (size_t{1} << kMinPoolSizeClassLog2) ||
+      size >= (size_t{1} << (kMaxPoolSizeClassLog2 + 1))) {
+    return false;
+  }
+  size_t pool_limit = v8_flags.zone_segment_pool_size * KB;
+  if (pooled_memory_usage_.load(std::memory_order_relaxed) + size >
+      pool_limit) {
+    return false;
+  }
+  int size_class =
+      base::bits::WhichPowerOfTwo(
+          base::bits::RoundDownToPowerOfTwo32(static_cast<uint32_t>(size))) -
+      kMinPoolSizeClassLog2;
+  DCHECK_LT(size_class, kNumberOfPoolSizeClasses);
+  base::MutexGuard guard(&pool_mutex_);
+  segment->set_zone(nullptr);
+  segment->set_next(pool_[size_class]);
+  pool_[size_class] = segment;
+  pooled_memory_usage_.fetch_add(size, std::memory_order_relaxed);
+  return true;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  base::MutexGuard guard(&pool_mutex_);
+  for (Segment*& head : pool_) {
+    while (head != nullptr) {
+      Segment* segment = head;
+      head = segment->next();
+      pooled_memory_usage_.fetch_sub(segment->total_size(),
+                                     std::memory_order_relaxed);
+      segment->ZapHeader();
+      free(segment);
+    }
+  }
+  DCHECK_EQ(0, pooled_memory_usage_.load(std::memory_order_relaxed));
+}
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -85,6 +155,9 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (Segment* segment = TryAllocateSegmentFromPool(bytes)) {
+    memory = segment;
+    bytes = segment->total_size();
   } else {
     auto result = AllocAtLeastWithRetry(bytes);
     memory = result.ptr;
@@ -108,10 +181,11 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
-  } else {
+  } else if (!TryReturnSegmentToPool(segment)) {
+    segment->ZapHeader();
     free(segment);
   }
 }
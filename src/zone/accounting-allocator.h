@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -46,6 +47,21 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Returns the number of bytes held by freed segments that are kept for reuse
+  // (see --zone-segment-pool-size). These are not part of the current memory
+  // usage.
+  size_t GetPooledMemoryUsage() const {
+    return pooled_memory_usage_.load(std::memory_order_relaxed);
+  }
+
+  // Returns how many segment allocations were served from the pool.
+  size_t GetPooledSegmentHits() const {
+    return pooled_segment_hits_.load(std::memory_order_relaxed);
+  }
+
+  // Frees all pooled segments, e.g. under memory pressure.
+  void ReleasePooledSegments();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,9 +83,26 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Freed segments are pooled in power-of-two size classes from 8KB to 32KB,
+  // which covers the segment sizes that Zone uses for all but very large
+  // allocations. A pooled segment of class i is at least
+  // 2^(kMinPoolSizeClassLog2 + i) bytes large.
+  static constexpr int kMinPoolSizeClassLog2 = 13;
+  static constexpr int kMaxPoolSizeClassLog2 = 15;
+  static constexpr int kNumberOfPoolSizeClasses =
+      kMaxPoolSizeClassLog2 - kMinPoolSizeClassLog2 + 1;
+
+  Segment* TryAllocateSegmentFromPool(size_t bytes);
+  bool TryReturnSegmentToPool(Segment* segment);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  base::Mutex pool_mutex_;
+  Segment* pool_[kNumberOfPoolSizeClasses] = {};
+  std::atomic<size_t> pooled_memory_usage_{0};
+  std::atomic<size_t> pooled_segment_hits_{0};
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 };
@@ -0,0 +1,211 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the embedder API calls that bindings make on every request. Run
+// with --benchmark_format=json (or --benchmark_out=<file>
+// --benchmark_out_format=json) and --benchmark_repetitions=<n> to get results
+// that can be compared across builds.
+
+#include <cstdlib>
+
+#include "include/v8-context.h"
+#include "include/v8-exception.h"
+#include "include/v8-fast-api-calls.h"
+#include "include/v8-function.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-object.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-template.h"
+#include "include/v8-value-serializer.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+void SlowAdd(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
+  int32_t a = info[0]->Int32Value(context).FromJust();
+  int32_t b = info[1]->Int32Value(context).FromJust();
+  info.GetReturnValue().Set(a + b);
+}
+
+int32_t FastAdd(v8::Local<v8::Object> receiver, int32_t a, int32_t b) {
+  return a + b;
+}
+
+const v8::CFunction kFastAdd = v8::CFunction::Make(FastAdd);
+
+class Api : public v8::benchmarking::BenchmarkWithContext {
+ protected:
+  v8::Local<v8::ObjectTemplate> GlobalTemplate() override {
+    v8::Isolate* isolate = v8_isolate();
+    v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate);
+    global->Set(isolate, "slowAdd",
+                v8::FunctionTemplate::New(isolate, &SlowAdd));
+    global->Set(isolate, "fastAdd",
+                v8::FunctionTemplate::New(
+                    isolate, &SlowAdd, v8::Local<v8::Value>(),
+                    v8::Local<v8::Signature>(), 2,
+                    v8::ConstructorBehavior::kThrow,
+                    v8::SideEffectType::kHasSideEffect, &kFastAdd));
+    return global;
+  }
+};
+
+}  // namespace
+
+// Round trip from C++ into a trivial JS function and back.
+BENCHMARK_F(Api, FunctionCall)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Function> function =
+      CompileRun("(function(a) { return a; })").As<v8::Function>();
+  v8::Local<v8::Value> argv[] = {v8::Integer::New(v8_isolate(), 1)};
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::Value> result =
+        function->Call(context, context->Global(), 1, argv).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK_F(Api, ObjectGet)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Object> object = CompileRun("({x: 1})").As<v8::Object>();
+  v8::Local<v8::String> key = v8_str("x");
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::Value> result = object->Get(context, key).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK_F(Api, ObjectSet)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Object> object = CompileRun("({x: 1})").As<v8::Object>();
+  v8::Local<v8::String> key = v8_str("x");
+  v8::Local<v8::Value> value = v8::Integer::New(v8_isolate(), 2);
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(object->Set(context, key, value));
+  }
+}
+
+BENCHMARK_F(Api, StringNewFromUtf8)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::String> result =
+        v8::String::NewFromUtf8(v8_isolate(), "Content-Type: text/html")
+            .ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK_F(Api, HandleScope)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(v8_isolate());
+    benchmark::DoNotOptimize(v8::Undefined(v8_isolate()));
+  }
+}
+
+// Calling into JS under a TryCatch, as bindings do for any user callback.
+BENCHMARK_F(Api, TryCatch)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Function> function =
+      CompileRun("(function() { throw 1; })").As<v8::Function>();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::TryCatch try_catch(v8_isolate());
+    benchmark::DoNotOptimize(
+        function->Call(context, context->Global(), 0, nullptr));
+    benchmark::DoNotOptimize(try_catch.HasCaught());
+  }
+}
+
+BENCHMARK_F(Api, ContextNew)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+    benchmark::DoNotOptimize(context);
+  }
+}
+
+// Serializes and deserializes a small message, as postMessage() does.
+BENCHMARK_F(Api, ValueSerializerRoundTrip)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Value> message = CompileRun(
+      "({id: 42, method: 'update', params: {values: [1, 2, 3], text: 'abc'}})");
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::ValueSerializer serializer(v8_isolate());
+    serializer.WriteHeader();
+    serializer.WriteValue(context, message).Check();
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    v8::ValueDeserializer deserializer(v8_isolate(), buffer.first,
+                                       buffer.second);
+    deserializer.ReadHeader(context).Check();
+    v8::Local<v8::Value> result =
+        deserializer.ReadValue(context).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+    free(buffer.first);
+  }
+}
+
+// Calls from optimized JS to a function with a fast API implementation,
+// compared to the same function without one.
+BENCHMARK_F(Api, FastApiCall)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Function> function =
+      CompileRun(
+          "(function() {"
+          "  var sum = 0;"
+          "  for (var i = 0; i < 1_000; i++) sum = fastAdd(sum, 1);"
+          "  return sum;"
+          "})")
+          .As<v8::Function>();
+  v8::Local<v8::Context> context = this->context();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::Value> result =
+        function->Call(context, context->Global(), 0, nullptr)
+            .ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK_F(Api, SlowApiCall)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Function> function =
+      CompileRun(
+          "(function() {"
+          "  var sum = 0;"
+          "  for (var i = 0; i < 1_000; i++) sum = slowAdd(sum, 1);"
+          "  return sum;"
+          "})")
+          .As<v8::Function>();
+  v8::Local<v8::Context> context = this->context();
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::Value> result =
+        function->Call(context, context->Global(), 0, nullptr)
+            .ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
@@ -9,6 +9,8 @@
 #include "include/v8-array-buffer.h"
 #include "include/v8-cppgc.h"
 #include "include/v8-initialization.h"
+#include "include/v8-script.h"
+
 namespace v8::benchmarking {
 
 // static
@@ -45,4 +47,30 @@ void BenchmarkWithIsolate::ShutdownProcess() {
   delete v8_ab_allocator_;
 }
 
+void BenchmarkWithContext::SetUp(::benchmark::State& state) {
+  v8::Isolate* isolate = v8_isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context =
+      v8::Context::New(isolate, nullptr, GlobalTemplate());
+  context_.Reset(isolate, context);
+  context->Enter();
+}
+
+void BenchmarkWithContext::TearDown(::benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  context()->Exit();
+  context_.Reset();
+}
+
+v8::Local<v8::String> BenchmarkWithContext::v8_str(const char* x) {
+  return v8::String::NewFromUtf8(v8_isolate(), x).ToLocalChecked();
+}
+
+v8::Local<v8::Value> BenchmarkWithContext::CompileRun(const char* source) {
+  v8::Local<v8::Context> context = this->context();
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(context, v8_str(source)).ToLocalChecked();
+  return script->Run(context).ToLocalChecked();
+}
+
 }  // namespace v8::benchmarking
@@ -6,9 +6,14 @@
 #define TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
 
 #include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
 #include "include/v8-cppgc.h"
 #include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
 #include "include/v8-platform.h"
+#include "include/v8-primitive.h"
+#include "include/v8-template.h"
 #include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
 
 namespace v8::benchmarking {
@@ -36,6 +41,28 @@ class BenchmarkWithIsolate : public benchmark::Fixture {
   static v8::ArrayBuffer::Allocator* v8_ab_allocator_;
 };
 
+// BenchmarkWithContext additionally creates a Context for every benchmark and
+// enters it while the benchmark runs.
+class BenchmarkWithContext : public BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override;
+  void TearDown(::benchmark::State& state) override;
+
+ protected:
+  // Returns the template of the global object of the context, e.g. to
+  // install API functions. Called from SetUp within a HandleScope.
+  virtual v8::Local<v8::ObjectTemplate> GlobalTemplate() { return {}; }
+
+  v8::Local<v8::Context> context() { return context_.Get(v8_isolate()); }
+  v8::Local<v8::String> v8_str(const char* x);
+  // Compiles and runs |source| in the context. The caller provides the
+  // HandleScope.
+  v8::Local<v8::Value> CompileRun(const char* source);
+
+ private:
+  v8::Global<v8::Context> context_;
+};
+
 }  // namespace v8::benchmarking
 
 #endif  // TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
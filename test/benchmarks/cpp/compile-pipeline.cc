@@ -0,0 +1,248 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compiles a fixed corpus of functions with Maglev and Turbofan, without
+// running the generated code, so that compile latency can be tracked against
+// a stable baseline. Each iteration recompiles every function in the corpus
+// synchronously with the feedback collected during warm-up. Pass
+// --turbo-stats or --maglev-stats on the command line to additionally get
+// the time and zone memory of every phase, per iteration, as counters.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "src/api/api-inl.h"
+#include "src/base/macros.h"
+#include "src/codegen/compiler.h"
+#include "src/diagnostics/compilation-statistics.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Functions in the style of common library and application code: parsing,
+// string building, collection processing, classes and closures. The corpus
+// must stay fixed for results to be comparable across builds.
+constexpr char kCorpus[] =
+    "function tokenize(input) {"
+    "  var tokens = [];"
+    "  var i = 0;"
+    "  while (i < input.length) {"
+    "    var c = input.charCodeAt(i);"
+    "    if (c === 32) { i++; continue; }"
+    "    if (c >= 48 && c <= 57) {"
+    "      var start = i;"
+    "      while (i < input.length && input.charCodeAt(i) >= 48 &&"
+    "             input.charCodeAt(i) <= 57) i++;"
+    "      tokens.push({type: 'number', value: +input.slice(start, i)});"
+    "    } else {"
+    "      tokens.push({type: 'op', value: input[i++]});"
+    "    }"
+    "  }"
+    "  return tokens;"
+    "}"
+    "function formatRecord(record) {"
+    "  var parts = [];"
+    "  for (var key in record) {"
+    "    var value = record[key];"
+    "    if (typeof value === 'string') value = JSON.stringify(value);"
+    "    else if (Array.isArray(value)) value = '[' + value.join(', ') + ']';"
+    "    parts.push(key + ': ' + value);"
+    "  }"
+    "  return '{' + parts.join(', ') + '}';"
+    "}"
+    "function summarize(orders) {"
+    "  return orders"
+    "      .filter(o => o.status !== 'cancelled')"
+    "      .map(o => ({id: o.id, total: o.items.reduce("
+    "          (sum, item) => sum + item.price * item.quantity, 0)}))"
+    "      .sort((a, b) => b.total - a.total)"
+    "      .slice(0, 10);"
+    "}"
+    "class Vector {"
+    "  constructor(x, y) { this.x = x; this.y = y; }"
+    "  add(other) { return new Vector(this.x + other.x, this.y + other.y); }"
+    "  scale(f) { return new Vector(this.x * f, this.y * f); }"
+    "  length() { return Math.sqrt(this.x * this.x + this.y * this.y); }"
+    "}"
+    "function simulate(particles, steps) {"
+    "  var energy = 0;"
+    "  for (var s = 0; s < steps; s++) {"
+    "    for (var p of particles) {"
+    "      p.position = p.position.add(p.velocity.scale(0.1));"
+    "      if (p.position.length() > 100) p.velocity = p.velocity.scale(-1);"
+    "      energy += p.velocity.length();"
+    "    }"
+    "  }"
+    "  return energy;"
+    "}"
+    "function makeRouter(routes) {"
+    "  var compiled = routes.map(r => ({"
+    "    regexp: new RegExp('^' + r.path.replace(/:\\w+/g, '([^/]+)') + '$'),"
+    "    handler: r.handler,"
+    "  }));"
+    "  return function route(url) {"
+    "    for (var i = 0; i < compiled.length; i++) {"
+    "      var match = compiled[i].regexp.exec(url);"
+    "      if (match) return compiled[i].handler(match.slice(1));"
+    "    }"
+    "    return null;"
+    "  };"
+    "}"
+    "var route = makeRouter(["
+    "  {path: '/users/:id', handler: args => 'user ' + args[0]},"
+    "  {path: '/posts/:id/comments/:cid', handler: args => args.join('-')},"
+    "]);"
+    "function warmUp() {"
+    "  var orders = [];"
+    "  for (var i = 0; i < 50; i++) {"
+    "    orders.push({id: i, status: i % 7 ? 'paid' : 'cancelled',"
+    "                 items: [{price: i, quantity: 2},"
+    "                         {price: 3, quantity: i}]});"
+    "  }"
+    "  var particles = [];"
+    "  for (var i = 0; i < 10; i++) {"
+    "    particles.push({position: new Vector(i, -i),"
+    "                    velocity: new Vector(1, i / 10)});"
+    "  }"
+    "  for (var i = 0; i < 20; i++) {"
+    "    tokenize('12 + 345 * (6 - 78)');"
+    "    formatRecord({id: i, name: 'item', tags: [1, 2, 3]});"
+    "    summarize(orders);"
+    "    simulate(particles, 5);"
+    "    route('/users/' + i);"
+    "    route('/posts/' + i + '/comments/7');"
+    "  }"
+    "}";
+
+constexpr const char* kCorpusFunctions[] = {
+    "tokenize", "formatRecord", "summarize", "simulate", "route",
+};
+
+class CompilePipeline : public v8::benchmarking::BenchmarkWithContext {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    BenchmarkWithContext::SetUp(state);
+    v8::Isolate* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = this->context();
+
+    CompileRun(kCorpus);
+    for (const char* name : kCorpusFunctions) {
+      v8::Local<v8::Function> function = context->Global()
+                                             ->Get(context, v8_str(name))
+                                             .ToLocalChecked()
+                                             .As<v8::Function>();
+      functions_.emplace_back(isolate, function);
+      // Allocate the feedback vector up front so that warm-up collects
+      // feedback from the first call.
+      namespace i = v8::internal;
+      i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+      i::Handle<i::JSFunction> js_function =
+          i::Cast<i::JSFunction>(v8::Utils::OpenHandle(*function));
+      i::IsCompiledScope is_compiled_scope(
+          js_function->shared()->is_compiled_scope(i_isolate));
+      i::JSFunction::EnsureFeedbackVector(i_isolate, js_function,
+                                          &is_compiled_scope);
+    }
+    CompileRun("warmUp()");
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    functions_.clear();
+    BenchmarkWithContext::TearDown(state);
+  }
+
+ protected:
+  void Run(benchmark::State& st, v8::internal::CodeKind code_kind) {
+    namespace i = v8::internal;
+    i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate());
+    if (code_kind == i::CodeKind::MAGLEV && !i::v8_flags.maglev) {
+      st.SkipWithError("requires --maglev");
+      return;
+    }
+    // Keep the statistics of warm-up and of other benchmarks out of the
+    // counters. They are reset rather than dumped, since dumping prints them
+    // to stdout, where they would corrupt --benchmark_format=json output.
+    std::shared_ptr<i::CompilationStatistics> stats = Statistics(code_kind);
+    if (stats) stats->Reset();
+    v8::HandleScope handle_scope(v8_isolate());
+    for (auto _ : st) {
+      USE(_);
+      for (const v8::Global<v8::Function>& global : functions_) {
+        i::HandleScope iteration_scope(isolate);
+        i::Handle<i::JSFunction> function = i::Cast<i::JSFunction>(
+            v8::Utils::OpenHandle(*global.Get(v8_isolate())));
+        // Drop the code of the previous iteration, which would otherwise be
+        // returned from the optimized code cache.
+        i::Tagged<i::FeedbackVector> vector = function->feedback_vector();
+        if (vector->has_optimized_code()) vector->ClearOptimizedCode();
+        i::Compiler::CompileOptimized(
+            isolate, function, i::ConcurrencyMode::kSynchronous, code_kind);
+      }
+    }
+    if (stats) {
+      ReportPhases(st, stats.get());
+      // The isolate prints whatever is left when it is disposed.
+      stats->Reset();
+    }
+  }
+
+  // The statistics that the pipeline for |code_kind| records into, or null
+  // if they are disabled.
+  std::shared_ptr<v8::internal::CompilationStatistics> Statistics(
+      v8::internal::CodeKind code_kind) {
+    namespace i = v8::internal;
+    i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate());
+#ifdef V8_ENABLE_MAGLEV
+    if (code_kind == i::CodeKind::MAGLEV) {
+      if (!i::v8_flags.maglev_stats && !i::v8_flags.maglev_stats_nvp) {
+        return nullptr;
+      }
+      return isolate->GetMaglevStatistics();
+    }
+#endif  // V8_ENABLE_MAGLEV
+    if (!i::v8_flags.turbo_stats && !i::v8_flags.turbo_stats_nvp) {
+      return nullptr;
+    }
+    return isolate->GetTurboStatistics();
+  }
+
+  // Adds the average time and zone memory per iteration of every phase to
+  // the counters of |st|.
+  static void ReportPhases(benchmark::State& st,
+                           v8::internal::CompilationStatistics* stats) {
+    using BasicStats = v8::internal::CompilationStatistics::BasicStats;
+    stats->ForEachPhase([&](const std::string& name, const BasicStats& phase) {
+      st.counters[name + "_us"] =
+          benchmark::Counter(phase.delta_.InMicrosecondsF(),
+                             benchmark::Counter::kAvgIterations);
+      st.counters[name + "_zone_bytes"] =
+          benchmark::Counter(static_cast<double>(phase.total_allocated_bytes_),
+                             benchmark::Counter::kAvgIterations);
+    });
+  }
+
+  std::vector<v8::Global<v8::Function>> functions_;
+};
+
+}  // namespace
+
+BENCHMARK_F(CompilePipeline, Maglev)(benchmark::State& st) {
+  Run(st, v8::internal::CodeKind::MAGLEV);
+}
+
+BENCHMARK_F(CompilePipeline, Turbofan)(benchmark::State& st) {
+  Run(st, v8::internal::CodeKind::TURBOFAN);
+}
@@ -0,0 +1,162 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/heap.h"
+#include "test/benchmarks/cpp/cppgc/benchmark_utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+#if defined(CPPGC_YOUNG_GENERATION)
+
+namespace cppgc {
+namespace internal {
+namespace {
+
+// Benchmarks for the young generation of cppgc on a DOM-like object graph.
+// Each node has a parent, first child, and next sibling, mirroring the shape
+// of Blink's Node hierarchy.
+class Generational : public testing::BenchmarkWithHeap {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    testing::BenchmarkWithHeap::SetUp(state);
+    // Generational GC is enabled in the atomic pause of the next GC.
+    Heap::From(&heap())->EnableGenerationalGC();
+    CollectMajor();
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    Heap::From(&heap())->Terminate();
+    testing::BenchmarkWithHeap::TearDown(state);
+  }
+
+ protected:
+  void CollectMinor() {
+    Heap::From(&heap())->CollectGarbage(GCConfig::MinorPreciseAtomicConfig());
+  }
+
+  void CollectMajor() {
+    Heap::From(&heap())->CollectGarbage(GCConfig::PreciseAtomicConfig());
+  }
+};
+
+class Node final : public GarbageCollected<Node> {
+ public:
+  void Trace(Visitor* visitor) const {
+    visitor->Trace(parent_);
+    visitor->Trace(first_child_);
+    visitor->Trace(next_sibling_);
+  }
+
+  void AppendChild(Node* child) {
+    child->parent_ = this;
+    child->next_sibling_ = first_child_;
+    first_child_ = child;
+  }
+
+  // Drops all existing children.
+  void ReplaceChildren(Node* child) {
+    child->parent_ = this;
+    first_child_ = child;
+  }
+
+  Node* first_child() const { return first_child_.Get(); }
+
+ private:
+  Member<Node> parent_;
+  Member<Node> first_child_;
+  Member<Node> next_sibling_;
+  // Payload comparable to a small DOM node.
+  char data_[48];
+};
+
+// Builds a tree with `depth` levels and `fanout` children per node.
+Node* BuildTree(AllocationHandle& handle, size_t depth, size_t fanout) {
+  Node* root = MakeGarbageCollected<Node>(handle);
+  if (depth == 0) return root;
+  for (size_t i = 0; i < fanout; ++i) {
+    root->AppendChild(BuildTree(handle, depth - 1, fanout));
+  }
+  return root;
+}
+
+constexpr size_t kTreeDepth = 6;
+constexpr size_t kTreeFanout = 4;
+constexpr size_t kNewNodesPerIteration = 1024;
+
+// Replaces the children of the old node `parent` with freshly allocated nodes.
+// The previously attached nodes become garbage.
+void AttachYoungSubtree(AllocationHandle& handle, Node* parent) {
+  Node* subtree = MakeGarbageCollected<Node>(handle);
+  for (size_t i = 1; i < kNewNodesPerIteration; ++i) {
+    subtree->AppendChild(MakeGarbageCollected<Node>(handle));
+  }
+  parent->ReplaceChildren(subtree);
+}
+
+// Pause of a minor GC with an old tree and freshly allocated nodes that are
+// attached to it, leaving an old-to-new reference in the remembered set.
+BENCHMARK_F(Generational, MinorGCPause)(benchmark::State& st) {
+  Persistent<Node> document =
+      BuildTree(heap().GetAllocationHandle(), kTreeDepth, kTreeFanout);
+  CollectMajor();
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    AttachYoungSubtree(heap().GetAllocationHandle(), document->first_child());
+    st.ResumeTiming();
+    CollectMinor();
+  }
+}
+
+// Pause of a major GC on the same graph for comparison.
+BENCHMARK_F(Generational, MajorGCPause)(benchmark::State& st) {
+  Persistent<Node> document =
+      BuildTree(heap().GetAllocationHandle(), kTreeDepth, kTreeFanout);
+  CollectMajor();
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    AttachYoungSubtree(heap().GetAllocationHandle(), document->first_child());
+    st.ResumeTiming();
+    CollectMajor();
+  }
+}
+
+// Cost of the generational write barrier for old-to-new stores.
+BENCHMARK_F(Generational, OldToNewWriteBarrier)(benchmark::State& st) {
+  Persistent<Node> old_node =
+      MakeGarbageCollected<Node>(heap().GetAllocationHandle());
+  CollectMajor();
+  Persistent<Node> young_node =
+      MakeGarbageCollected<Node>(heap().GetAllocationHandle());
+  for (auto _ : st) {
+    USE(_);
+    old_node->AppendChild(young_node.Get());
+    benchmark::ClobberMemory();
+  }
+}
+
+// Cost of the write barrier for young-to-young stores, which are filtered by
+// the age table.
+BENCHMARK_F(Generational, YoungToYoungWriteBarrier)(benchmark::State& st) {
+  Persistent<Node> young_parent =
+      MakeGarbageCollected<Node>(heap().GetAllocationHandle());
+  Persistent<Node> young_child =
+      MakeGarbageCollected<Node>(heap().GetAllocationHandle());
+  for (auto _ : st) {
+    USE(_);
+    young_parent->AppendChild(young_child.Get());
+    benchmark::ClobberMemory();
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace cppgc
+
+#endif  // defined(CPPGC_YOUNG_GENERATION)
@@ -3,12 +3,15 @@
 // found in the LICENSE file.
 
 #include "src/base/macros.h"
+#include "src/base/numbers/dtoa.h"
 #include "src/base/numbers/fast-dtoa.h"
 #include "src/base/vector.h"
 #include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
 
+using v8::base::DTOA_SHORTEST;
 using v8::base::FAST_DTOA_PRECISION;
 using v8::base::FAST_DTOA_SHORTEST;
+using v8::base::kBase10MaximalLength;
 using v8::base::kFastDtoaMaximalLength;
 using v8::base::Vector;
 
@@ -1065,5 +1068,21 @@ static void BM_DtoaSixDigits(benchmark::State& state) {
   }
 }
 
+// The digit generation behind DoubleToCString (i.e. Number.prototype.toString
+// and number-to-string conversions), including the bignum fallback for the
+// inputs that the fast path above rejects.
+static void BM_DoubleToAsciiShortest(benchmark::State& state) {
+  char output[kBase10MaximalLength + 1];
+  Vector<char> buffer(output, sizeof(output));
+  int sign, length, decimal_point;
+  unsigned idx = 0;
+  for (auto _ : state) {
+    DoubleToAscii(kTestDoubles[idx++ % 4096], DTOA_SHORTEST, 0, buffer, &sign,
+                  &length, &decimal_point);
+    benchmark::DoNotOptimize(output);
+  }
+}
+
 BENCHMARK(BM_DtoaShortest);
 BENCHMARK(BM_DtoaSixDigits);
+BENCHMARK(BM_DoubleToAsciiShortest);
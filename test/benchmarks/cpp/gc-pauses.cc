@@ -0,0 +1,197 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Drives the heap with server-shaped workloads and reports the distribution
+// of GC pauses per collector, since tail latency rather than throughput is
+// what servers care about. Each benchmark reports the count, median, 99th
+// percentile and maximum of the pauses of every collector that ran, in
+// microseconds. Pass V8 flags such as --minor-ms or --harmony-struct on the
+// command line.
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Records the duration of each pause from the GC prologue to the epilogue.
+class PauseRecorder {
+ public:
+  explicit PauseRecorder(v8::Isolate* isolate) : isolate_(isolate) {
+    isolate_->AddGCPrologueCallback(&OnPrologue, this, kCollectors);
+    isolate_->AddGCEpilogueCallback(&OnEpilogue, this, kCollectors);
+  }
+
+  ~PauseRecorder() {
+    isolate_->RemoveGCPrologueCallback(&OnPrologue, this);
+    isolate_->RemoveGCEpilogueCallback(&OnEpilogue, this);
+  }
+
+  void Report(benchmark::State& st) {
+    Report(st, "Scavenger", &scavenger_);
+    Report(st, "MinorMarkSweep", &minor_mark_sweep_);
+    Report(st, "MarkCompact", &mark_compact_);
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  static constexpr v8::GCType kCollectors = static_cast<v8::GCType>(
+      v8::kGCTypeScavenge | v8::kGCTypeMinorMarkSweep |
+      v8::kGCTypeMarkSweepCompact);
+
+  static void OnPrologue(v8::Isolate*, v8::GCType, v8::GCCallbackFlags,
+                         void* data) {
+    static_cast<PauseRecorder*>(data)->pause_start_ = Clock::now();
+  }
+
+  static void OnEpilogue(v8::Isolate*, v8::GCType type, v8::GCCallbackFlags,
+                         void* data) {
+    auto* recorder = static_cast<PauseRecorder*>(data);
+    double duration_us = std::chrono::duration<double, std::micro>(
+                             Clock::now() - recorder->pause_start_)
+                             .count();
+    recorder->PausesFor(type)->push_back(duration_us);
+  }
+
+  std::vector<double>* PausesFor(v8::GCType type) {
+    switch (type) {
+      case v8::kGCTypeScavenge:
+        return &scavenger_;
+      case v8::kGCTypeMinorMarkSweep:
+        return &minor_mark_sweep_;
+      default:
+        return &mark_compact_;
+    }
+  }
+
+  static double Percentile(const std::vector<double>& sorted, double p) {
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+  }
+
+  static void Report(benchmark::State& st, const std::string& collector,
+                     std::vector<double>* pauses) {
+    if (pauses->empty()) return;
+    std::sort(pauses->begin(), pauses->end());
+    st.counters[collector + "_count"] = static_cast<double>(pauses->size());
+    st.counters[collector + "_p50_us"] = Percentile(*pauses, 0.5);
+    st.counters[collector + "_p99_us"] = Percentile(*pauses, 0.99);
+    st.counters[collector + "_max_us"] = pauses->back();
+  }
+
+  v8::Isolate* const isolate_;
+  Clock::time_point pause_start_;
+  std::vector<double> scavenger_;
+  std::vector<double> minor_mark_sweep_;
+  std::vector<double> mark_compact_;
+};
+
+class GCPauses : public v8::benchmarking::BenchmarkWithContext {
+ protected:
+  // Runs |setup| once, then calls the function that |handler| evaluates to
+  // for every iteration, each of which stands for one request.
+  void Run(benchmark::State& st, const char* setup, const char* handler) {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = this->context();
+    CompileRun(setup);
+    v8::Local<v8::Function> function = CompileRun(handler).As<v8::Function>();
+    // Start from a clean heap so that the setup garbage isn't attributed to
+    // the workload.
+    v8_isolate()->LowMemoryNotification();
+    PauseRecorder recorder(v8_isolate());
+    for (auto _ : st) {
+      USE(_);
+      v8::HandleScope iteration_scope(v8_isolate());
+      v8::Local<v8::Value> result =
+          function->Call(context, context->Global(), 0, nullptr)
+              .ToLocalChecked();
+      benchmark::DoNotOptimize(result);
+    }
+    recorder.Report(st);
+  }
+};
+
+// A large, long-lived cache in the old generation that requests read from
+// and occasionally update, creating old-to-new references.
+constexpr char kCacheSetup[] =
+    "var cache = new Map();"
+    "for (var i = 0; i < 200_000; i++) {"
+    "  cache.set('key' + i, {id: i, name: 'entry' + i, tags: [i, i + 1]});"
+    "}";
+
+// Every request allocates a parsed body, headers and a response, all of
+// which die young.
+constexpr char kRequestHandler[] =
+    "(function() {"
+    "  var n = 0;"
+    "  for (var r = 0; r < 100; r++) {"
+    "    var request = {"
+    "      headers: {'content-type': 'application/json', 'x-id': 'id' + r},"
+    "      body: JSON.parse('{\"ids\": [1, 2, 3], \"query\": \"abc\"}'),"
+    "    };"
+    "    var entry = cache.get('key' + ((r * 7919) % cache.size));"
+    "    var response = {status: 200, entry: entry, ids: request.body.ids};"
+    "    n += JSON.stringify(response).length;"
+    "    if (r % 10 == 0) {"
+    "      cache.set('key' + r, {id: r, name: 'updated', tags: [n]});"
+    "    }"
+    "  }"
+    "  return n;"
+    "})";
+
+}  // namespace
+
+BENCHMARK_F(GCPauses, OldGenerationCache)(benchmark::State& st) {
+  Run(st, kCacheSetup, kRequestHandler);
+}
+
+// Requests that allocate short-lived buffers, as for I/O.
+BENCHMARK_F(GCPauses, ArrayBufferChurn)(benchmark::State& st) {
+  Run(st, kCacheSetup,
+      "(function() {"
+      "  var n = 0;"
+      "  for (var r = 0; r < 100; r++) {"
+      "    var buffer = new Uint8Array(64 * 1024);"
+      "    buffer[r] = r;"
+      "    n += buffer.length + cache.get('key' + r).id;"
+      "  }"
+      "  return n;"
+      "})");
+}
+
+// Requests that publish results through shared structs and arrays, which
+// live in the shared heap. Fields of shared structs may only hold shared
+// values, so the nested object is a shared struct as well.
+BENCHMARK_F(GCPauses, SharedStructs)(benchmark::State& st) {
+  v8::HandleScope handle_scope(v8_isolate());
+  if (CompileRun("typeof SharedStructType")
+          ->StrictEquals(v8_str("undefined"))) {
+    st.SkipWithError("requires --harmony-struct");
+    return;
+  }
+  Run(st,
+      "var Point = new SharedStructType(['x', 'y']);"
+      "var results = new SharedArray(1024);",
+      "(function() {"
+      "  for (var r = 0; r < 100; r++) {"
+      "    var p = new Point();"
+      "    p.x = r;"
+      "    p.y = new Point();"
+      "    p.y.x = r;"
+      "    results[r % results.length] = p;"
+      "  }"
+      "  return results.length;"
+      "})");
+}
@@ -0,0 +1,90 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the handle overhead of API callbacks that create many locals.
+// Compare builds with and without v8_enable_direct_handle (which follows
+// v8_enable_conservative_stack_scanning by default) to see how much direct
+// locals save over handle-block indirection.
+
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-object.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-template.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Sums the integer elements of its array argument. Every element read creates
+// a local, which is what a typical binding does when unpacking arguments.
+void SumElements(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::Isolate* isolate = info.GetIsolate();
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Array> array = info[0].As<v8::Array>();
+  int32_t sum = 0;
+  for (uint32_t i = 0; i < array->Length(); i++) {
+    v8::Local<v8::Value> element = array->Get(context, i).ToLocalChecked();
+    sum += element.As<v8::Int32>()->Value();
+  }
+  info.GetReturnValue().Set(sum);
+}
+
+// Same as SumElements, with a nested HandleScope per element as bindings do
+// for loops that must not grow the caller's scope.
+void SumElementsWithScopes(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::Isolate* isolate = info.GetIsolate();
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Array> array = info[0].As<v8::Array>();
+  int32_t sum = 0;
+  for (uint32_t i = 0; i < array->Length(); i++) {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Value> element = array->Get(context, i).ToLocalChecked();
+    sum += element.As<v8::Int32>()->Value();
+  }
+  info.GetReturnValue().Set(sum);
+}
+
+class Handles : public v8::benchmarking::BenchmarkWithContext {
+ protected:
+  v8::Local<v8::ObjectTemplate> GlobalTemplate() override {
+    v8::Isolate* isolate = v8_isolate();
+    v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate);
+    global->Set(isolate, "sumElements",
+                v8::FunctionTemplate::New(isolate, &SumElements));
+    global->Set(isolate, "sumElementsWithScopes",
+                v8::FunctionTemplate::New(isolate, &SumElementsWithScopes));
+    return global;
+  }
+
+  void Run(benchmark::State& st, const char* source) {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = this->context();
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context, v8_str(source)).ToLocalChecked();
+    for (auto _ : st) {
+      USE(_);
+      v8::HandleScope iteration_scope(v8_isolate());
+      v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+};
+
+}  // namespace
+
+BENCHMARK_F(Handles, CallbackCreatingLocals)(benchmark::State& st) {
+  Run(st,
+      "var a = Array.from({length: 64}, (_, i) => i);"
+      "for (var i = 0; i < 1_000; i++) sumElements(a);");
+}
+
+BENCHMARK_F(Handles, CallbackWithNestedScopes)(benchmark::State& st) {
+  Run(st,
+      "var a = Array.from({length: 64}, (_, i) => i);"
+      "for (var i = 0; i < 1_000; i++) sumElementsWithScopes(a);");
+}
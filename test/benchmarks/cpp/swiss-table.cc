@@ -0,0 +1,84 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/utils/random-number-generator.h"
+#include "src/objects/swiss-hash-table-helpers.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace swiss_table {
+namespace {
+
+constexpr size_t kCtrlTableSize = 4096;
+
+// Builds a control table filled to the maximum load factor of
+// SwissNameDictionary (7/8), with the remaining slots empty or deleted.
+std::vector<ctrl_t> MakeCtrlTable() {
+  base::RandomNumberGenerator rng(42);
+  std::vector<ctrl_t> ctrl(kCtrlTableSize + 16);
+  for (ctrl_t& c : ctrl) {
+    int value = rng.NextInt(128);
+    if (value < 112) {
+      c = static_cast<ctrl_t>(rng.NextInt(1 << kH2Bits));
+    } else {
+      c = value < 120 ? kEmpty : kDeleted;
+    }
+  }
+  return ctrl;
+}
+
+// Probes every group of the table for one H2 value, as a lookup does.
+template <typename Group>
+void BM_SwissTableGroupMatch(benchmark::State& state) {
+  std::vector<ctrl_t> ctrl = MakeCtrlTable();
+  h2_t hash = 0;
+  for (auto _ : state) {
+    USE(_);
+    int found = 0;
+    for (size_t offset = 0; offset < kCtrlTableSize; offset += Group::kWidth) {
+      for (int i : Group{ctrl.data() + offset}.Match(hash)) found += i;
+    }
+    benchmark::DoNotOptimize(found);
+    hash = (hash + 1) & ((1 << kH2Bits) - 1);
+  }
+  state.SetItemsProcessed(state.iterations() * kCtrlTableSize);
+}
+
+// Probes every group of the table for empty slots, as an insertion does.
+template <typename Group>
+void BM_SwissTableGroupMatchEmpty(benchmark::State& state) {
+  std::vector<ctrl_t> ctrl = MakeCtrlTable();
+  for (auto _ : state) {
+    USE(_);
+    int found = 0;
+    for (size_t offset = 0; offset < kCtrlTableSize; offset += Group::kWidth) {
+      auto empty = Group{ctrl.data() + offset}.MatchEmpty();
+      if (empty) found += empty.LowestBitSet();
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * kCtrlTableSize);
+}
+
+BENCHMARK_TEMPLATE(BM_SwissTableGroupMatch, GroupPortableImpl);
+BENCHMARK_TEMPLATE(BM_SwissTableGroupMatch, GroupSse2Polyfill);
+BENCHMARK_TEMPLATE(BM_SwissTableGroupMatchEmpty, GroupPortableImpl);
+BENCHMARK_TEMPLATE(BM_SwissTableGroupMatchEmpty, GroupSse2Polyfill);
+#if V8_SWISS_TABLE_HAVE_SSE2_HOST
+BENCHMARK_TEMPLATE(BM_SwissTableGroupMatch, GroupSse2Impl);
+BENCHMARK_TEMPLATE(BM_SwissTableGroupMatchEmpty, GroupSse2Impl);
+#endif
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+BENCHMARK_TEMPLATE(BM_SwissTableGroupMatch, GroupNeonImpl);
+BENCHMARK_TEMPLATE(BM_SwissTableGroupMatchEmpty, GroupNeonImpl);
+#endif
+
+}  // namespace
+}  // namespace swiss_table
+}  // namespace internal
+}  // namespace v8
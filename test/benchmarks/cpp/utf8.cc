@@ -0,0 +1,115 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Roughly the size of an HTTP request body.
+constexpr size_t kInputSize = 16 * 1024;
+
+enum class Text { kAscii, kLatin1, kMostlyAscii, kCjk };
+
+// Builds about kInputSize bytes of UTF-8 of the given kind.
+std::string MakeInput(Text text) {
+  const char* chunk = nullptr;
+  switch (text) {
+    case Text::kAscii:
+      chunk = "GET /index.html HTTP/1.1\r\nHost: example.com\r\n";
+      break;
+    case Text::kLatin1:
+      chunk = "caf\xC3\xA9 cr\xC3\xA8me br\xC3\xBBl\xC3\xA9" "e ";
+      break;
+    case Text::kMostlyAscii:
+      chunk = "{\"name\": \"J\xC3\xBCrgen\", \"city\": \"M\xC3\xBCnchen\"}, ";
+      break;
+    case Text::kCjk:
+      chunk = "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87";
+      break;
+  }
+  std::string result;
+  while (result.size() < kInputSize) result += chunk;
+  return result;
+}
+
+class Utf8 : public v8::benchmarking::BenchmarkWithIsolate {
+ protected:
+  void NewFromUtf8(benchmark::State& st, Text text) {
+    std::string input = MakeInput(text);
+    v8::HandleScope handle_scope(v8_isolate());
+    for (auto _ : st) {
+      USE(_);
+      v8::HandleScope iteration_scope(v8_isolate());
+      v8::Local<v8::String> string =
+          v8::String::NewFromUtf8(v8_isolate(), input.data(),
+                                  v8::NewStringType::kNormal,
+                                  static_cast<int>(input.size()))
+              .ToLocalChecked();
+      benchmark::DoNotOptimize(string);
+    }
+    st.SetBytesProcessed(st.iterations() * input.size());
+  }
+
+  void WriteUtf8(benchmark::State& st, Text text) {
+    std::string input = MakeInput(text);
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::String> string =
+        v8::String::NewFromUtf8(v8_isolate(), input.data(),
+                                v8::NewStringType::kNormal,
+                                static_cast<int>(input.size()))
+            .ToLocalChecked();
+    std::vector<char> buffer(string->Utf8Length(v8_isolate()) + 1);
+    for (auto _ : st) {
+      USE(_);
+      int written =
+          string->WriteUtf8(v8_isolate(), buffer.data(),
+                            static_cast<int>(buffer.size()), nullptr,
+                            v8::String::NO_NULL_TERMINATION);
+      benchmark::DoNotOptimize(written);
+      benchmark::ClobberMemory();
+    }
+    st.SetBytesProcessed(st.iterations() * input.size());
+  }
+};
+
+BENCHMARK_F(Utf8, NewFromUtf8Ascii)(benchmark::State& st) {
+  NewFromUtf8(st, Text::kAscii);
+}
+
+BENCHMARK_F(Utf8, NewFromUtf8Latin1)(benchmark::State& st) {
+  NewFromUtf8(st, Text::kLatin1);
+}
+
+BENCHMARK_F(Utf8, NewFromUtf8MostlyAscii)(benchmark::State& st) {
+  NewFromUtf8(st, Text::kMostlyAscii);
+}
+
+BENCHMARK_F(Utf8, NewFromUtf8Cjk)(benchmark::State& st) {
+  NewFromUtf8(st, Text::kCjk);
+}
+
+BENCHMARK_F(Utf8, WriteUtf8Ascii)(benchmark::State& st) {
+  WriteUtf8(st, Text::kAscii);
+}
+
+BENCHMARK_F(Utf8, WriteUtf8Latin1)(benchmark::State& st) {
+  WriteUtf8(st, Text::kLatin1);
+}
+
+BENCHMARK_F(Utf8, WriteUtf8MostlyAscii)(benchmark::State& st) {
+  WriteUtf8(st, Text::kMostlyAscii);
+}
+
+BENCHMARK_F(Utf8, WriteUtf8Cjk)(benchmark::State& st) {
+  WriteUtf8(st, Text::kCjk);
+}
+
+}  // namespace
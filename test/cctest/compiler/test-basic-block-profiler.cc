@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <sstream>
+
 #include "src/diagnostics/basic-block-profiler.h"
 #include "src/objects/objects-inl.h"
 #include "test/cctest/cctest.h"
@@ -140,6 +142,31 @@ TEST(ProfileLoop) {
   }
 }
 
+TEST(ProfileOptimizedJSFunction) {
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.turbo_profiling = true;
+  v8_flags.turbo_profiling_js = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  CompileRun(
+      "function profiled(x) { return x > 0 ? x : -x; }\n"
+      "%PrepareFunctionForOptimization(profiled);\n"
+      "profiled(1); profiled(-1);\n"
+      "%OptimizeFunctionOnNextCall(profiled);\n"
+      "for (let i = 0; i < 10; ++i) profiled(i);\n");
+
+  CHECK(BasicBlockProfiler::Get()->HasData(isolate));
+  std::ostringstream os;
+  BasicBlockProfiler::Get()->Log(isolate, os);
+  std::string log = os.str();
+  // Records are keyed on the debug name and start position of the function.
+  CHECK_NE(std::string::npos, log.find("block\tprofiled@"));
+  CHECK_NE(std::string::npos, log.find("builtin_hash\tprofiled@"));
+  BasicBlockProfiler::Get()->ResetCounts(isolate);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -43,6 +43,7 @@
 #include "src/execution/execution.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/factory.h"
 #include "src/heap/gc-tracer.h"
@@ -56,6 +57,7 @@
 #include "src/heap/mark-compact.h"
 #include "src/heap/marking-barrier.h"
 #include "src/heap/marking-state-inl.h"
+#include "src/heap/memory-allocator.h"
 #include "src/heap/memory-reducer.h"
 #include "src/heap/mutable-page-metadata.h"
 #include "src/heap/parked-scope.h"
@@ -72,6 +74,7 @@
 #include "src/objects/managed-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/slots.h"
+#include "src/objects/string-table.h"
 #include "src/objects/transitions.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/snapshot.h"
@@ -736,6 +739,39 @@ TEST(StringTable) {
   CheckInternalizedStrings(not_so_random_string_table);
 }
 
+TEST(StringTableLookupOrInsertMany) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // Mix already internalized strings, new strings, and duplicates within the
+  // same batch.
+  const char* strings[] = {"break", "lookupOrInsertMany0", "case",
+                           "lookupOrInsertMany1", "lookupOrInsertMany0"};
+  constexpr size_t kNumStrings = arraysize(strings);
+  factory->InternalizeUtf8String("break");
+  factory->InternalizeUtf8String("case");
+
+  std::vector<OneByteStringKey> keys;
+  std::vector<OneByteStringKey*> key_pointers;
+  keys.reserve(kNumStrings);
+  for (const char* string : strings) {
+    keys.emplace_back(base::OneByteVector(string), HashSeed(isolate));
+    key_pointers.push_back(&keys.back());
+  }
+  std::vector<Handle<String>> results(kNumStrings);
+  isolate->string_table()->LookupOrInsertMany(
+      isolate, base::VectorOf(key_pointers), base::VectorOf(results));
+
+  for (size_t i = 0; i < kNumStrings; ++i) {
+    CHECK(IsInternalizedString(*results[i]));
+    CHECK(results[i]->IsOneByteEqualTo(base::CStrVector(strings[i])));
+    CHECK_EQ(*factory->InternalizeUtf8String(strings[i]), *results[i]);
+  }
+  CHECK_EQ(*results[1], *results[4]);
+}
+
 TEST(FunctionAllocation) {
   CcTest::InitializeVM();
   Isolate* isolate = CcTest::i_isolate();
@@ -1146,6 +1182,61 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingAdaptiveAge) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.flush_code_based_on_memory_pressure = true;
+  i::v8_flags.bytecode_old_age = 6;
+  i::v8_flags.bytecode_max_old_age = 48;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  Factory* factory = i_isolate->factory();
+  BytecodeFlushingPolicy* policy = heap->bytecode_flushing_policy();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    IndirectHandle<String> foo_name = factory->InternalizeUtf8String("foo");
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun("function foo() { return 42; }; foo()");
+    }
+    IndirectHandle<JSFunction> function = Cast<JSFunction>(
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked());
+    CHECK(function->shared()->is_compiled());
+    CHECK_EQ(6, policy->old_age());
+
+    i::SharedFunctionInfo::EnsureOldForTesting(function->shared());
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK(!function->shared()->is_compiled());
+
+    // Needing the flushed bytecode again makes the next GC keep bytecode for
+    // longer.
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK_GT(policy->old_age(), 6);
+    CHECK_LE(policy->old_age(), 48);
+  }
+}
+
 static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
 #if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
   v8_flags.turbofan = false;
@@ -7471,6 +7562,37 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+UNINITIALIZED_TEST(ReusePagesAcrossIsolates) {
+  v8_flags.reuse_pages_across_isolates = true;
+  if (!MemoryAllocator::ShouldReusePagesAcrossIsolates()) return;
+  MemoryAllocator::Pool* pool = MemoryAllocator::process_wide_pool();
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      PtrComprCageAccessScope ptr_compr_cage_access_scope(i_isolate);
+      HandleScope scope(i_isolate);
+      for (int i = 0; i < 10; i++) {
+        i_isolate->factory()->NewFixedArray(10000, AllocationType::kOld);
+      }
+    }
+    isolate->Dispose();
+  }
+  const size_t pooled_chunks = pool->NumberOfCommittedChunks();
+  CHECK_LT(0u, pooled_chunks);
+
+  // Setting up the heap of a new isolate takes pages from the pool.
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  CHECK_GT(pooled_chunks, pool->NumberOfCommittedChunks());
+  isolate->Dispose();
+  MemoryAllocator::ReleaseProcessWidePooledChunks();
+  CHECK_EQ(0u, pool->NumberOfCommittedChunks());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -49,6 +49,7 @@
 #include "include/v8-json.h"
 #include "include/v8-locker.h"
 #include "include/v8-primitive-object.h"
+#include "include/v8-profiler.h"
 #include "include/v8-regexp.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
@@ -672,6 +673,46 @@ TEST(ScriptUsingOneByteStringResource) {
   CHECK_EQ(1, dispose_count);
 }
 
+TEST(NewExternalFromUtf8) {
+  int dispose_count = 0;
+  {
+    LocalContext env;
+    v8::HandleScope scope(env->GetIsolate());
+    // ASCII data is used in place.
+    TestOneByteResource* ascii_resource =
+        new TestOneByteResource(i::StrDup("ascii"), &dispose_count);
+    Local<String> ascii =
+        String::NewExternalFromUtf8(env->GetIsolate(), ascii_resource)
+            .ToLocalChecked();
+    CHECK(ascii->IsExternalOneByte());
+    CHECK_EQ(static_cast<const String::ExternalStringResourceBase*>(
+                 ascii_resource),
+             ascii->GetExternalOneByteStringResource());
+    CHECK(v8_str("ascii")->StrictEquals(ascii));
+
+    // Anything else is transcoded, and the resource is released right away.
+    TestOneByteResource* utf8_resource = new TestOneByteResource(
+        i::StrDup("caf\xC3\xA9 \xF0\x9F\x98\x8D"), &dispose_count);
+    Local<String> utf8 =
+        String::NewExternalFromUtf8(env->GetIsolate(), utf8_resource)
+            .ToLocalChecked();
+    CHECK_EQ(1, dispose_count);
+    CHECK(!utf8->IsExternal());
+    CHECK_EQ(7, utf8->Length());
+    CHECK(v8_str("caf\xC3\xA9 \xF0\x9F\x98\x8D")->StrictEquals(utf8));
+    i::heap::InvokeMajorGC(CcTest::heap());
+    CHECK_EQ(1, dispose_count);
+  }
+  {
+    // We need to invoke GC without stack, otherwise the resource may not be
+    // reclaimed because of conservative stack scanning.
+    i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        CcTest::heap());
+    i::heap::InvokeMemoryReducingMajorGCs(CcTest::heap());
+  }
+  CHECK_EQ(2, dispose_count);
+}
+
 TEST(ScriptMakingExternalString) {
   int dispose_count = 0;
   uint16_t* two_byte_source = AsciiToTwoByteString(u"1 + 2 * 3 /* π */");
@@ -17120,6 +17161,113 @@ TEST(GetHeapSpaceStatistics) {
   CHECK_EQ(total_physical_size, heap_statistics.total_physical_size());
 }
 
+TEST(GetHeapSpaceFreeListStatistics) {
+  if (i::v8_flags.stress_concurrent_allocation) return;
+
+  LocalContext c1;
+  v8::Isolate* isolate = c1->GetIsolate();
+  v8::HandleScope scope(isolate);
+  i::heap::InvokeMajorGC(CcTest::heap());
+
+  for (size_t i = 0; i < isolate->NumberOfHeapSpaces(); ++i) {
+    v8::HeapSpaceStatistics space_statistics;
+    isolate->GetHeapSpaceStatistics(&space_statistics, i);
+    CHECK_LE(space_statistics.space_free_list_size(),
+             space_statistics.space_available_size());
+
+    v8::HeapFreeListStatistics size_classes[64];
+    size_t count = isolate->GetHeapSpaceFreeListStatistics(
+        i, v8::MemorySpan<v8::HeapFreeListStatistics>(size_classes));
+    CHECK_LE(count, arraysize(size_classes));
+    // The size classes partition the free list.
+    size_t total_free_size = 0;
+    for (size_t j = 0; j < count; ++j) {
+      if (j > 0) {
+        CHECK_LT(size_classes[j - 1].min_block_size(),
+                 size_classes[j].min_block_size());
+      }
+      total_free_size += size_classes[j].free_size();
+    }
+    CHECK_EQ(space_statistics.space_free_list_size(), total_free_size);
+  }
+}
+
+TEST(GetHeapObjectStatisticsFromMarking) {
+  if (i::v8_flags.track_gc_object_stats) return;
+  i::v8_flags.track_gc_instance_type_stats = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  CompileRun(
+      "var arrays = [];"
+      "for (var i = 0; i < 100; i++) arrays.push([i]);");
+  i::heap::InvokeMajorGC(CcTest::heap());
+
+  v8::HeapObjectStatistics object_statistics;
+  CHECK(isolate->GetHeapObjectStatisticsAtLastGC(&object_statistics,
+                                                 i::JS_ARRAY_TYPE));
+  CHECK_EQ(0, strcmp("JS_ARRAY_TYPE", object_statistics.object_type()));
+  CHECK_LE(100u, object_statistics.object_count());
+  CHECK_LE(100u * i::JSArray::kHeaderSize, object_statistics.object_size());
+}
+
+TEST(GetHeapCodeAndMetadataStatistics) {
+  if (!i::v8_flags.turbofan || i::v8_flags.always_turbofan) return;
+  i::v8_flags.allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::HeapCodeStatistics before;
+  CHECK(isolate->GetHeapCodeAndMetadataStatistics(&before));
+
+  CompileRun(
+      "function f(o) { return o.x + o.y; }"
+      "%PrepareFunctionForOptimization(f);"
+      "f({x: 1, y: 2});"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f({x: 1, y: 2});");
+
+  v8::HeapCodeStatistics after;
+  CHECK(isolate->GetHeapCodeAndMetadataStatistics(&after));
+  CHECK_LT(before.deoptimization_data_size(), after.deoptimization_data_size());
+  CHECK_LE(after.deoptimization_data_size(), after.code_and_metadata_size());
+}
+
+TEST(TakeICTransitionSamples) {
+  if (!i::v8_flags.use_ic) return;
+  i::v8_flags.allow_natives_syntax = true;
+  i::v8_flags.ic_transition_sampling_interval = 1;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  CompileRun(
+      "function f(o) { return o.x; }"
+      "%EnsureFeedbackVectorForFunction(f);"
+      "f({x: 1});"
+      "f({y: 2, x: 1});");
+
+  v8::ICTransitionSample samples[4];
+  size_t count = isolate->TakeICTransitionSamples(samples);
+  bool found = false;
+  for (size_t i = 0; i < count; ++i) {
+    if (samples[i].new_state == 'P') {
+      CHECK(!samples[i].is_keyed);
+      CHECK_EQ('1', samples[i].old_state);
+      CHECK_EQ(0, strcmp("LoadIC", samples[i].ic_type));
+      CHECK_LE(0, samples[i].script_id);
+      CHECK_LE(0, samples[i].position);
+      found = true;
+    }
+  }
+  CHECK(found);
+  // The samples have been taken.
+  CHECK_EQ(0u, isolate->TakeICTransitionSamples(samples));
+  i::v8_flags.ic_transition_sampling_interval = 0;
+}
+
 TEST(NumberOfNativeContexts) {
   static const size_t kNumTestContexts = 10;
   i::Isolate* isolate = CcTest::i_isolate();
@@ -21003,6 +21151,34 @@ THREADED_TEST(JSONParseNumber) {
   ExpectString("JSON.stringify(obj)", "42");
 }
 
+THREADED_TEST(JSONRegisterShape) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  Local<Object> shape = CompileRun("({x: 1, y: 'a'})").As<Object>();
+  CHECK(v8::JSON::RegisterShape(context.local(), shape));
+
+  Local<Value> obj =
+      v8::JSON::Parse(context.local(), v8_str("{\"x\":2,\"y\":\"b\"}"))
+          .ToLocalChecked();
+  CHECK_EQ(v8::Utils::OpenDirectHandle(*shape)->map(),
+           v8::Utils::OpenDirectHandle(*obj.As<Object>())->map());
+
+  // Objects with other property names or order don't use the shape.
+  obj = v8::JSON::Parse(context.local(), v8_str("{\"y\":3,\"x\":\"c\"}"))
+            .ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("JSON.stringify(obj)", "{\"y\":3,\"x\":\"c\"}");
+
+  // Shapes that JSON.parse can't produce are rejected.
+  CHECK(!v8::JSON::RegisterShape(context.local(),
+                                 CompileRun("({get x() { return 1; }})")
+                                     .As<Object>()));
+  CHECK(!v8::JSON::RegisterShape(context.local(),
+                                 CompileRun("[1, 2]").As<Object>()));
+  CHECK(!v8::JSON::RegisterShape(
+      context.local(), CompileRun("Object.create(null)").As<Object>()));
+}
+
 namespace {
 void TestJSONParseArray(Local<Context> context, const char* input_str,
                         const char* expected_output_str,
@@ -21068,6 +21244,97 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class JSONTestStream : public v8::OutputStream {
+ public:
+  explicit JSONTestStream(int chunk_size, int abort_after_chunks = -1)
+      : chunk_size_(chunk_size), abort_after_chunks_(abort_after_chunks) {}
+
+  void EndOfStream() override { ended_ = true; }
+  int GetChunkSize() override { return chunk_size_; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK_LE(size, chunk_size_);
+    output_.append(data, size);
+    if (++chunks_ == abort_after_chunks_) return kAbort;
+    return kContinue;
+  }
+
+  const std::string& output() const { return output_; }
+  int chunks() const { return chunks_; }
+  bool ended() const { return ended_; }
+
+ private:
+  const int chunk_size_;
+  const int abort_after_chunks_;
+  std::string output_;
+  int chunks_ = 0;
+  bool ended_ = false;
+};
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  // Large enough to fill several parts, with one-byte and two-byte strings
+  // and a surrogate pair.
+  Local<Value> obj = CompileRun(
+      "var obj = [];"
+      "for (let i = 0; i < 2000; i++) {"
+      "  obj.push({name: 'item' + i, text: '\\u00e9\\u{1F600}', v: i / 2});"
+      "}"
+      "obj");
+  v8::String::Utf8Value expected(
+      isolate, v8::JSON::Stringify(context.local(), obj).ToLocalChecked());
+
+  JSONTestStream stream(7);
+  CHECK(v8::JSON::StringifyToStream(context.local(), obj, &stream)
+            .FromJust());
+  CHECK(stream.ended());
+  CHECK_EQ(std::string(*expected), stream.output());
+
+  // Aborting stops the output and skips EndOfStream.
+  JSONTestStream aborting_stream(16, 3);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), obj, &aborting_stream)
+             .FromJust());
+  CHECK(!aborting_stream.ended());
+  CHECK_EQ(3, aborting_stream.chunks());
+
+  // Serialization stops with the stream, so no more chunks are written and
+  // no more user code runs.
+  Local<Value> counted = CompileRun(
+      "var calls = 0;"
+      "var counted = [];"
+      "for (let i = 0; i < 10000; i++) {"
+      "  counted.push({toJSON() { calls++; return 'value' + i; }});"
+      "}"
+      "counted");
+  JSONTestStream early_abort_stream(16, 1);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), counted,
+                                     &early_abort_stream)
+             .FromJust());
+  CHECK_EQ(1, early_abort_stream.chunks());
+  CHECK_LT(CompileRun("calls")->Int32Value(context.local()).FromJust(), 10000);
+
+  // Values without a JSON representation write nothing.
+  JSONTestStream undefined_stream(16);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), v8::Undefined(isolate),
+                                     &undefined_stream)
+             .FromJust());
+  CHECK(undefined_stream.output().empty());
+
+  // Exceptions are propagated.
+  v8::TryCatch try_catch(isolate);
+  JSONTestStream throwing_stream(16);
+  CHECK(v8::JSON::StringifyToStream(
+            context.local(),
+            CompileRun("({toJSON() { throw new Error('boom'); }})"),
+            &throwing_stream)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK(!throwing_stream.ended());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -28,7 +28,11 @@
 // Tests of the CPU profiler and utilities.
 
 #include <limits>
+#include <map>
 #include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 #include "include/libplatform/v8-tracing.h"
 #include "include/v8-fast-api-calls.h"
@@ -4904,6 +4908,179 @@ TEST(CpuProfileJSONSerialization) {
             ->Value() > 0);
 }
 
+TEST(CpuProfilePprofSerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::CpuProfiler* cpu_profiler = v8::CpuProfiler::New(env->GetIsolate());
+
+  v8::Local<v8::String> name = v8_str("1");
+  cpu_profiler->StartProfiling(name);
+  v8::CpuProfile* profile = cpu_profiler->StopProfiling(name);
+  CHECK(profile);
+
+  TestJSONStream stream;
+  profile->Serialize(&stream, v8::CpuProfile::kPprof);
+  profile->Delete();
+  cpu_profiler->Dispose();
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  base::ScopedVector<char> pprof(stream.size());
+  stream.WriteTo(pprof);
+
+  // The message starts with the empty string table entry: field 6, wire
+  // type 2, length 0.
+  CHECK_EQ(0x32, pprof[0]);
+  CHECK_EQ(0, pprof[1]);
+  // Followed by the strings of the first sample type.
+  std::string bytes(pprof.begin(), pprof.length());
+  CHECK_NE(std::string::npos, bytes.find("samples"));
+  CHECK_NE(std::string::npos, bytes.find("nanoseconds"));
+}
+
+namespace {
+
+// Minimal reader for the top-level fields of a protobuf message.
+class ProtoReader {
+ public:
+  ProtoReader(const char* data, size_t size)
+      : data_(reinterpret_cast<const uint8_t*>(data)), size_(size) {}
+
+  bool done() const { return pos_ >= size_; }
+
+  uint64_t ReadVarint() {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(pos_, size_);
+      uint8_t byte = data_[pos_++];
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) return value;
+    }
+  }
+
+  // Reads the next field. Varint fields are returned in {value}, length
+  // delimited ones in {bytes}.
+  int ReadField(uint64_t* value, std::string* bytes) {
+    uint64_t tag = ReadVarint();
+    int wire_type = static_cast<int>(tag & 7);
+    if (wire_type == 0) {
+      *value = ReadVarint();
+    } else {
+      CHECK_EQ(2, wire_type);
+      uint64_t length = ReadVarint();
+      CHECK_LE(pos_ + length, size_);
+      bytes->assign(reinterpret_cast<const char*>(data_ + pos_), length);
+      pos_ += length;
+    }
+    return static_cast<int>(tag >> 3);
+  }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t pos_ = 0;
+};
+
+}  // namespace
+
+TEST(CpuProfilePprofSerializationWithSamples) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(
+      "function pprofLoop(timeout) {\n"
+      "  var start = Date.now();\n"
+      "  do {\n"
+      "    for (var i = 0; i < 1000; ++i) {}\n"
+      "  } while (Date.now() - start < timeout);\n"
+      "}\n");
+  v8::Local<v8::Function> function = GetFunction(env.local(), "pprofLoop");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 10)};
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile = helper.Run(function, args, arraysize(args), 50);
+
+  TestJSONStream stream;
+  profile->Serialize(&stream, v8::CpuProfile::kPprof);
+  profile->Delete();
+  CHECK_EQ(1, stream.eos_signaled());
+  base::ScopedVector<char> pprof(stream.size());
+  stream.WriteTo(pprof);
+
+  std::vector<std::string> strings;
+  std::map<uint64_t, uint64_t> function_names;
+  std::set<uint64_t> location_ids;
+  std::vector<std::string> samples;
+  ProtoReader reader(pprof.begin(), pprof.length());
+  while (!reader.done()) {
+    uint64_t value;
+    std::string bytes;
+    switch (reader.ReadField(&value, &bytes)) {
+      case 6:  // string_table
+        strings.push_back(bytes);
+        break;
+      case 5: {  // function
+        ProtoReader fields(bytes.data(), bytes.size());
+        uint64_t id = 0, name = 0;
+        while (!fields.done()) {
+          std::string unused;
+          uint64_t field_value = 0;
+          int field = fields.ReadField(&field_value, &unused);
+          if (field == 1) id = field_value;
+          if (field == 2) name = field_value;
+        }
+        CHECK_NE(0, id);
+        function_names[id] = name;
+        break;
+      }
+      case 4: {  // location
+        ProtoReader fields(bytes.data(), bytes.size());
+        std::string unused;
+        uint64_t id = 0;
+        CHECK_EQ(1, fields.ReadField(&id, &unused));
+        CHECK_NE(0, id);
+        location_ids.insert(id);
+        break;
+      }
+      case 2:  // sample
+        samples.push_back(bytes);
+        break;
+      default:
+        break;
+    }
+  }
+
+  CHECK(!strings.empty());
+  CHECK(strings[0].empty());
+  CHECK(!function_names.empty());
+  CHECK(!location_ids.empty());
+  CHECK(!samples.empty());
+
+  // Every sample references known locations and carries two values.
+  for (const std::string& sample : samples) {
+    ProtoReader fields(sample.data(), sample.size());
+    uint64_t unused;
+    std::string ids, values;
+    CHECK_EQ(1, fields.ReadField(&unused, &ids));
+    CHECK_EQ(2, fields.ReadField(&unused, &values));
+    ProtoReader id_reader(ids.data(), ids.size());
+    CHECK(!id_reader.done());
+    while (!id_reader.done()) {
+      CHECK_EQ(1u, location_ids.count(id_reader.ReadVarint()));
+    }
+    ProtoReader value_reader(values.data(), values.size());
+    CHECK_GT(value_reader.ReadVarint(), 0);
+    CHECK_GT(value_reader.ReadVarint(), 0);
+    CHECK(value_reader.done());
+  }
+
+  // The profiled JS function is among the functions.
+  bool found = false;
+  for (const auto& [id, name] : function_names) {
+    CHECK_LT(name, strings.size());
+    if (strings[name] == "pprofLoop") found = true;
+  }
+  CHECK(found);
+}
+
 }  // namespace test_cpu_profiler
 }  // namespace internal
 }  // namespace v8
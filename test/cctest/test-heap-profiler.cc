@@ -1238,6 +1238,40 @@ TEST(HeapSnapshotJSONSerialization) {
 }
 
 
+TEST(HeapSnapshotJSONSerializationToStream) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = new A('streamed');");
+  int snapshot_count = heap_profiler->GetSnapshotCount();
+  v8::internal::TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  // The snapshot is not retained.
+  CHECK_EQ(snapshot_count, heap_profiler->GetSnapshotCount());
+
+  v8::base::ScopedVector<char> json(stream.size());
+  stream.WriteTo(json);
+  v8::internal::OneByteResource* json_res =
+      new v8::internal::OneByteResource(json);
+  v8::Local<v8::String> json_string =
+      v8::String::NewExternalOneByte(env->GetIsolate(), json_res)
+          .ToLocalChecked();
+  v8::Local<v8::Value> parsed =
+      v8::JSON::Parse(env.local(), json_string).ToLocalChecked();
+  CHECK(parsed->IsObject());
+  env->Global()->Set(env.local(), v8_str("parsed"), parsed).FromJust();
+  CHECK(CompileRun(
+            "var s = parsed.snapshot, m = s.meta;\n"
+            "parsed.nodes.length == s.node_count * m.node_fields.length &&\n"
+            "parsed.edges.length == s.edge_count * m.edge_fields.length &&\n"
+            "parsed.strings.indexOf('streamed') != -1")
+            ->IsTrue());
+}
+
 TEST(HeapSnapshotJSONSerializationAborting) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -3796,6 +3830,46 @@ TEST(SamplingHeapProfiler) {
   }
 }
 
+TEST(SamplingHeapProfilerAllocationPositions) {
+  i::v8_flags.allow_natives_syntax = true;
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  i::v8_flags.sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(
+      1024, 16, v8::HeapProfiler::kSamplingIncludeAllocationPositions);
+  CompileRun(
+      "var A = [];\n"
+      "function allocate() {\n"
+      "  for (var i = 0; i < 1024; ++i) A.push(new Array(1024));\n"
+      "  for (var i = 0; i < 1024; ++i) A.push(new Array(1024));\n"
+      "}\n"
+      "%NeverOptimizeFunction(allocate);\n"
+      "allocate();\n");
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+
+  // Both loops allocate, so there is a node for each of their lines rather
+  // than a single one for the function.
+  bool found_line[2] = {false, false};
+  for (v8::AllocationProfile::Node* child : profile->GetRootNode()->children) {
+    v8::String::Utf8Value child_name(env->GetIsolate(), child->name);
+    if (strcmp(*child_name, "allocate") != 0) continue;
+    CHECK(child->line_number == 3 || child->line_number == 4);
+    CHECK_GT(NumberOfAllocations(child), 0);
+    found_line[child->line_number - 3] = true;
+  }
+  CHECK(found_line[0]);
+  CHECK(found_line[1]);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerRateAgnosticEstimates) {
   i::v8_flags.allow_natives_syntax = true;
   v8::HandleScope scope(CcTest::isolate());
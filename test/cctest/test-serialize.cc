@@ -41,6 +41,7 @@
 #include "src/api/api-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
+#include "src/codegen/process-wide-code-cache.h"
 #include "src/codegen/script-details.h"
 #include "src/common/assert-scope.h"
 #include "src/debug/debug-coverage.h"
@@ -53,6 +54,7 @@
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/literal-objects-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/runtime/runtime.h"
 #include "src/snapshot/code-serializer.h"
@@ -3025,6 +3027,120 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+TEST(ProcessWideCodeCache) {
+  // We test that no compilations happen when running this code.
+  v8_flags.always_turbofan = false;
+  v8_flags.process_wide_code_cache = true;
+  const char* js_source =
+      "function f() {"
+      "  return function g() {"
+      "    return 'abc';"
+      "  }"
+      "}"
+      "f()() + 'def'";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  for (int i = 0; i < 2; i++) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope iscope(isolate);
+      v8::HandleScope scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+
+      v8::ScriptCompiler::Source source(v8_str(js_source),
+                                        v8::ScriptOrigin(v8_str("test")));
+      v8::Local<v8::UnboundScript> script;
+      if (i == 0) {
+        // The first isolate compiles everything eagerly and adds the result
+        // to the cache.
+        script = v8::ScriptCompiler::CompileUnboundScript(
+                     isolate, &source, v8::ScriptCompiler::kEagerCompile)
+                     .ToLocalChecked();
+      } else {
+        // The second one reuses it, including the bytecode of f and g.
+        DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate));
+        script = v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+                     .ToLocalChecked();
+      }
+      v8::Local<v8::Value> result;
+      {
+        DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate));
+        result = script->BindToCurrentContext()->Run(context).ToLocalChecked();
+      }
+      CHECK(result->ToString(context)
+                .ToLocalChecked()
+                ->Equals(context, v8_str("abcdef"))
+                .FromJust());
+      // The script is added to the cache by a task.
+      while (v8::platform::PumpMessageLoop(V8::GetCurrentPlatform(), isolate)) {
+      }
+      CHECK_EQ(size_t{1},
+               ProcessWideCodeCache::Get()->entry_count_for_testing());
+    }
+    isolate->Dispose();
+  }
+}
+
+namespace {
+
+void CompileForProcessWideCodeCache(v8::Isolate* isolate,
+                                    const char* js_source) {
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  v8::ScriptCompiler::Source source(v8_str(js_source),
+                                    v8::ScriptOrigin(v8_str("test")));
+  v8::ScriptCompiler::CompileUnboundScript(isolate, &source).ToLocalChecked();
+  while (v8::platform::PumpMessageLoop(V8::GetCurrentPlatform(), isolate)) {
+  }
+}
+
+}  // namespace
+
+TEST(ProcessWideCodeCacheEviction) {
+  v8_flags.process_wide_code_cache = true;
+  ProcessWideCodeCache* cache = ProcessWideCodeCache::Get();
+  const char* source_a = "function f() { return 'aaa'; }; f();";
+  const char* source_b = "function f() { return 'bbb'; }; f();";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    size_t size_before = cache->size_for_testing();
+    CompileForProcessWideCodeCache(isolate, source_a);
+    size_t entry_size = cache->size_for_testing() - size_before;
+    CHECK_LT(size_t{0}, entry_size);
+
+    // Leave room for about one and a half scripts. Adding the second one
+    // evicts the first, which is the least recently used.
+    size_t old_max_size = v8_flags.process_wide_code_cache_max_size;
+    v8_flags.process_wide_code_cache_max_size =
+        cache->size_for_testing() + entry_size / 2;
+    size_t count = cache->entry_count_for_testing();
+    CompileForProcessWideCodeCache(isolate, source_b);
+    CHECK_EQ(count, cache->entry_count_for_testing());
+    CHECK_LE(cache->size_for_testing(),
+             v8_flags.process_wide_code_cache_max_size);
+
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    v8::HandleScope scope(isolate);
+    ScriptDetails script_details(i_isolate->factory()->empty_string());
+    CHECK_NULL(cache->Lookup(i_isolate,
+                             i_isolate->factory()->NewStringFromAsciiChecked(
+                                 source_a),
+                             script_details));
+    CHECK_NOT_NULL(cache->Lookup(
+        i_isolate, i_isolate->factory()->NewStringFromAsciiChecked(source_b),
+        script_details));
+    v8_flags.process_wide_code_cache_max_size = old_max_size;
+  }
+  isolate->Dispose();
+}
+
 TEST(CodeSerializerAfterExecute) {
   // We test that no compilations happen when running this code. Forcing
   // to always optimize breaks this test.
@@ -3078,6 +3194,122 @@ TEST(CodeSerializerAfterExecute) {
   v8_flags.always_turbofan = prev_always_turbofan_value;
 }
 
+namespace {
+
+// Returns whether the literal site of the function {name} is tenured.
+bool LiteralSiteIsTenured(v8::Local<v8::Context> context, const char* name) {
+  auto function = Cast<JSFunction>(v8::Utils::OpenDirectHandle(
+      *context->Global()->Get(context, v8_str(name)).ToLocalChecked()));
+  DisallowGarbageCollection no_gc;
+  Tagged<FeedbackVector> vector = function->feedback_vector();
+  FeedbackMetadataIterator slots(vector->metadata());
+  while (slots.HasNext()) {
+    FeedbackSlot slot = slots.Next();
+    if (slots.kind() != FeedbackSlotKind::kLiteral) continue;
+    Tagged<HeapObject> site;
+    if (!vector->Get(slot).GetHeapObjectIfStrong(&site)) return false;
+    if (!IsAllocationSite(site)) return false;
+    return Cast<AllocationSite>(site)->GetAllocationType() ==
+           AllocationType::kOld;
+  }
+  UNREACHABLE();
+}
+
+// Returns whether the boilerplate description of the literal of the function
+// {name} carries a pretenure hint.
+bool LiteralHasPretenureHint(v8::Local<v8::Context> context, const char* name) {
+  auto function = Cast<JSFunction>(v8::Utils::OpenDirectHandle(
+      *context->Global()->Get(context, v8_str(name)).ToLocalChecked()));
+  DisallowGarbageCollection no_gc;
+  Tagged<BytecodeArray> bytecode =
+      function->shared()->GetBytecodeArray(
+          reinterpret_cast<Isolate*>(context->GetIsolate()));
+  Tagged<TrustedFixedArray> constants = bytecode->constant_pool();
+  for (int i = 0; i < constants->length(); i++) {
+    Tagged<Object> constant = constants->get(i);
+    if (IsObjectBoilerplateDescription(constant)) {
+      return Cast<ObjectBoilerplateDescription>(constant)->pretenure_hint();
+    }
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+TEST(CodeSerializerPretenuringFeedback) {
+  if (!v8_flags.allocation_site_pretenuring || v8_flags.single_generation) {
+    return;
+  }
+  v8_flags.code_cache_pretenuring_feedback = true;
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.lazy_feedback_allocation = false;
+  // The second call of each function creates its literal site.
+  const char* js_source =
+      "function f() { return {a: 1}; };"
+      "function g() { return {b: 2}; };"
+      "f(); f(); g(); g();"
+      "if (globalThis.pretenure) %PretenureAllocationSite(f());";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+    context->Global()
+        ->Set(context, v8_str("pretenure"), v8::True(isolate1))
+        .FromJust();
+
+    v8::ScriptCompiler::Source source(v8_str(js_source),
+                                      v8::ScriptOrigin(v8_str("test")));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    // Process the manual pretenuring request.
+    heap::InvokeMajorGC(reinterpret_cast<Isolate*>(isolate1)->heap());
+    CHECK(LiteralSiteIsTenured(context, "f"));
+    CHECK(!LiteralSiteIsTenured(context, "g"));
+
+    cache = ScriptCompiler::CreateCodeCache(script);
+
+    // Producing the cache keeps the sites of the live script and doesn't hint
+    // its literals, so pretenuring in this isolate is unchanged.
+    Tagged<Script> live_script =
+        Cast<Script>(v8::Utils::OpenDirectHandle(*script)->script());
+    CHECK(IsWeakArrayList(live_script->literal_sites()));
+    CHECK(!LiteralHasPretenureHint(context, "f"));
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(js_source),
+                                      v8::ScriptOrigin(v8_str("test")), cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    // Only the site that was tenured in the first isolate starts out tenured.
+    CHECK(LiteralSiteIsTenured(context, "f"));
+    CHECK(!LiteralSiteIsTenured(context, "g"));
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -5874,6 +6106,53 @@ TEST(WeakArraySerializationInCodeCache) {
   delete cache;
 }
 
+TEST(CodeCacheKeepsPreparseData) {
+  DisableAlwaysOpt();
+  if (!v8_flags.lazy) return;
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()->DisableScriptAndEval();
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  // {outer} is never compiled, but lazily compiling it later can skip {inner}
+  // using the data collected when {outer} was preparsed.
+  const char* source =
+      "function outer() {\n"
+      "  var x = 1;\n"
+      "  function inner() { return x; }\n"
+      "  return inner;\n"
+      "}";
+
+  Handle<String> src = isolate->factory()
+                           ->NewStringFromUtf8(base::CStrVector(source))
+                           .ToHandleChecked();
+  AlignedCachedData* cache = nullptr;
+
+  ScriptDetails script_details(src);
+  CompileScriptAndProduceCache(isolate, src, script_details, &cache,
+                               v8::ScriptCompiler::kNoCompileOptions);
+
+  DisallowCompilation no_compile_expected(isolate);
+  DirectHandle<SharedFunctionInfo> copy =
+      CompileScript(isolate, src, script_details, cache,
+                    v8::ScriptCompiler::kConsumeCodeCache);
+
+  DisallowGarbageCollection no_gc;
+  bool found_outer = false;
+  SharedFunctionInfo::ScriptIterator iter(isolate,
+                                          Cast<Script>(copy->script()));
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (info->is_toplevel()) continue;
+    CHECK(info->HasUncompiledDataWithPreparseData());
+    found_outer = true;
+  }
+  CHECK(found_outer);
+
+  delete cache;
+}
+
 v8::MaybeLocal<v8::Promise> TestHostDefinedOptionFromCachedScript(
     Local<v8::Context> context, Local<v8::Data> host_defined_options,
     Local<v8::Value> resource_name, Local<v8::String> specifier,
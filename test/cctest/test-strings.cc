@@ -32,6 +32,8 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
+
 #include "include/v8-json.h"
 #include "include/v8-template.h"
 #include "src/api/api-inl.h"
@@ -41,6 +43,7 @@
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/strings/string-hasher-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -1893,6 +1896,91 @@ TEST(HashArrayIndexStrings) {
   }
 }
 
+TEST(HashSequentialStringIsRepresentationIndependent) {
+  // One-byte and two-byte strings with the same contents must hash the same
+  // for every length, including the partial trailing block.
+  const uint64_t seed = 0x0123456789abcdefull;
+  uint8_t one_byte[40];
+  uint16_t two_byte[40];
+  for (int i = 0; i < 40; i++) {
+    one_byte[i] = static_cast<uint8_t>('a' + (i * 7) % 26);
+    two_byte[i] = one_byte[i];
+  }
+  for (int length = 0; length <= 40; length++) {
+    CHECK_EQ(StringHasher::HashSequentialString(one_byte, length, seed),
+             StringHasher::HashSequentialString(two_byte, length, seed));
+  }
+
+  // Trailing zero code units still change the hash.
+  uint8_t zeros[8] = {'a', 0, 0, 0, 0, 0, 0, 0};
+  for (int length = 1; length < 8; length++) {
+    CHECK_NE(StringHasher::HashSequentialString(zeros, length, seed),
+             StringHasher::HashSequentialString(zeros, length + 1, seed));
+  }
+
+  // The upper half of the seed is mixed in as well.
+  CHECK_NE(StringHasher::HashSequentialString(one_byte, 40, seed),
+           StringHasher::HashSequentialString(one_byte, 40,
+                                              seed ^ (uint64_t{1} << 63)));
+}
+
+TEST(HashDigitPrefixedNonIndexStrings) {
+  // Strings that start with digits but are not integer indices use the same
+  // block hash as other strings, which mixes in the upper half of the seed.
+  const uint64_t seed = 0x0123456789abcdefull;
+  const char* strings[] = {"1a", "12345678x", "9007199254740993",
+                           "123456789012345678901234567890"};
+  for (const char* string : strings) {
+    const uint8_t* chars = reinterpret_cast<const uint8_t*>(string);
+    int length = static_cast<int>(strlen(string));
+    uint32_t hash = StringHasher::HashSequentialString(chars, length, seed);
+    CHECK(String::IsHashFieldComputed(hash));
+    CHECK_EQ(String::HashFieldType::kHash,
+             String::HashFieldTypeBits::decode(hash));
+    CHECK_NE(hash, StringHasher::HashSequentialString(
+                       chars, length, seed ^ (uint64_t{1} << 63)));
+  }
+}
+
+TEST(HashBlockEqualToSecretIsNotDropped) {
+  // A block equal to one of the public hash constants must still contribute
+  // to the hash, so moving it around or removing it changes the hash for
+  // every seed.
+  const uint64_t secrets[] = {detail::kHashSecret0, detail::kHashSecret1,
+                              detail::kHashSecret2};
+  const uint64_t seeds[] = {0, 1, 0x0123456789abcdefull};
+  const uint16_t filler[4] = {'a', 'b', 'c', 'd'};
+  for (uint64_t secret : secrets) {
+    uint16_t block[4];
+    for (int i = 0; i < 4; i++) {
+      block[i] = static_cast<uint16_t>(secret >> (16 * i));
+    }
+    // The secret block at each of three positions, with {filler} elsewhere.
+    uint16_t strings[3][12];
+    for (int position = 0; position < 3; position++) {
+      for (int j = 0; j < 3; j++) {
+        const uint16_t* source = j == position ? block : filler;
+        std::copy(source, source + 4, &strings[position][4 * j]);
+      }
+    }
+    uint16_t without_block[8];
+    std::copy(filler, filler + 4, without_block);
+    std::copy(filler, filler + 4, without_block + 4);
+    for (uint64_t seed : seeds) {
+      uint32_t hashes[] = {
+          StringHasher::HashSequentialString(strings[0], 12, seed),
+          StringHasher::HashSequentialString(strings[1], 12, seed),
+          StringHasher::HashSequentialString(strings[2], 12, seed),
+          StringHasher::HashSequentialString(without_block, 8, seed)};
+      for (size_t a = 0; a < arraysize(hashes); a++) {
+        for (size_t b = a + 1; b < arraysize(hashes); b++) {
+          CHECK_NE(hashes[a], hashes[b]);
+        }
+      }
+    }
+  }
+}
+
 TEST(StringEquals) {
   v8::Isolate* isolate = CcTest::isolate();
   v8::HandleScope scope(isolate);
@@ -0,0 +1,51 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Checks that a session using only the profiler domains does not ' +
+    'discard optimized code.');
+
+contextGroup.addScript(`
+function f(a, b) {
+  return a + b;
+}
+%PrepareFunctionForOptimization(f);
+f(1, 2);
+f(3, 4);
+%OptimizeFunctionOnNextCall(f);
+f(5, 6);
+
+function optimizationStatus() {
+  return %GetOptimizationStatus(f);
+}
+`);
+
+async function optimizationStatus() {
+  const {result} =
+      await Protocol.Runtime.evaluate({expression: 'optimizationStatus()'});
+  return result.result.value;
+}
+
+(async function test() {
+  const before = await optimizationStatus();
+
+  await Protocol.Profiler.enable();
+  await Protocol.Profiler.start();
+  await Protocol.Runtime.evaluate({expression: 'f(7, 8)'});
+  await Protocol.Profiler.stop();
+  await Protocol.Profiler.disable();
+
+  await Protocol.HeapProfiler.enable();
+  await Protocol.HeapProfiler.startSampling();
+  await Protocol.Runtime.evaluate({expression: 'f(9, 10)'});
+  await Protocol.HeapProfiler.stopSampling();
+  await Protocol.HeapProfiler.disable();
+
+  InspectorTest.log(
+      'Optimization status unchanged: ' +
+      (before === await optimizationStatus()));
+  InspectorTest.completeTest();
+})();
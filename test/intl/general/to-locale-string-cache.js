@@ -0,0 +1,30 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString keeps a small per-isolate cache of ICU objects for each
+// locale. Alternating between more locales than it holds must keep
+// producing the right results for each of them.
+
+const locales = ['en-US', 'de-DE', 'fr-FR', 'ja-JP', 'ar-EG', 'hi-IN'];
+const date = new Date(Date.UTC(2024, 0, 15, 10, 20, 30));
+const expected = locales.map(locale => ({
+  number: new Intl.NumberFormat(locale).format(1234567.891),
+  date: new Intl.DateTimeFormat(locale).format(date),
+  time: new Intl.DateTimeFormat(
+      locale, {hour: 'numeric', minute: 'numeric', second: 'numeric'})
+      .format(date),
+  compare: new Intl.Collator(locale).compare('a', 'B'),
+}));
+
+for (let round = 0; round < 3; round++) {
+  for (let count = 1; count <= locales.length; count++) {
+    for (let i = 0; i < count; i++) {
+      const locale = locales[i];
+      assertEquals(expected[i].number, (1234567.891).toLocaleString(locale));
+      assertEquals(expected[i].date, date.toLocaleDateString(locale));
+      assertEquals(expected[i].time, date.toLocaleTimeString(locale));
+      assertEquals(expected[i].compare, 'a'.localeCompare('B', locale));
+    }
+  }
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+// Many independent async chains in flight at once, as in a server handling
+// concurrent requests. Each checkpoint drains a long queue of interleaved
+// PromiseReactionJobTasks rather than a single chain.
+new BenchmarkSuite('NativeThroughput', [1000], [
+  new Benchmark('Throughput', false, false, 0, Throughput, ThroughputSetup),
+]);
+
+var kConcurrentChains = 1000;
+var kAwaitsPerChain = 10;
+var leaf, handler;
+
+function ThroughputSetup() {
+  leaf = async function leaf(value) { return value; };
+  handler = async function handler(value) {
+    for (var n = 0; n < kAwaitsPerChain; n++) {
+      value = await leaf(value + 1);
+    }
+    return value;
+  };
+  %PerformMicrotaskCheckpoint();
+}
+
+function Throughput() {
+  for (var n = 0; n < kConcurrentChains; n++) handler(n);
+  %PerformMicrotaskCheckpoint();
+}
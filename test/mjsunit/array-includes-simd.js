@@ -97,6 +97,24 @@
   }
 })();
 
+// Large array of holey Doubles, and undefined search_element
+(() => {
+  let a = [];
+  for (let i = 0; i < 200; i++) {
+    a[i] = i + 0.5;
+  }
+  delete a[150];
+  a[199] = NaN;
+  function testArrayIncludes(from_index) {
+    return a.includes(undefined, from_index);
+  }
+  for (let from_index = 0; from_index < 200; from_index++) {
+    assertEquals(from_index <= 150, testArrayIncludes(from_index));
+  }
+  assertEquals(-1, a.indexOf(undefined));
+  assertEquals(true, a.includes(NaN));
+})();
+
 // Large array of packed objects, and object search_element
 (() => {
   let a = [];
@@ -769,3 +769,33 @@ TestSortCmpPackedSetLengthToZero();
   const v3 = Array.prototype.sort.call(42);
   assertEquals('object', typeof v3);
 })();
+
+(function TestDefaultSortOfSmis() {
+  function compareAsStrings(a, b) {
+    a = String(a);
+    b = String(b);
+    return a < b ? -1 : a > b ? 1 : 0;
+  }
+  for (const length of [31, 32, 100, 1000]) {
+    const xs = [];
+    for (let i = 0; i < length; i++) {
+      xs.push(((i * 7919) % 2003) - 1000);
+    }
+    const expected = xs.slice().sort(compareAsStrings);
+    assertEquals(expected, xs.slice().sort());
+    assertEquals(expected, xs.toSorted());
+    // Holes and undefined still go last.
+    const holey = xs.slice();
+    holey.push(undefined);
+    holey[length + 5] = -1;
+    holey.sort();
+    assertEquals(expected.concat([-1]).sort(compareAsStrings),
+                 holey.slice(0, length + 1));
+    assertEquals(undefined, holey[length + 1]);
+    assertFalse((length + 2) in holey);
+  }
+  // Mixed Smis and other values fall back to the generic path.
+  const mixed = [];
+  for (let i = 0; i < 64; i++) mixed.push(i % 2 ? i : 'x' + i);
+  assertEquals(mixed.slice().sort(compareAsStrings), mixed.sort());
+})();
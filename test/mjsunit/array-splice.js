@@ -463,3 +463,30 @@
   // force splice to copy the input array.
   foo(true);
 })();
+
+// Splicing at the front of a large array may move the start of the backing
+// store instead of the elements.
+(function() {
+  function check(make) {
+    let a = make();
+    let removed = a.splice(0, 3);
+    assertEquals([make()[0], make()[1], make()[2]], removed);
+    assertEquals(197, a.length);
+    assertEquals(make()[3], a[0]);
+    assertEquals(make()[199], a[196]);
+    assertFalse(a.hasOwnProperty(197));
+
+    a = make();
+    removed = a.splice(0, 3, 'x');
+    assertEquals(3, removed.length);
+    assertEquals(198, a.length);
+    assertEquals('x', a[0]);
+    assertEquals(make()[3], a[1]);
+    assertEquals(make()[199], a[197]);
+    a.push(1);
+    assertEquals(1, a[198]);
+  }
+  check(() => Array.from({length: 200}, (_, i) => i));
+  check(() => Array.from({length: 200}, (_, i) => i + 0.5));
+  check(() => Array.from({length: 200}, (_, i) => ({i})));
+})();
@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// ArrayBuffer.prototype.slice with the intrinsic constructor skips zeroing
+// the new buffer; check that every byte is still written.
+
+(function TestSliceCopiesAllBytes() {
+  const kSizes = [0, 1, 7, 64, 4095, 70000];
+  for (const size of kSizes) {
+    const buffer = new ArrayBuffer(size);
+    const bytes = new Uint8Array(buffer);
+    for (let i = 0; i < size; i++) bytes[i] = (i * 31 + 7) & 0xFF;
+    for (const [start, end] of [[0, size], [1, size - 1], [size >> 1, size],
+                                [-3, undefined], [5, 2]]) {
+      const slice = new Uint8Array(buffer.slice(start, end));
+      const expected = bytes.slice(start, end);
+      assertEquals(expected.length, slice.length);
+      for (let i = 0; i < slice.length; i++) {
+        assertEquals(expected[i], slice[i]);
+      }
+    }
+  }
+})();
+
+(function TestSliceDetachedDuringArgumentConversion() {
+  const buffer = new ArrayBuffer(1024);
+  const evil = { valueOf() { buffer.transfer(); return 0; } };
+  assertThrows(() => buffer.slice(evil), TypeError);
+})();
+
+(function TestSliceWithSpeciesConstructor() {
+  class MyArrayBuffer extends ArrayBuffer {}
+  const buffer = new MyArrayBuffer(16);
+  new Uint8Array(buffer).fill(42);
+  const slice = buffer.slice(4);
+  assertInstanceof(slice, MyArrayBuffer);
+  assertEquals(new Array(12).fill(42), Array.from(new Uint8Array(slice)));
+})();
@@ -0,0 +1,24 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --allow-natives-syntax
+// Flags: --concurrent-sparkplug --concurrent-sparkplug-off-thread-install
+// Flags: --baseline-batch-compilation --baseline-batch-compilation-threshold=0
+// Flags: --invocation-count-for-feedback-allocation=1 --no-turbofan
+// Flags: --no-maglev
+
+// Functions keep working while their baseline code is installed from the
+// background thread, whenever that happens.
+function MakeFunction(i) {
+  return new Function('a', 'b', `return (a + b + ${i}) * 2;`);
+}
+
+let functions = [];
+for (let i = 0; i < 20; ++i) functions.push(MakeFunction(i));
+
+for (let iteration = 0; iteration < 200; ++iteration) {
+  for (let i = 0; i < functions.length; ++i) {
+    assertEquals((iteration + 1 + i) * 2, functions[i](iteration, 1));
+  }
+}
@@ -0,0 +1,70 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-lazy-feedback-allocation
+
+function clone(x) { return {...x}; }
+function cloneNullProto(x) { return {__proto__: null, ...x}; }
+
+// Warm up a separate site so that the source maps get a cached clone target.
+function warm(x) { return {...x}; }
+
+const sources = [
+  {a: 1},
+  {a: 1, b: 2},
+  {a: 1, b: 2, c: 3},
+  {b: 'x', a: 1.5},
+  {c: {}, d: null},
+  {e: 1, f: 2, g: 3, h: 4},
+  {i: undefined},
+];
+for (const s of sources) {
+  warm(s);
+  warm(s);
+}
+
+// Make the clone site megamorphic.
+for (let i = 0; i < 3; i++) {
+  for (const s of sources) {
+    const c = clone(s);
+    assertEquals(s, c);
+    assertNotSame(s, c);
+    assertEquals(Object.prototype, Object.getPrototypeOf(c));
+  }
+}
+
+// The megamorphic site must agree with the monomorphic one.
+for (const s of sources) {
+  assertTrue(%HaveSameMap(warm(s), clone(s)));
+}
+
+// Mutating a clone must not affect the source.
+const src = {a: 1, b: 2};
+warm(src);
+const copy = clone(src);
+copy.a = 42;
+assertEquals(1, src.a);
+assertEquals(42, copy.a);
+
+// Null-prototype literals do not use the cached targets.
+for (const s of sources) {
+  const c = cloneNullProto(s);
+  assertEquals(null, Object.getPrototypeOf(c));
+  assertEquals(Object.keys(s), Object.keys(c));
+}
+
+// Getters are run rather than copied.
+let calls = 0;
+const with_getter = {get g() { calls++; return 7; }};
+assertEquals({g: 7}, clone(with_getter));
+assertEquals(1, calls);
+
+// Field generalization of a source map is handled.
+const gen = {a: 1, b: 2};
+warm(gen);
+clone(gen);
+const gen2 = {a: 1, b: 2};
+gen2.a = 'str';
+assertEquals({a: 'str', b: 2}, clone(gen2));
+assertEquals({a: 1, b: 2}, clone(gen));
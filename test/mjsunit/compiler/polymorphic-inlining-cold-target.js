@@ -0,0 +1,83 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --polymorphic-inlining
+// Flags: --no-always-turbofan
+// Flags: --min-polymorphic-inlining-target-share=0.1
+
+function hot(x) { return x + 1; }
+function cold(x) { return x - 1; }
+
+function dispatch(use_cold, x) {
+  const target = use_cold ? cold : hot;
+  return target(x);
+}
+
+%PrepareFunctionForOptimization(hot);
+%PrepareFunctionForOptimization(cold);
+%PrepareFunctionForOptimization(dispatch);
+for (let i = 0; i < 100; i++) {
+  assertEquals(i + 1, dispatch(false, i));
+}
+assertEquals(0, dispatch(true, 1));
+
+%OptimizeFunctionOnNextCall(dispatch);
+assertEquals(2, dispatch(false, 1));
+assertOptimized(dispatch);
+
+// The cold target is still called directly rather than deoptimizing.
+assertEquals(0, dispatch(true, 1));
+assertOptimized(dispatch);
+
+// Both targets only have Smi feedback for their argument. The cold target was
+// not inlined, so a double only reaches its own unoptimized code and dispatch
+// stays optimized.
+assertEquals(0.5, dispatch(true, 1.5));
+assertOptimized(dispatch);
+assertUnoptimized(cold);
+
+// The hot target was inlined, so a double deoptimizes dispatch.
+assertEquals(2.5, dispatch(false, 1.5));
+assertUnoptimized(dispatch);
+
+// A target that was never called, and so has no feedback vector, does not
+// hide the invocation counts of the others.
+function first(x) { return x * 2; }
+function second(x) { return x * 3; }
+function never(x) { return x * 4; }
+
+function dispatch3(which, x) {
+  // All three targets meet in a single phi.
+  let target;
+  switch (which) {
+    case 0:
+      target = first;
+      break;
+    case 1:
+      target = second;
+      break;
+    default:
+      target = never;
+  }
+  return target(x);
+}
+
+%PrepareFunctionForOptimization(first);
+%PrepareFunctionForOptimization(second);
+%PrepareFunctionForOptimization(dispatch3);
+for (let i = 0; i < 100; i++) {
+  assertEquals(2 * i, dispatch3(0, i));
+  assertEquals(3 * i, dispatch3(1, i));
+}
+
+%OptimizeFunctionOnNextCall(dispatch3);
+assertEquals(2, dispatch3(0, 1));
+assertEquals(3, dispatch3(1, 1));
+assertOptimized(dispatch3);
+assertEquals(4, dispatch3(2, 1));
+assertOptimized(dispatch3);
+
+// The frequent targets were still inlined, so a double deoptimizes dispatch3.
+assertEquals(3, dispatch3(0, 1.5));
+assertUnoptimized(dispatch3);
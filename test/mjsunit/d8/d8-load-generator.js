@@ -0,0 +1,13 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --load-isolates=2 --load-duration=50
+
+// Every run gets a fresh context, so state doesn't leak between runs.
+assertEquals(undefined, globalThis.ran);
+globalThis.ran = true;
+
+let sum = 0;
+for (let i = 0; i < 1000; i++) sum += i;
+assertEquals(499500, sum);
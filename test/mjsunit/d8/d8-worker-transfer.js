@@ -0,0 +1,34 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// ArrayBuffers in the transfer list move between the worker and the parent
+// without being copied, in both directions.
+(function TestTransferFromWorker() {
+  const worker = new Worker(
+      `onmessage = function({data: buffer}) {
+         new Uint8Array(buffer)[1] = 43;
+         postMessage(buffer, [buffer]);
+         postMessage(buffer.byteLength);
+       };`,
+      {type: 'string'});
+  const buffer = new ArrayBuffer(16);
+  new Uint8Array(buffer)[0] = 42;
+  worker.postMessage(buffer, [buffer]);
+  assertEquals(0, buffer.byteLength);
+
+  const result = worker.getMessage();
+  assertEquals(16, result.byteLength);
+  assertEquals(42, new Uint8Array(result)[0]);
+  assertEquals(43, new Uint8Array(result)[1]);
+  // The worker's copy was detached.
+  assertEquals(0, worker.getMessage());
+  worker.terminate();
+})();
+
+(function TestManyMessages() {
+  const worker = new Worker(
+      `for (let i = 0; i < 1000; i++) postMessage(i);`, {type: 'string'});
+  for (let i = 0; i < 1000; i++) assertEquals(i, worker.getMessage());
+  worker.terminate();
+})();
@@ -329,3 +329,22 @@ var testCasesNegative = [
 testCasesNegative.forEach(function (s) {
     assertTrue(isNaN(Date.parse(s)), s + " is not NaN.");
 });
+
+// The canonical toISOString format, with and without milliseconds.
+assertEquals(Date.UTC(2024, 0, 15, 10, 20, 30, 456),
+             Date.parse('2024-01-15T10:20:30.456Z'));
+assertEquals(Date.UTC(2024, 0, 15, 10, 20, 30),
+             Date.parse('2024-01-15T10:20:30Z'));
+assertEquals(-62167219200000, Date.parse('0000-01-01T00:00:00.000Z'));
+assertEquals(Date.UTC(2024, 1, 30), Date.parse('2024-02-30T00:00:00.000Z'));
+assertEquals(Date.UTC(2024, 0, 16), Date.parse('2024-01-15T24:00:00.000Z'));
+assertTrue(isNaN(Date.parse('2024-01-15T24:00:01.000Z')));
+assertTrue(isNaN(Date.parse('2024-13-15T10:20:30.456Z')));
+assertTrue(isNaN(Date.parse('2024-01-32T10:20:30.456Z')));
+assertTrue(isNaN(Date.parse('2024-01-15T10:60:30.456Z')));
+assertTrue(isNaN(Date.parse('2024-01-15T10:20:60.456Z')));
+assertTrue(isNaN(Date.parse('2024-01-15T10:20:30,456Z')));
+for (var i = 0; i < 100; i++) {
+  var date = new Date(i * 1234567890123);
+  assertEquals(date.getTime(), Date.parse(date.toISOString()));
+}
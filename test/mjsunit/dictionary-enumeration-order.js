@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Keys of dictionary mode objects are enumerated in insertion order, both
+// when the enumeration indices are dense and after deletions left gaps.
+
+function MakeDictionary(n) {
+  let o = {};
+  let expected = [];
+  for (let i = 0; i < n; i++) {
+    let key = 'k' + ((i * 7919) % n);
+    o[key] = i;
+    expected.push(key);
+  }
+  delete o[expected[0]];
+  expected.shift();
+  assertFalse(%HasFastProperties(o));
+  return {o, expected};
+}
+
+function CheckOrder(o, expected) {
+  assertEquals(expected, Object.keys(o));
+  let keys = [];
+  for (let key in o) keys.push(key);
+  assertEquals(expected, keys);
+  assertEquals(expected, Object.getOwnPropertyNames(o));
+}
+
+for (let n of [5, 20, 100, 1000]) {
+  let {o, expected} = MakeDictionary(n);
+  CheckOrder(o, expected);
+
+  // Re-adding a deleted key moves it to the end.
+  let key = expected[1];
+  delete o[key];
+  o[key] = -1;
+  expected.splice(1, 1);
+  expected.push(key);
+  CheckOrder(o, expected);
+
+  // Sparse enumeration indices after deleting most of the keys.
+  let kept = expected.filter((k, i) => i % 10 == 0);
+  for (let k of expected) {
+    if (!kept.includes(k)) delete o[k];
+  }
+  CheckOrder(o, kept);
+
+  // Non-enumerable keys are skipped by Object.keys and for-in only.
+  Object.defineProperty(o, 'hidden', {value: 1, enumerable: false});
+  assertEquals(kept, Object.keys(o));
+  assertEquals([...kept, 'hidden'], Object.getOwnPropertyNames(o));
+}
@@ -220,3 +220,56 @@
     assertEquals(42, p[index]);
   }
 })();
+
+(function testIndexedTrapResultOnFastElements() {
+  // Elements of fast arrays and objects are configurable, so the trap may
+  // return anything for them.
+  var handler = {
+    get(target, name) {
+      return name === "length" ? target.length : 42;
+    }
+  };
+  var array_proxy = new Proxy([1, 2.5, {}], handler);
+  var object_proxy = new Proxy({0: 1, 1: "x"}, handler);
+  for (var i = 0; i < 3; ++i) {
+    assertEquals(42, array_proxy[0]);
+    assertEquals(42, array_proxy[2]);
+    assertEquals(42, array_proxy[7]);
+    assertEquals(42, object_proxy[1]);
+  }
+
+  // Sealed, frozen and dictionary elements still get the full check.
+  var frozen = Object.freeze([1, 2]);
+  assertThrows(() => new Proxy(frozen, handler)[0], TypeError);
+  var dictionary = [];
+  Object.defineProperty(dictionary, 0, {value: 1});
+  assertThrows(() => new Proxy(dictionary, handler)[0], TypeError);
+  var typed_array = new Uint8Array(4);
+  assertEquals(42, new Proxy(typed_array, handler)[0]);
+})();
+
+(function testTrapResultWithNonInternalizedKeys() {
+  // Keys built at runtime reach the trap result check without being
+  // internalized, so their hash may not have been computed yet.
+  var handler = {
+    get(target, name) {
+      return 42;
+    }
+  };
+  var array_proxy = new Proxy([1, 2, 3], handler);
+  var frozen_target = [];
+  for (var i = 0; i < 20; ++i) frozen_target.push(i);
+  var frozen_proxy = new Proxy(Object.freeze(frozen_target), handler);
+  for (var i = 0; i < 3; ++i) {
+    var name_key = "a" + i;
+    var index_key = String(i) + "";
+    var long_index_key = "1" + String(i);
+    assertEquals(42, Reflect.get(array_proxy, name_key));
+    assertEquals(42, Reflect.get(array_proxy, index_key));
+    assertEquals(42, Reflect.get(array_proxy, long_index_key));
+    assertEquals(42, Reflect.get(array_proxy, name_key, {}));
+    assertThrows(() => Reflect.get(frozen_proxy, index_key), TypeError);
+    assertThrows(() => Reflect.get(frozen_proxy, long_index_key), TypeError);
+    assertEquals(42, Reflect.get(frozen_proxy, name_key));
+  }
+})();
@@ -149,3 +149,15 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// One-byte element kinds are sorted by counting above a minimum length.
+for (let ctor of [Int8Array, Uint8Array, Uint8ClampedArray]) {
+  for (let length of [63, 64, 1000]) {
+    let values = [];
+    for (let i = 0; i < length; i++) values.push((i * 89 + 13) % 256 - 128);
+    let array = new ctor(values);
+    let expected = Array.from(array).sort(cmpfn);
+    assertEquals(array.sort(), array);
+    assertArrayLikeEquals(array, expected, ctor);
+  }
+}
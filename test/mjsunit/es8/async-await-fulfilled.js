@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting values and already fulfilled promises resumes without a reject
+// closure. Check that ordering and error handling are unaffected.
+
+const log = [];
+
+async function awaitValue() {
+  log.push('value:start');
+  const v = await 1;
+  log.push('value:' + v);
+}
+
+async function awaitFulfilled() {
+  log.push('fulfilled:start');
+  const v = await Promise.resolve(2);
+  log.push('fulfilled:' + v);
+}
+
+async function awaitPending() {
+  log.push('pending:start');
+  let resolve;
+  const p = new Promise(r => resolve = r);
+  Promise.resolve().then(() => resolve(3));
+  const v = await p;
+  log.push('pending:' + v);
+}
+
+async function awaitRejected() {
+  log.push('rejected:start');
+  try {
+    await Promise.reject(4);
+  } catch (e) {
+    log.push('rejected:' + e);
+  }
+}
+
+async function* generator() {
+  const v = await Promise.resolve(5);
+  yield v;
+  return await 6;
+}
+
+awaitValue();
+awaitFulfilled();
+awaitPending();
+awaitRejected();
+const it = generator();
+it.next().then(r => log.push('generator:' + r.value));
+it.return(7).then(r => log.push('return:' + r.value));
+%PerformMicrotaskCheckpoint();
+
+assertEquals([
+  'value:start', 'fulfilled:start', 'pending:start', 'rejected:start',
+  'value:1', 'fulfilled:2', 'rejected:4', 'pending:3', 'generator:5',
+  'return:7'
+], log);
@@ -318,3 +318,19 @@
     new Set().intersection(setLike);
   }, RangeError, '\'-Infinity\' is an invalid size');
 })();
+
+(function TestIntersectionLargeSetsWithSmallResult() {
+  const firstSet = new Set();
+  for (let i = 0; i < 2000; i++) firstSet.add(i);
+
+  const otherSet = new Set();
+  for (let i = 1990; i < 4000; i++) otherSet.add(i);
+
+  const intersection = firstSet.intersection(otherSet);
+  assertEquals(
+      [1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999],
+      Array.from(intersection));
+
+  for (let i = 0; i < 1000; i++) intersection.add(-i - 1);
+  assertEquals(1010, intersection.size);
+})();
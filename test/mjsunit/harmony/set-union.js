@@ -251,3 +251,38 @@
 
   assertEquals(resultArray, unionArray);
 })();
+
+(function TestUnionLargeSetsKeepInsertionOrder() {
+  const firstSet = new Set();
+  for (let i = 0; i < 1000; i++) firstSet.add(i);
+  for (let i = 0; i < 1000; i += 3) firstSet.delete(i);
+
+  const otherSet = new Set();
+  for (let i = 2000; i > 500; i--) otherSet.add(i);
+
+  const resultArray = [...firstSet];
+  for (const value of otherSet) {
+    if (!firstSet.has(value)) resultArray.push(value);
+  }
+
+  const union = firstSet.union(otherSet);
+  assertEquals(resultArray, Array.from(union));
+  assertEquals(resultArray.length, union.size);
+
+  union.add(-1);
+  assertTrue(union.has(-1));
+  assertFalse(firstSet.has(-1));
+})();
+
+(function TestUnionLargeSetWithMap() {
+  const firstSet = new Set();
+  for (let i = 0; i < 100; i++) firstSet.add(i);
+
+  const otherMap = new Map();
+  for (let i = 50; i < 2000; i++) otherMap.set(i, 'value');
+
+  const resultArray = [];
+  for (let i = 0; i < 2000; i++) resultArray.push(i);
+
+  assertEquals(resultArray, Array.from(firstSet.union(otherMap)));
+})();
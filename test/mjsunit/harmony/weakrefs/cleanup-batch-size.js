@@ -0,0 +1,37 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+// Flags: --finalization-registry-cleanup-batch-size=2
+
+(async function () {
+
+  let cleanup_holdings = [];
+  let cleanup = function (holdings) {
+    cleanup_holdings.push(holdings);
+  }
+
+  let fg = new FinalizationRegistry(cleanup);
+
+  // Register five objects, which need more than two cleanup tasks. The
+  // objects need to be inside a closure so that we can reliably kill them!
+  (function () {
+    for (let i = 0; i < 5; i++) {
+      fg.register({}, i);
+    }
+  })();
+
+  // Invoke GC asynchronously so that it doesn't need to scan the stack.
+  await gc({ type: 'major', execution: 'async' });
+  assertEquals(0, cleanup_holdings.length);
+
+  // Each cleanup task runs at most two callbacks and then re-posts itself.
+  await new Promise(resolve=>setTimeout(resolve, 0));
+  assertEquals(2, cleanup_holdings.length);
+
+  for (let i = 0; i < 3; i++) {
+    await new Promise(resolve=>setTimeout(resolve, 0));
+  }
+  assertEquals([0, 1, 2, 3, 4], cleanup_holdings.sort());
+})();
@@ -0,0 +1,20 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// One-byte strings are scanned in blocks; check terminators and escapes at
+// every offset around the block boundaries.
+for (let length = 0; length < 40; length++) {
+  const prefix = 'a'.repeat(length);
+  assertEquals(prefix, JSON.parse(`"${prefix}"`));
+  assertEquals(prefix + '"b', JSON.parse(`"${prefix}\\"b"`));
+  assertEquals(prefix + '\\b', JSON.parse(`"${prefix}\\\\b"`));
+  assertEquals(prefix + '\n', JSON.parse(`"${prefix}\\n"`));
+  assertEquals({[prefix]: prefix}, JSON.parse(`{"${prefix}":"${prefix}"}`));
+  assertThrows(() => JSON.parse(`"${prefix}\n"`), SyntaxError);
+  assertThrows(() => JSON.parse(`"${prefix}\x1f"`), SyntaxError);
+  assertThrows(() => JSON.parse(`"${prefix}`), SyntaxError);
+  // Characters above 0x7F are ordinary string characters.
+  assertEquals(prefix + '\xff\x80', JSON.parse(`"${prefix}\xff\x80"`));
+  assertEquals(prefix + '\x7f', JSON.parse(`"${prefix}\x7f"`));
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings are scanned for characters to escape in blocks; check every
+// character class at every offset around the block boundaries.
+const kSpecial = [
+  ['"', '\\"'], ['\\', '\\\\'], ['\n', '\\n'], ['\x01', '\\u0001'],
+  ['\x1f', '\\u001f'], ['\ud800', '\\ud800'], ['\udfff', '\\udfff'],
+  ['😀', '😀'], [' ', ' '], ['\x7f', '\x7f'],
+  ['\xff', '\xff'], ['€', '€'], ['￿', '￿'],
+];
+for (let length = 0; length < 40; length++) {
+  for (const filler of ['a', 'ā']) {
+    const prefix = filler.repeat(length);
+    for (const [c, escaped] of kSpecial) {
+      const suffix = filler.repeat(length % 7);
+      assertEquals(`"${prefix}${escaped}${suffix}"`,
+                   JSON.stringify(prefix + c + suffix));
+    }
+  }
+}
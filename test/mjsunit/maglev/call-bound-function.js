@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+function add(a, b, c) {
+  return this.base + a + b + c;
+}
+
+const holder = { callback: add.bind({ base: 100 }, 1) };
+
+function callCallback(x, y) {
+  return holder.callback(x, y);
+}
+
+%PrepareFunctionForOptimization(callCallback);
+assertEquals(106, callCallback(2, 3));
+assertEquals(107, callCallback(3, 3));
+%OptimizeMaglevOnNextCall(callCallback);
+assertEquals(106, callCallback(2, 3));
+assertTrue(isMaglevved(callCallback));
+
+// A different bound function with the same target fails the check.
+holder.callback = add.bind({ base: 200 }, 2);
+assertEquals(207, callCallback(2, 3));
+assertFalse(isMaglevved(callCallback));
+
+// Bound `this` of undefined is converted for sloppy targets.
+function sloppyThis() {
+  return this;
+}
+const boundSloppy = sloppyThis.bind(undefined);
+function callSloppy() {
+  return boundSloppy();
+}
+%PrepareFunctionForOptimization(callSloppy);
+assertSame(globalThis, callSloppy());
+%OptimizeMaglevOnNextCall(callSloppy);
+assertSame(globalThis, callSloppy());
+
+// Bound `this` of null is passed through unchanged to strict targets.
+function strictThis() {
+  'use strict';
+  return this;
+}
+const boundStrictNull = strictThis.bind(null);
+function callStrictNull() {
+  return boundStrictNull();
+}
+%PrepareFunctionForOptimization(callStrictNull);
+assertSame(null, callStrictNull());
+%OptimizeMaglevOnNextCall(callStrictNull);
+assertSame(null, callStrictNull());
+assertTrue(isMaglevved(callStrictNull));
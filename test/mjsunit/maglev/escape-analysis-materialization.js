@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-escape-analysis
+// Flags: --no-always-turbofan
+
+// Short-lived objects that don't escape are elided, and are materialized
+// from the deopt frame state if the function deopts while they are alive.
+
+function soft_deopt() {}
+
+// An object literal temporary.
+function point(b, x, y) {
+  let p = {x: x, y: y};
+  if (b) {
+    soft_deopt();
+    return p.x * 10 + p.y;
+  }
+  return p.x + p.y;
+}
+
+%PrepareFunctionForOptimization(point);
+assertEquals(3, point(false, 1, 2));
+%OptimizeMaglevOnNextCall(point);
+assertEquals(7, point(false, 3, 4));
+assertTrue(isMaglevved(point));
+assertEquals(56, point(true, 5, 6));
+assertUnoptimized(point);
+
+// Iterator result objects of an inlined array iterator.
+function sum(b, array) {
+  let result = 0;
+  for (let value of array) {
+    if (b) soft_deopt();
+    result += value;
+  }
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(6, sum(false, [1, 2, 3]));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(6, sum(false, [1, 2, 3]));
+assertTrue(isMaglevved(sum));
+assertEquals(15, sum(true, [4, 5, 6]));
+assertUnoptimized(sum);
+
+// A function context captured by a closure that is called directly.
+function counter(b) {
+  let count = 0;
+  let inc = function() { count++; };
+  inc();
+  if (b) {
+    soft_deopt();
+    inc();
+  }
+  return count;
+}
+
+%PrepareFunctionForOptimization(counter);
+assertEquals(1, counter(false));
+%OptimizeMaglevOnNextCall(counter);
+assertEquals(1, counter(false));
+assertTrue(isMaglevved(counter));
+assertEquals(2, counter(true));
+assertUnoptimized(counter);
@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-inlining
+// Flags: --no-always-turbofan
+
+// Immutable context slots of functions inlined at a known call target are
+// folded even when the caller isn't specialized to its function context.
+
+function makeScale() {
+  const config = {factor: 3};
+  return function scale(x) { return x * config.factor; };
+}
+const scale = makeScale();
+
+function makeCaller() {
+  return function caller(x) { return scale(x) + 1; };
+}
+// Two closures for the same function disable function context
+// specialization.
+const caller = makeCaller();
+makeCaller();
+
+%PrepareFunctionForOptimization(scale);
+%PrepareFunctionForOptimization(caller);
+assertEquals(7, caller(2));
+assertEquals(10, caller(3));
+%OptimizeMaglevOnNextCall(caller);
+assertEquals(13, caller(4));
+assertTrue(isMaglevved(caller));
+
+// A const that is read before it is initialized must not be folded.
+function makeEarly() {
+  let read = function() { return value; };
+  let result;
+  try { result = read(); } catch (e) { result = e instanceof ReferenceError; }
+  const value = 42;
+  return [read, result];
+}
+const [readValue, threw] = makeEarly();
+assertTrue(threw);
+
+function readCaller() { return readValue(); }
+%PrepareFunctionForOptimization(readValue);
+%PrepareFunctionForOptimization(readCaller);
+assertEquals(42, readCaller());
+%OptimizeMaglevOnNextCall(readCaller);
+assertEquals(42, readCaller());
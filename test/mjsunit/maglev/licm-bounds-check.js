@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-licm --no-always-turbofan
+
+// Only checks in the loop header are hoisted, so the bounds-checked load is
+// the loop condition. The index and the length are used as int32 values
+// before the loop, so the bounds check of a[k] only has inputs from outside
+// the loop and is hoisted to the loop entry.
+let body_runs = 0;
+function countBelow(a, k) {
+  if (k + a.length < 0) return -1;
+  let i = 0;
+  while (a[k] > i) {
+    body_runs++;
+    i++;
+  }
+  return i;
+}
+
+let a = [3, 5, 7];
+%PrepareFunctionForOptimization(countBelow);
+assertEquals(5, countBelow(a, 1));
+assertEquals(3, countBelow(a, 0));
+%OptimizeMaglevOnNextCall(countBelow);
+assertEquals(7, countBelow(a, 2));
+assertTrue(isMaglevved(countBelow));
+
+// The loop runs many times without deoptimizing on the hoisted check.
+assertEquals(5, countBelow(a, 1));
+assertTrue(isMaglevved(countBelow));
+
+// The hoisted check fails at the loop entry: the function deopts before the
+// loop body runs, and the interpreter resumes before the loop.
+body_runs = 0;
+assertEquals(0, countBelow(a, 10));
+assertEquals(0, body_runs);
+assertUnoptimized(countBelow);
+
+// After the deopt the check stays in the loop.
+%OptimizeMaglevOnNextCall(countBelow);
+assertEquals(3, countBelow(a, 0));
+assertTrue(isMaglevved(countBelow));
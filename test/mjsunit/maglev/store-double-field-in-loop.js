@@ -0,0 +1,45 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+function Particle(x) {
+  this.x = x;
+}
+
+function step(p, n) {
+  // The loop phi for {x} should be untagged to Float64 and every store should
+  // write into the field's mutable HeapNumber in place.
+  let x = p.x;
+  for (let i = 0; i < n; i++) {
+    x += 0.5;
+    p.x = x;
+  }
+  return x;
+}
+
+let p = new Particle(0.25);
+
+%PrepareFunctionForOptimization(step);
+assertEquals(2.25, step(p, 4));
+assertEquals(2.25, p.x);
+%OptimizeMaglevOnNextCall(step);
+assertEquals(4.25, step(p, 4));
+assertEquals(4.25, p.x);
+assertTrue(isMaglevved(step));
+
+// Values read from the field before the loop must not observe the in-place
+// stores of later iterations.
+let saved = p.x;
+assertEquals(9.25, step(p, 10));
+assertEquals(4.25, saved);
+assertEquals(9.25, p.x);
+
+// Each object owns its box, so stores to one object don't leak into another
+// object that was initialized from the same value.
+let q = new Particle(p.x);
+assertEquals(9.75, step(q, 1));
+assertEquals(9.25, p.x);
+assertEquals(9.75, q.x);
+assertTrue(isMaglevved(step));
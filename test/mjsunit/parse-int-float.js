@@ -68,6 +68,17 @@ assertEquals(Infinity, parseInt('0x10000000000000000000000000000000000000000000'
     + '000000000000000000000000000000000000000000000000000000000000000000000000'
     + '0000000000000'));
 
+// Decimal integers beyond 2^53 are correctly rounded (ties to even).
+assertEquals(9007199254740992, parseInt('9007199254740993'));
+assertEquals(9007199254740996, parseInt('9007199254740995'));
+assertEquals(9007199254740996, parseInt('9007199254740995xyz'));
+assertEquals(1e21, parseInt('1000000000000000000000.5'));
+assertEquals(Number.MAX_VALUE, parseInt(BigInt(Number.MAX_VALUE).toString()));
+assertEquals(Infinity, parseInt('9'.repeat(400)));
+assertEquals(5, parseInt('0'.repeat(400) + '5'));
+// Two-byte strings.
+assertEquals(9007199254740992, parseInt('9007199254740993\u1234'));
+
 
 var i;
 var y = 10;
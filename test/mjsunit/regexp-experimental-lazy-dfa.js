@@ -0,0 +1,52 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa --expose-gc
+// Flags: --experimental-regexp-engine-lazy-dfa-max-states=4
+
+function Test(regexp, subject, expectedResult) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+}
+
+// Matches and non-matches, including ones at the end of the input.
+Test(/asdf/, "123asdf1xyz", ["asdf"]);
+Test(/asdf/, "123asd", null);
+Test(/x*$/, "abc", [""]);
+Test(/(a|b)+c/, "ababababc", ["ababababc", "b"]);
+Test(/(a|b)+c/, "abababab", null);
+Test(/[^a]b/, "aaaaab", null);
+Test(/쁰d섊/, "123쁰d섊abc", ["쁰d섊"]);
+Test(/쁰d섊/, "123쁰d섊", ["쁰d섊"]);
+Test(/쁰d섊/, "123쁰d", null);
+
+// Assertions are assumed to hold by the DFA and checked by the NFA.
+Test(/^b/, "ab", null);
+Test(/a\b/, "aa a", ["a"]);
+Test(/a$/m, "ab\nb", null);
+
+// Global searches stop once no further match is possible.
+var global = /a(b)?/g;
+assertEquals(["ab", "a", "a"], "xabyaza".match(global));
+assertEquals(["ab"], "xabyyy".match(global));
+
+// Enough states to flush the cache repeatedly.
+var subject = "";
+for (var i = 0; i < 1000; i++) subject += "abcdefgh"[i % 8];
+Test(/(a|b|c|d|e|f|g|h)+z/, subject, null);
+Test(/(a|b|c|d|e|f|g|h)+z/, subject + "z", [subject + "z", "h"]);
+
+// The DFA of a regexp is kept across executions, and dropped by full GCs.
+var reused = /(a|b)+c/;
+for (var i = 0; i < 10; i++) {
+  Test(reused, "ababababc", ["ababababc", "b"]);
+  Test(reused, "abababab", null);
+  if (i % 3 == 0) gc();
+}
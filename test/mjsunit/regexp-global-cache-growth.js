@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-global-cache-max-registers=1024 --no-regexp-tier-up
+
+// Enough matches to fill several batches of growing size. The counts are
+// chosen so that some end exactly at a batch boundary.
+for (const count of [1, 63, 64, 65, 192, 193, 1000, 5000]) {
+  const subject = "ab".repeat(count);
+
+  assertEquals(count, subject.match(/a/g).length);
+  assertEquals(count, subject.match(/(a)(b)/g).length);
+  assertEquals("x".repeat(count), subject.replace(/ab/g, "x"));
+
+  let calls = 0;
+  assertEquals("b".repeat(count), subject.replace(/(a)/g, (m, a, offset) => {
+    assertEquals(2 * calls++, offset);
+    return "";
+  }));
+  assertEquals(count, calls);
+
+  // The last match info refers to the last successful match.
+  subject.replace(/a(b)/g, "");
+  assertEquals("ab", RegExp.lastMatch);
+  assertEquals("b", RegExp.$1);
+  assertEquals(subject.slice(0, -2), RegExp.leftContext);
+}
+
+// Zero-length matches fill batches quickly. Enough of them grow the register
+// array more than once, past the point where it is heap allocated.
+for (const count of [200, 1000, 5000]) {
+  const subject = "x".repeat(count);
+  assertEquals(count + 1, subject.match(/(?:)/g).length);
+  assertEquals(count + 1, subject.match(/()/g).length);
+  assertEquals("-x".repeat(count) + "-", subject.replace(/y*/g, "-"));
+  let calls = 0;
+  subject.replace(/(?:)/g, (m, offset) => {
+    assertEquals(calls++, offset);
+    return "";
+  });
+  assertEquals(count + 1, calls);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-interpret-all --regexp-process-wide-bytecode-cache
+// Flags: --no-compilation-cache
+
+// Without the isolate's compilation cache, every RegExp object is compiled
+// separately, so all but the first one per key reuse the cached bytecode.
+for (let i = 0; i < 3; i++) {
+  assertEquals(["abc", "b"], new RegExp("a(b)c").exec("xxabcxx"));
+  assertEquals(["ABC", "B"], new RegExp("a(b)c", "i").exec("xxABCxx"));
+  assertEquals(null, new RegExp("a(b)c").exec("xxABCxx"));
+  assertEquals(["a€c", "€"], new RegExp("a(€)c").exec("xxa€cxx"));
+  assertEquals(["ab", "ab"], "ab ab".match(new RegExp("ab", "g")));
+  assertEquals(["ab"], new RegExp("(?<x>ab)").exec("ab").slice(0, 1));
+  assertEquals("ab", new RegExp("(?<x>ab)").exec("ab").groups.x);
+}
@@ -0,0 +1,50 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-interpret-all
+
+// Patterns whose Boyer-Moore lookahead ends in a single character are
+// scanned with SKIP_UNTIL_CHAR in the interpreter.
+
+function test(re, subject, expected_index) {
+  re.lastIndex = 0;
+  const match = re.exec(subject);
+  if (expected_index < 0) {
+    assertNull(match);
+  } else {
+    assertNotNull(match);
+    assertEquals(expected_index, match.index);
+  }
+}
+
+const padding = 'abc '.repeat(1000);
+
+(function testOneByte() {
+  const re = /[a-z]{3}Q/;
+  test(re, padding + 'xyzQ', padding.length);
+  test(re, 'xyzQ' + padding, 0);
+  test(re, padding + 'xyz', -1);
+  test(re, padding + 'Q', -1);
+  test(re, padding + '123Q abcQ', padding.length + 5);
+  test(re, '', -1);
+})();
+
+(function testTwoByte() {
+  const re = /[a-z]{3}☃/;
+  const two_byte_padding = padding + '☂';
+  test(re, two_byte_padding + 'xyz☃', two_byte_padding.length);
+  test(re, two_byte_padding + 'xyz', -1);
+  test(re, two_byte_padding + '☃', -1);
+})();
+
+(function testOneByteSubjectTwoBytePattern() {
+  const re = /[a-z]{3}☃/;
+  test(re, padding, -1);
+})();
+
+(function testGlobal() {
+  const re = /[a-z]{3}Q/g;
+  const subject = (padding + 'xyzQ').repeat(3);
+  assertEquals(['xyzQ', 'xyzQ', 'xyzQ'], subject.match(re));
+})();
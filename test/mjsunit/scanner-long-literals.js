@@ -0,0 +1,23 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Identifiers and string literals longer than the scanner's literal buffer
+// and the character stream's buffer, with and without non-ASCII characters.
+for (let length of [1, 255, 256, 257, 1000, 5000, 70000]) {
+  let ascii = 'a'.repeat(length);
+  assertEquals(ascii, eval(`'${ascii}'`));
+  assertEquals(ascii, eval(`"${ascii}"`));
+  assertEquals(length, eval(`var ${ascii} = ${length}; ${ascii}`));
+
+  for (let c of ['é', '€', '😍']) {
+    let mixed = ascii + c + ascii + c;
+    assertEquals(mixed, eval(`'${mixed}'`));
+    assertEquals(ascii + '\n' + mixed, eval(`'${ascii}\\n${mixed}'`));
+  }
+  let name = ascii + 'é' + ascii;
+  assertEquals(length, eval(`var ${name} = ${length}; ${name}`));
+}
+
+assertThrows(() => eval(`'${'a'.repeat(1000)}\n'`), SyntaxError);
+assertThrows(() => eval(`'${'a'.repeat(1000)}`), SyntaxError);
@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --string-search-ropes
+
+// Builds a fresh (unflattened) rope out of the given segments.
+function Rope(segments) {
+  let result = segments[0];
+  for (let i = 1; i < segments.length; i++) result += segments[i];
+  return result;
+}
+
+function Check(segments, pattern, start) {
+  const expected = segments.join("").indexOf(pattern, start);
+  assertEquals(expected, Rope(segments).indexOf(pattern, start));
+  assertEquals(expected !== -1, Rope(segments).includes(pattern, start));
+}
+
+const a = "a".repeat(3000);
+const b = "b".repeat(3000);
+const u = "䄀".repeat(3000);
+
+for (const pattern of ["x", "ab", "ba", "aab", "abb", "a䄀", "䄀b",
+                       "aaaaaaaaaab", "abbbbbbbbbb", "xyz", "a".repeat(20)]) {
+  for (const start of [0, 1, 2999, 3000, 3001, 5999]) {
+    Check([a, b], pattern, start);
+    Check([a, u, b], pattern, start);
+    Check([a, "ab", b], pattern, start);
+    Check([a, "x", "y", "z", b], pattern, start);
+  }
+}
+
+// Many short segments make the search fall back to flattening.
+const short_segments = [];
+for (let i = 0; i < 1000; i++) short_segments.push("abcdefgh");
+short_segments.push("xyz");
+Check(short_segments, "hxyz", 0);
+Check(short_segments, "hab", 17);
+Check(short_segments, "q", 0);
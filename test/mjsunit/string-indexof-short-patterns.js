@@ -0,0 +1,34 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns are searched for by comparing their first and last characters
+// a vector at a time. Place matches and near-misses at every offset around the
+// vector boundaries, in one-byte and two-byte subjects.
+
+function Check(subject, pattern) {
+  let expected = -1;
+  for (let i = 0; i + pattern.length <= subject.length; i++) {
+    if (subject.substr(i, pattern.length) === pattern) {
+      expected = i;
+      break;
+    }
+  }
+  assertEquals(expected, subject.indexOf(pattern));
+  assertEquals(expected !== -1, subject.includes(pattern));
+}
+
+for (const filler of ["a", "䄀"]) {
+  for (const pattern of ["x", "䅸", "\0", "xy", "xay", "xaaay", "x䄀y"]) {
+    for (let length = 0; length < 40; length++) {
+      for (let pos = 0; pos <= length; pos++) {
+        const prefix = filler.repeat(pos);
+        const suffix = filler.repeat(length - pos);
+        Check(prefix + pattern + suffix, pattern);
+        // Only the first, or only the last, character of the pattern.
+        Check(prefix + pattern.slice(0, -1) + suffix, pattern);
+        Check(prefix + pattern.slice(1) + suffix, pattern);
+      }
+    }
+  }
+}
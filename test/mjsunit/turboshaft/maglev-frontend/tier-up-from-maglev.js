@@ -0,0 +1,36 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turboshaft-from-maglev-on-tier-up
+// Flags: --maglev --turbofan --no-always-turbofan
+
+function add(a, b) {
+  let sum = 0;
+  for (let i = 0; i < a; i++) sum += b;
+  return sum;
+}
+
+// Tiering up from Maglev code builds the Turboshaft graph from Maglev.
+%PrepareFunctionForOptimization(add);
+assertEquals(6, add(3, 2));
+%OptimizeMaglevOnNextCall(add);
+assertEquals(6, add(3, 2));
+%OptimizeFunctionOnNextCall(add);
+assertEquals(8, add(4, 2));
+assertOptimized(add);
+
+// Deopts work the same way as with the Turbofan frontend.
+assertEquals(4.5, add(3, 1.5));
+assertUnoptimized(add);
+
+// Functions without Maglev code still go through the Turbofan frontend.
+function mul(a, b) {
+  return a * b;
+}
+
+%PrepareFunctionForOptimization(mul);
+assertEquals(6, mul(3, 2));
+%OptimizeFunctionOnNextCall(mul);
+assertEquals(8, mul(4, 2));
+assertOptimized(mul);
@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-validation --wasm-lazy-validation-in-background
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kNumValidFunctions = 100;
+
+function buildModule(constant_offset) {
+  const builder = new WasmModuleBuilder();
+  for (let i = 0; i < kNumValidFunctions; ++i) {
+    builder.addFunction('valid' + i, kSig_i_i)
+        .addBody([kExprLocalGet, 0, ...wasmI32Const(i + constant_offset), kExprI32Add])
+        .exportFunc();
+  }
+  // Type error: i64.add on i32 operands.
+  builder.addFunction('invalid', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 0, kExprI64Add])
+      .exportFunc();
+  return builder.toBuffer();
+}
+
+function checkInstance(instance, constant_offset) {
+  for (let i = 0; i < kNumValidFunctions; ++i) {
+    assertEquals(i + constant_offset + 3, instance.exports['valid' + i](3));
+  }
+  assertThrows(
+      () => instance.exports.invalid(1), WebAssembly.CompileError,
+      /Compiling function #100:"invalid" failed/);
+}
+
+(function testSyncCompile() {
+  print(arguments.callee.name);
+  const module = new WebAssembly.Module(buildModule(0));
+  checkInstance(new WebAssembly.Instance(module), 0);
+})();
+
+(function testAsyncCompile() {
+  print(arguments.callee.name);
+  // Use different bytes than above to avoid a native module cache hit.
+  assertPromiseResult(
+      WebAssembly.instantiate(buildModule(1)),
+      ({instance}) => checkInstance(instance, 1));
+})();
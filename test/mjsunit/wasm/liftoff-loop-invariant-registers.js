@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --no-wasm-lazy-compilation --liftoff-loop-invariant-registers
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testLoopInvariantParams() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // sum = 0; do { sum += a * b + n; } while (--n);
+  builder.addFunction('main', kSig_i_iii)
+      .addLocals(kWasmI32, 1)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 3,
+          kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Mul,
+          kExprI32Add,
+          kExprLocalGet, 2, kExprI32Add,
+          kExprLocalSet, 3,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Sub,
+          kExprLocalTee, 2,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.main));
+  assertEquals(3 * 7 * 10 + 55, instance.exports.main(3, 7, 10));
+})();
+
+(function testLoopInvariantParamsWithCallAndNestedLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const import_index = builder.addImport('m', 'f', kSig_v_v);
+  // Sums up a + b for every iteration of the inner loop. The call in the outer
+  // loop evicts all cached registers.
+  builder.addFunction('main', kSig_i_iii)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprCallFunction, import_index,
+          kExprI32Const, 4, kExprLocalSet, 4,
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 3,
+            kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add,
+            kExprI32Add,
+            kExprLocalSet, 3,
+            kExprLocalGet, 4, kExprI32Const, 1, kExprI32Sub,
+            kExprLocalTee, 4,
+            kExprBrIf, 0,
+          kExprEnd,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Sub,
+          kExprLocalTee, 2,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3
+      ])
+      .exportFunc();
+  let calls = 0;
+  const instance = builder.instantiate({m: {f: () => calls++}});
+  assertEquals(4 * 5 * (11 + 31), instance.exports.main(11, 31, 5));
+  assertEquals(5, calls);
+})();
@@ -0,0 +1,47 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-memory64
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Memory64 accesses whose index is known to be in a small range (zero-extended
+// i32 or masked i64) can skip the explicit guard region check. They must still
+// trap when out of bounds.
+(function TestKnownIndexRangeOutOfBounds() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory64(1, 1);
+  builder.addFunction('load_extended', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprI64UConvertI32,  // i64.extend_i32_u
+        kExprI32LoadMem, 0, 0
+      ])
+      .exportFunc();
+  builder.addFunction('load_masked', makeSig([kWasmI64], [kWasmI32]))
+      .addBody([
+        kExprLocalGet, 0, ...wasmI64Const(0xffffff), kExprI64And,
+        kExprI32LoadMem, 0, 0
+      ])
+      .exportFunc();
+  builder.addFunction('store_extended', kSig_v_ii)
+      .addBody([
+        kExprLocalGet, 0, kExprI64UConvertI32,  // i64.extend_i32_u
+        kExprLocalGet, 1, kExprI32StoreMem, 0, 0
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  const {load_extended, load_masked, store_extended} = instance.exports;
+
+  store_extended(kPageSize - 4, 17);
+  assertEquals(17, load_extended(kPageSize - 4));
+  assertEquals(17, load_masked(BigInt(kPageSize - 4)));
+  assertEquals(17, load_masked(0x1000000n + BigInt(kPageSize - 4)));
+
+  assertTraps(kTrapMemOutOfBounds, () => load_extended(kPageSize - 3));
+  assertTraps(kTrapMemOutOfBounds, () => load_extended(-1));
+  assertTraps(kTrapMemOutOfBounds, () => store_extended(-4, 0));
+  assertTraps(kTrapMemOutOfBounds, () => load_masked(BigInt(kPageSize)));
+  assertTraps(kTrapMemOutOfBounds, () => load_masked(-1n));
+})();
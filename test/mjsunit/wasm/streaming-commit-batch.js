@@ -0,0 +1,33 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-test-streaming --wasm-streaming-commit-batch-kb=1
+// Flags: --no-wasm-lazy-compilation
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Function bodies of a few hundred bytes each, so that the compilation units
+// get committed several times within the single chunk.
+(function TestStreamingCompileCommitsInBatches() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  const kNumFunctions = 50;
+  for (let i = 0; i < kNumFunctions; i++) {
+    let body = [];
+    for (let j = 0; j < 100; j++) {
+      body.push(kExprLocalGet, 0, ...wasmI32Const(j), kExprI32Add,
+                kExprLocalSet, 0);
+    }
+    body.push(kExprLocalGet, 0, ...wasmI32Const(i), kExprI32Add);
+    builder.addFunction('f' + i, kSig_i_i).addBody(body).exportFunc();
+  }
+  let bytes = builder.toBuffer();
+  assertPromiseResult(
+      WebAssembly.instantiateStreaming(Promise.resolve(bytes))
+          .then(({instance}) => {
+            for (let i = 0; i < kNumFunctions; i++) {
+              assertEquals(4950 + i, instance.exports['f' + i](0));
+            }
+          }));
+})();
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <memory>
+#include <vector>
 
 #include "include/v8-context.h"
 #include "include/v8-function-callback.h"
@@ -162,6 +163,47 @@ TEST_F(ApiWasmTest, WasmCompileToWasmModuleObject) {
   CHECK(!maybe_module.IsEmpty());
 }
 
+TEST_F(ApiWasmTest, WasmTieringProfileRoundTrip) {
+  // A module with a single function of type [] -> [].
+  const uint8_t kModuleBytes[]{
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+      0x01, 0x04, 0x01, 0x60, 0x00, 0x00,              // type section
+      0x03, 0x02, 0x01, 0x00,                          // function section
+      0x0a, 0x04, 0x01, 0x02, 0x00, 0x0b};             // code section
+  Local<Context> context = Context::New(isolate());
+  Context::Scope context_scope(context);
+  Local<WasmModuleObject> module =
+      WasmModuleObject::Compile(isolate(),
+                                {kModuleBytes, arraysize(kModuleBytes)})
+          .ToLocalChecked();
+  CompiledWasmModule compiled_module = module->GetCompiledModule();
+
+  // Wire bytes hash, number of functions, one byte per function.
+  OwnedBuffer profile = compiled_module.GetTieringProfile();
+  ASSERT_EQ(6u, profile.size);
+  EXPECT_EQ(1, profile.buffer[4]);
+  std::vector<uint8_t> bytes(profile.buffer.get(),
+                             profile.buffer.get() + profile.size);
+  if (!i::v8_flags.wasm_jitless) {
+    EXPECT_TRUE(compiled_module.ApplyTieringProfile(
+        {bytes.data(), bytes.size()}));
+  }
+
+  // Truncated profile.
+  EXPECT_FALSE(
+      compiled_module.ApplyTieringProfile({bytes.data(), bytes.size() - 1}));
+  // Unknown tiering bits.
+  std::vector<uint8_t> bad_bits = bytes;
+  bad_bits[5] = 0x80;
+  EXPECT_FALSE(
+      compiled_module.ApplyTieringProfile({bad_bits.data(), bad_bits.size()}));
+  // Profile of different wire bytes.
+  std::vector<uint8_t> bad_hash = bytes;
+  bad_hash[0] ^= 0xff;
+  EXPECT_FALSE(
+      compiled_module.ApplyTieringProfile({bad_hash.data(), bad_hash.size()}));
+}
+
 TEST_F(ApiWasmTest, WasmStreamingSetCallback) {
   TestWasmStreaming(WasmStreamingMoreFunctionsCanBeSerializedCallback,
                     Promise::kPending);
@@ -4,7 +4,10 @@
 
 #include "src/execution/isolate.h"
 
+#include <memory>
+
 #include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
 #include "include/v8-platform.h"
 #include "include/v8-template.h"
 #include "src/base/platform/semaphore.h"
@@ -164,4 +167,44 @@ TEST_F(IsolateTest, SetAddCrashKeyCallback) {
   EXPECT_EQ(crash_keys.size(), expected_keys_count);
 }
 
+TEST_F(IsolateTest, IsolateGroups) {
+  if (!v8::IsolateGroup::CanCreateNewGroups()) return;
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+
+  v8::IsolateGroup group = v8::IsolateGroup::Create();
+  v8::IsolateGroup other_group = v8::IsolateGroup::Create();
+  EXPECT_NE(group, other_group);
+  v8::IsolateGroup copy = group;
+  EXPECT_EQ(group, copy);
+
+  v8::Isolate* first = v8::Isolate::New(group, params);
+  v8::Isolate* second = v8::Isolate::New(copy, params);
+  v8::Isolate* third = v8::Isolate::New(other_group, params);
+  i::IsolateGroup* first_group =
+      reinterpret_cast<i::Isolate*>(first)->isolate_group();
+  EXPECT_EQ(first_group,
+            reinterpret_cast<i::Isolate*>(second)->isolate_group());
+  EXPECT_NE(first_group,
+            reinterpret_cast<i::Isolate*>(third)->isolate_group());
+  // The groups keep their cages alive for as long as they have isolates.
+  group = std::move(other_group);
+  copy = group;
+  first->Dispose();
+  second->Dispose();
+  third->Dispose();
+}
+
+TEST_F(IsolateTest, IsolateGroupMovedFrom) {
+  if (!v8::IsolateGroup::CanCreateNewGroups()) return;
+
+  v8::Isolate::CreateParams params;
+  v8::IsolateGroup group = v8::IsolateGroup::Create();
+  v8::IsolateGroup other_group = std::move(group);
+  EXPECT_DEATH_IF_SUPPORTED(v8::Isolate::New(group, params), "");
+}
+
 }  // namespace v8
@@ -171,6 +171,22 @@ TEST(OS, GetSharedLibraryAddresses) {
   EXPECT_EQ(shared_library_addresses[1].start, 0x12430000u - 0x62000);
 #endif
 }
+
+TEST(OS, GetFileOffsetOfAddress) {
+  // {kArray} lives in the read-only data of the test binary.
+  std::optional<uint64_t> offset = GetFileOffsetOfAddress(kArray);
+  ASSERT_TRUE(offset.has_value());
+  const size_t page_size = OS::AllocatePageSize();
+  EXPECT_EQ(*offset % page_size,
+            reinterpret_cast<uintptr_t>(kArray) % page_size);
+
+  // Anonymous memory has no file offset.
+  void* anonymous = OS::Allocate(nullptr, page_size, page_size,
+                                 OS::MemoryPermission::kReadWrite);
+  ASSERT_TRUE(anonymous);
+  EXPECT_FALSE(GetFileOffsetOfAddress(anonymous).has_value());
+  OS::Free(anonymous, page_size);
+}
 #endif  // V8_TARGET_OS_LINUX
 
 namespace {
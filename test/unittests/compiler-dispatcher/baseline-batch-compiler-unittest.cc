@@ -0,0 +1,92 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/baseline/baseline-batch-compiler.h"
+
+#include "src/base/platform/platform.h"
+#include "src/baseline/baseline.h"
+#include "src/debug/debug-interface.h"
+#include "src/execution/isolate.h"
+#include "src/objects/objects-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+#ifdef V8_ENABLE_SPARKPLUG
+
+namespace v8 {
+namespace internal {
+
+class BaselineBatchCompilerTest : public TestWithNativeContext {
+ public:
+  static void SetUpTestSuite() {
+    v8_flags.sparkplug = true;
+    v8_flags.always_sparkplug = false;
+    v8_flags.concurrent_sparkplug = true;
+    v8_flags.concurrent_sparkplug_off_thread_install = true;
+    v8_flags.baseline_batch_compilation = true;
+    v8_flags.baseline_batch_compilation_threshold = 0;
+    TestWithNativeContext::SetUpTestSuite();
+  }
+
+ protected:
+  // Sends {function} to the background thread on its own and waits until the
+  // batch has been compiled, without giving the main thread a chance to
+  // install it.
+  void CompileInBackground(DirectHandle<JSFunction> function) {
+    baseline::BaselineBatchCompiler* compiler =
+        i_isolate()->baseline_batch_compiler();
+    compiler->EnqueueFunction(function);
+    while (!compiler->HasBatchToInstallForTesting()) {
+      base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+    }
+  }
+};
+
+namespace {
+
+class EmptyDebugDelegate : public v8::debug::DebugDelegate {};
+
+}  // namespace
+
+TEST_F(BaselineBatchCompilerTest, InstallsOffThread) {
+  Handle<JSFunction> function =
+      RunJS<JSFunction>("function f(a) { return a + 1; }; f(1); f");
+  if (!CanCompileWithBaseline(i_isolate(), function->shared())) {
+    GTEST_SKIP() << "Sparkplug is not available in this configuration";
+  }
+
+  CompileInBackground(function);
+  // The background thread installed the code before handing the batch back.
+  EXPECT_TRUE(function->shared()->HasBaselineCode());
+  EXPECT_TRUE(function->shared()->is_sparkplug_compiling());
+
+  i_isolate()->baseline_batch_compiler()->InstallBatch();
+  EXPECT_TRUE(function->shared()->HasBaselineCode());
+  EXPECT_FALSE(function->shared()->is_sparkplug_compiling());
+}
+
+TEST_F(BaselineBatchCompilerTest, InstallsOnMainThreadOnceDebuggerIsActive) {
+  Handle<JSFunction> function =
+      RunJS<JSFunction>("function g(a) { return a + 2; }; g(1); g");
+  if (!CanCompileWithBaseline(i_isolate(), function->shared())) {
+    GTEST_SKIP() << "Sparkplug is not available in this configuration";
+  }
+
+  EmptyDebugDelegate delegate;
+  v8::debug::SetDebugDelegate(v8_isolate(), &delegate);
+  EXPECT_TRUE(
+      i_isolate()->baseline_batch_compiler()->off_thread_install_disabled());
+
+  CompileInBackground(function);
+  EXPECT_FALSE(function->shared()->HasBaselineCode());
+
+  i_isolate()->baseline_batch_compiler()->InstallBatch();
+  EXPECT_TRUE(function->shared()->HasBaselineCode());
+  v8::debug::SetDebugDelegate(v8_isolate(), nullptr);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_SPARKPLUG
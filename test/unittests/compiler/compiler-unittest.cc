@@ -7,10 +7,13 @@
 #include <stdlib.h>
 #include <wchar.h>
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "include/v8-function.h"
 #include "include/v8-local-handle.h"
+#include "include/v8-metrics.h"
 #include "include/v8-profiler.h"
 #include "include/v8-script.h"
 #include "src/api/api-inl.h"
@@ -319,6 +322,65 @@ TEST_F(CompilerTest, FeedbackVectorPreservedAcrossRecompiles) {
   }
 }
 
+namespace {
+
+class CompilationMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  std::vector<v8::metrics::JavaScriptFunctionCompiled> compiled_;
+  std::vector<v8::metrics::JavaScriptFunctionDeoptimized> deoptimized_;
+
+  void AddMainThreadEvent(
+      const v8::metrics::JavaScriptFunctionCompiled& event,
+      v8::metrics::Recorder::ContextId id) override {
+    EXPECT_FALSE(id.IsEmpty());
+    compiled_.push_back(event);
+  }
+  void AddMainThreadEvent(
+      const v8::metrics::JavaScriptFunctionDeoptimized& event,
+      v8::metrics::Recorder::ContextId id) override {
+    EXPECT_FALSE(id.IsEmpty());
+    deoptimized_.push_back(event);
+  }
+};
+
+}  // namespace
+
+TEST_F(CompilerTest, CompilationMetrics) {
+  if (i::v8_flags.always_turbofan || !i::v8_flags.turbofan) return;
+  if (!base::TimeTicks::IsHighResolution()) return;
+  i::v8_flags.allow_natives_syntax = true;
+  if (!i_isolate()->use_optimizer()) return;
+  v8::HandleScope scope(isolate());
+  auto recorder = std::make_shared<CompilationMetricsRecorder>();
+  isolate()->SetMetricsRecorder(recorder);
+
+  RunJS(
+      "function f(a) { return a + 1; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f(1); f(2);"
+      "%OptimizeFunctionOnNextCall(f); f(3);");
+  auto is_turbofan = [](const v8::metrics::JavaScriptFunctionCompiled& e) {
+    return e.tier == v8::metrics::JavaScriptTier::kTurbofan;
+  };
+  auto it = std::find_if(recorder->compiled_.begin(), recorder->compiled_.end(),
+                         is_turbofan);
+  ASSERT_NE(recorder->compiled_.end(), it);
+  EXPECT_FALSE(it->concurrent);
+  EXPECT_GT(it->bytecode_size_in_bytes, 0u);
+  EXPECT_GE(it->compile_duration_in_us, 0);
+  EXPECT_GE(it->install_duration_in_us, 0);
+
+  // Passing a string invalidates the number feedback.
+  RunJS("f('x');");
+  ASSERT_FALSE(recorder->deoptimized_.empty());
+  EXPECT_EQ(v8::metrics::JavaScriptTier::kTurbofan,
+            recorder->deoptimized_.back().tier);
+  EXPECT_FALSE(recorder->deoptimized_.back().lazy);
+  EXPECT_NE(nullptr, recorder->deoptimized_.back().reason);
+  EXPECT_GE(recorder->deoptimized_.back().bytecode_offset, 0);
+  EXPECT_EQ(1, recorder->deoptimized_.back().site_deopt_count);
+}
+
 TEST_F(CompilerTest, FeedbackVectorUnaffectedByScopeChanges) {
   if (i::v8_flags.always_turbofan || !i::v8_flags.lazy ||
       i::v8_flags.lite_mode) {
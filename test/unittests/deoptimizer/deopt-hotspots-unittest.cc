@@ -0,0 +1,94 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deopt-hotspots.h"
+
+#include <algorithm>
+
+#include "include/v8-metrics.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using DeoptHotspotsTest = TestWithNativeContext;
+
+TEST_F(DeoptHotspotsTest, CountsPerSite) {
+  HandleScope scope(i_isolate());
+  DirectHandle<SharedFunctionInfo> f(
+      RunJS<JSFunction>("(function f() {})")->shared(), isolate());
+  DirectHandle<SharedFunctionInfo> g(
+      RunJS<JSFunction>("(function g() {})")->shared(), isolate());
+  DeoptHotspots hotspots;
+
+  EXPECT_EQ(1, hotspots.Record(*f, BytecodeOffset(3),
+                               DeoptimizeReason::kNotASmi));
+  EXPECT_EQ(2, hotspots.Record(*f, BytecodeOffset(3),
+                               DeoptimizeReason::kNotASmi));
+  // Another offset, reason or function is another site.
+  EXPECT_EQ(1, hotspots.Record(*f, BytecodeOffset(5),
+                               DeoptimizeReason::kNotASmi));
+  EXPECT_EQ(1, hotspots.Record(*f, BytecodeOffset(3),
+                               DeoptimizeReason::kWrongMap));
+  EXPECT_EQ(1, hotspots.Record(*g, BytecodeOffset(3),
+                               DeoptimizeReason::kNotASmi));
+  EXPECT_EQ(3, hotspots.Record(*f, BytecodeOffset(3),
+                               DeoptimizeReason::kNotASmi));
+  EXPECT_EQ(4u, hotspots.size());
+}
+
+TEST_F(DeoptHotspotsTest, EvictsColdestSite) {
+  HandleScope scope(i_isolate());
+  DirectHandle<SharedFunctionInfo> f(
+      RunJS<JSFunction>("(function f() {})")->shared(), isolate());
+  DeoptHotspots hotspots;
+
+  for (size_t i = 0; i < DeoptHotspots::kMaxSites; i++) {
+    hotspots.Record(*f, BytecodeOffset(static_cast<int>(i)),
+                    DeoptimizeReason::kNotASmi);
+  }
+  EXPECT_EQ(2, hotspots.Record(*f, BytecodeOffset(0),
+                               DeoptimizeReason::kNotASmi));
+  EXPECT_EQ(DeoptHotspots::kMaxSites, hotspots.size());
+  // A new site replaces one that deoptimized only once, the hot site stays.
+  int new_site = static_cast<int>(DeoptHotspots::kMaxSites);
+  EXPECT_EQ(1, hotspots.Record(*f, BytecodeOffset(new_site),
+                               DeoptimizeReason::kNotASmi));
+  EXPECT_EQ(DeoptHotspots::kMaxSites, hotspots.size());
+  EXPECT_EQ(2, hotspots.Record(*f, BytecodeOffset(new_site),
+                               DeoptimizeReason::kNotASmi));
+  EXPECT_EQ(3, hotspots.Record(*f, BytecodeOffset(0),
+                               DeoptimizeReason::kNotASmi));
+  EXPECT_EQ(DeoptHotspots::kMaxSites, hotspots.size());
+}
+
+TEST_F(DeoptHotspotsTest, EmbedderApi) {
+  HandleScope scope(i_isolate());
+  DirectHandle<SharedFunctionInfo> f(
+      RunJS<JSFunction>("(function f() {})")->shared(), isolate());
+  DeoptHotspots* hotspots = i_isolate()->deopt_hotspots();
+  size_t known_sites = hotspots->size();
+  hotspots->Record(*f, BytecodeOffset(7), DeoptimizeReason::kWrongMap);
+  hotspots->Record(*f, BytecodeOffset(7), DeoptimizeReason::kWrongMap);
+
+  std::vector<v8::metrics::DeoptHotspot> sites =
+      v8::metrics::DeoptHotspot::Get(v8_isolate());
+  EXPECT_EQ(known_sites + 1, sites.size());
+  auto it = std::find_if(sites.begin(), sites.end(), [&](const auto& site) {
+    return site.function_position == f->StartPosition() &&
+           site.bytecode_offset == 7;
+  });
+  ASSERT_NE(sites.end(), it);
+  EXPECT_EQ(Cast<Script>(f->script())->id(), it->script_id);
+  EXPECT_STREQ(DeoptimizeReasonToString(DeoptimizeReason::kWrongMap),
+               it->reason);
+  EXPECT_EQ(2, it->deopt_count);
+}
+
+}  // namespace internal
+}  // namespace v8
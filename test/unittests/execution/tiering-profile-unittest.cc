@@ -0,0 +1,183 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "src/api/api-inl.h"
+#include "src/flags/flags.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using TieringProfileTest = TestWithContext;
+
+namespace {
+
+std::vector<std::string> SplitRecord(const std::string& line) {
+  std::vector<std::string> fields;
+  std::istringstream line_stream(line);
+  for (std::string field; std::getline(line_stream, field, ',');) {
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+TieringProfile::Records ReadProfile(const std::string& contents) {
+  std::istringstream is(contents);
+  return TieringProfile::Read(is);
+}
+
+}  // namespace
+
+TEST_F(TieringProfileTest, WritesFunctionRecords) {
+  FlagScope<bool> no_lazy_feedback_allocation(
+      &v8_flags.lazy_feedback_allocation, false);
+  CompileWithOrigin(NewString("function hot(o) { return o.x; }"
+                              "for (let i = 0; i < 10; i++) hot({x: i});"),
+                    NewString("tiering-profile-test.js"), false)
+      ->Run(context())
+      .ToLocalChecked();
+
+  std::ostringstream os;
+  TieringProfile::Write(i_isolate(), os);
+
+  // Look for the record of |hot|, which was called ten times and saw one
+  // receiver map.
+  std::istringstream profile(os.str());
+  bool found = false;
+  for (std::string line; std::getline(profile, line);) {
+    std::vector<std::string> fields = SplitRecord(line);
+    ASSERT_EQ(10u, fields.size());
+    EXPECT_EQ(TieringProfile::kFunctionMarker, fields[0]);
+    if (fields[9] != "tiering-profile-test.js" || fields[3] != "10") continue;
+    EXPECT_EQ("1", fields[6]);  // IC slots.
+    EXPECT_EQ("0", fields[7]);  // Polymorphic ICs.
+    EXPECT_EQ("0", fields[8]);  // Megamorphic ICs.
+    found = true;
+  }
+  EXPECT_TRUE(found);
+}
+
+TEST(TieringProfileReadTest, ReadsFunctionRecords) {
+  TieringProfile::Records profile =
+      ReadProfile("tiering_function,0,30,100,TURBOFAN,0,1,0,0,a.js\n"
+                  "tiering_function,40,60,5,MAGLEV,2,3,1,0,a.js\n"
+                  "tiering_function,0,30,8,BASELINE,5,1,0,0,b.js\n");
+  ASSERT_EQ(3u, profile.size());
+
+  const TieringProfile::FunctionRecord& first =
+      profile.at(TieringProfile::KeyFor(0, 30, "a.js"));
+  EXPECT_EQ(CodeKind::TURBOFAN, first.code_kind);
+  EXPECT_EQ(CachedTieringDecision::kPending, first.cached_tiering_decision);
+
+  const TieringProfile::FunctionRecord& second =
+      profile.at(TieringProfile::KeyFor(40, 60, "a.js"));
+  EXPECT_EQ(CodeKind::MAGLEV, second.code_kind);
+  EXPECT_EQ(CachedTieringDecision::kDelayMaglev,
+            second.cached_tiering_decision);
+
+  const TieringProfile::FunctionRecord& third =
+      profile.at(TieringProfile::KeyFor(0, 30, "b.js"));
+  EXPECT_EQ(CodeKind::BASELINE, third.code_kind);
+  EXPECT_EQ(CachedTieringDecision::kNormal, third.cached_tiering_decision);
+}
+
+TEST(TieringProfileReadTest, KeepsHighestTierOfDuplicates) {
+  TieringProfile::Records profile =
+      ReadProfile("tiering_function,0,30,10,MAGLEV,0,1,0,0,a.js\n"
+                  "tiering_function,0,30,90,TURBOFAN,0,1,0,0,a.js\n"
+                  "tiering_function,0,30,20,BASELINE,0,1,0,0,a.js\n");
+  ASSERT_EQ(1u, profile.size());
+  EXPECT_EQ(CodeKind::TURBOFAN,
+            profile.at(TieringProfile::KeyFor(0, 30, "a.js")).code_kind);
+}
+
+TEST(TieringProfileReadTest, SkipsMalformedRecords) {
+  TieringProfile::Records profile = ReadProfile(
+      // Not a function record.
+      "block_hint,0,30,1\n"
+      // Too few fields.
+      "tiering_function,0,30,100,TURBOFAN\n"
+      // Not a number.
+      "tiering_function,zero,30,100,TURBOFAN,0,1,0,0,a.js\n"
+      // Unknown code kind.
+      "tiering_function,0,30,100,SOMETHING,0,1,0,0,a.js\n"
+      // Out-of-range tiering decision.
+      "tiering_function,0,30,100,TURBOFAN,42,1,0,0,a.js\n"
+      // Well-formed.
+      "tiering_function,40,60,100,TURBOFAN,0,1,0,0,a.js\n");
+  ASSERT_EQ(1u, profile.size());
+  EXPECT_EQ(1u, profile.count(TieringProfile::KeyFor(40, 60, "a.js")));
+}
+
+TEST(TieringProfileReadTest, MissingFileIsFatal) {
+  EXPECT_DEATH_IF_SUPPORTED(
+      TieringProfile::ReadFromFile("/nonexistent/tiering-profile.txt"),
+      "Can't read tiering profile");
+}
+
+TEST_F(TieringProfileTest, AppliesToMatchingFunction) {
+  CompileWithOrigin(NewString("function hot(o) { return o.x; }"
+                              "function other(o) { return o.y; }"),
+                    NewString("tiering-profile-test.js"), false)
+      ->Run(context())
+      .ToLocalChecked();
+  DirectHandle<JSFunction> hot =
+      Cast<JSFunction>(Utils::OpenDirectHandle(*RunJS("hot")));
+  DirectHandle<JSFunction> other =
+      Cast<JSFunction>(Utils::OpenDirectHandle(*RunJS("other")));
+  Tagged<SharedFunctionInfo> hot_shared = hot->shared();
+  Tagged<SharedFunctionInfo> other_shared = other->shared();
+  ASSERT_EQ(CachedTieringDecision::kPending,
+            hot_shared->cached_tiering_decision());
+  ASSERT_EQ(CachedTieringDecision::kPending,
+            other_shared->cached_tiering_decision());
+
+  // A record for |hot| in this script, and one for a function with the same
+  // source range in another script.
+  std::ostringstream contents;
+  contents << TieringProfile::kFunctionMarker << ','
+           << hot_shared->StartPosition() << ',' << hot_shared->EndPosition()
+           << ",100,TURBOFAN,0,1,0,0,tiering-profile-test.js\n"
+           << TieringProfile::kFunctionMarker << ','
+           << other_shared->StartPosition() << ','
+           << other_shared->EndPosition() << ",100,TURBOFAN,0,1,0,0,other.js\n";
+  TieringProfile::Records profile = ReadProfile(contents.str());
+  ASSERT_EQ(2u, profile.size());
+
+  TieringProfile::Apply(profile, hot_shared);
+  TieringProfile::Apply(profile, other_shared);
+  EXPECT_EQ(CachedTieringDecision::kEarlyTurbofan,
+            hot_shared->cached_tiering_decision());
+  EXPECT_EQ(CachedTieringDecision::kPending,
+            other_shared->cached_tiering_decision());
+}
+
+TEST_F(TieringProfileTest, DoesNotOverrideLearnedDecision) {
+  DirectHandle<JSFunction> function = Cast<JSFunction>(Utils::OpenDirectHandle(
+      *CompileWithOrigin(NewString("(function f(o) { return o.x; })"),
+                        NewString("tiering-profile-test.js"), false)
+           ->Run(context())
+           .ToLocalChecked()));
+  Tagged<SharedFunctionInfo> shared = function->shared();
+  shared->set_cached_tiering_decision(CachedTieringDecision::kNormal);
+
+  std::ostringstream contents;
+  contents << TieringProfile::kFunctionMarker << ',' << shared->StartPosition()
+           << ',' << shared->EndPosition()
+           << ",100,TURBOFAN,0,1,0,0,tiering-profile-test.js\n";
+  TieringProfile::Apply(ReadProfile(contents.str()), shared);
+  EXPECT_EQ(CachedTieringDecision::kNormal, shared->cached_tiering_decision());
+}
+
+}  // namespace internal
+}  // namespace v8
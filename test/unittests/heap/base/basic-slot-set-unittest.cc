@@ -113,6 +113,26 @@ TEST(BasicSlotSet, IterateFromHalfway) {
   TestSlotSet::Delete(set, kBucketsTestPage);
 }
 
+TEST(BasicSlotSet, ComputeStats) {
+  TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
+  TestSlotSet::Stats stats = set->ComputeStats(kBucketsTestPage);
+  EXPECT_EQ(0u, stats.buckets);
+  EXPECT_EQ(0u, stats.slots);
+
+  size_t inserted = 0;
+  const size_t bucket_size = TestSlotSet::OffsetForBucket(1);
+  for (size_t i = 0; i < 2 * bucket_size; i += kTestGranularity) {
+    if (i % 7 == 0) {
+      set->Insert<TestSlotSet::AccessMode::ATOMIC>(i);
+      inserted++;
+    }
+  }
+  stats = set->ComputeStats(kBucketsTestPage);
+  EXPECT_EQ(2u, stats.buckets);
+  EXPECT_EQ(inserted, stats.slots);
+  TestSlotSet::Delete(set, kBucketsTestPage);
+}
+
 TEST(BasicSlotSet, Remove) {
   TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
 
@@ -23,6 +23,13 @@ class CompactableCustomSpace : public CustomSpace<CompactableCustomSpace> {
   static constexpr bool kSupportsCompaction = true;
 };
 
+class SecondCompactableCustomSpace
+    : public CustomSpace<SecondCompactableCustomSpace> {
+ public:
+  static constexpr size_t kSpaceIndex = 1;
+  static constexpr bool kSupportsCompaction = true;
+};
+
 namespace internal {
 
 namespace {
@@ -63,12 +70,50 @@ struct CompactableHolder
   CompactableGCed* objects[kNumObjects]{};
 };
 
+struct SecondSpaceGCed : public GarbageCollected<SecondSpaceGCed> {
+ public:
+  ~SecondSpaceGCed() { ++g_destructor_callcount; }
+  void Trace(Visitor*) const {}
+  static size_t g_destructor_callcount;
+};
+// static
+size_t SecondSpaceGCed::g_destructor_callcount = 0;
+
+template <int kNumObjects>
+struct MultiSpaceHolder
+    : public GarbageCollected<MultiSpaceHolder<kNumObjects>> {
+ public:
+  explicit MultiSpaceHolder(cppgc::AllocationHandle& allocation_handle) {
+    for (int i = 0; i < kNumObjects; ++i) {
+      first[i] = MakeGarbageCollected<CompactableGCed>(allocation_handle);
+      second[i] = MakeGarbageCollected<SecondSpaceGCed>(allocation_handle);
+    }
+  }
+
+  void Trace(Visitor* visitor) const {
+    for (int i = 0; i < kNumObjects; ++i) {
+      VisitorBase::TraceRawForTesting(
+          visitor, const_cast<const CompactableGCed*>(first[i]));
+      visitor->RegisterMovableReference(
+          const_cast<const CompactableGCed**>(&first[i]));
+      VisitorBase::TraceRawForTesting(
+          visitor, const_cast<const SecondSpaceGCed*>(second[i]));
+      visitor->RegisterMovableReference(
+          const_cast<const SecondSpaceGCed**>(&second[i]));
+    }
+  }
+  CompactableGCed* first[kNumObjects]{};
+  SecondSpaceGCed* second[kNumObjects]{};
+};
+
 class CompactorTest : public testing::TestWithPlatform {
  public:
   CompactorTest() {
     Heap::HeapOptions options;
     options.custom_spaces.emplace_back(
         std::make_unique<CompactableCustomSpace>());
+    options.custom_spaces.emplace_back(
+        std::make_unique<SecondCompactableCustomSpace>());
     heap_ = Heap::Create(platform_, std::move(options));
   }
 
@@ -83,6 +128,7 @@ class CompactorTest : public testing::TestWithPlatform {
 
   void StartGC() {
     CompactableGCed::g_destructor_callcount = 0u;
+    SecondSpaceGCed::g_destructor_callcount = 0u;
     StartCompaction();
     heap()->StartIncrementalGarbageCollection(
         GCConfig::PreciseIncrementalConfig());
@@ -119,6 +165,11 @@ struct SpaceTrait<internal::CompactableGCed> {
   using Space = CompactableCustomSpace;
 };
 
+template <>
+struct SpaceTrait<internal::SecondSpaceGCed> {
+  using Space = SecondCompactableCustomSpace;
+};
+
 namespace internal {
 
 TEST_F(CompactorTest, NothingToCompact) {
@@ -245,6 +296,33 @@ TEST_F(CompactorTest, InteriorSlotToNextObject) {
   EXPECT_EQ(references[1], holder->objects[1]->other);
 }
 
+TEST_F(CompactorTest, CompactMultipleSpaces) {
+  // Without interior slots, independent spaces may be compacted in parallel.
+  static constexpr int kNumObjects = 10;
+  Persistent<MultiSpaceHolder<kNumObjects>> holder =
+      MakeGarbageCollected<MultiSpaceHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  CompactableGCed* first_references[kNumObjects] = {nullptr};
+  SecondSpaceGCed* second_references[kNumObjects] = {nullptr};
+  for (int i = 0; i < kNumObjects; ++i) {
+    first_references[i] = holder->first[i];
+    second_references[i] = holder->second[i];
+  }
+  StartGC();
+  for (int i = 0; i < kNumObjects; i += 2) {
+    holder->first[i] = nullptr;
+    holder->second[i] = nullptr;
+  }
+  EndGC();
+  EXPECT_EQ(5u, CompactableGCed::g_destructor_callcount);
+  EXPECT_EQ(5u, SecondSpaceGCed::g_destructor_callcount);
+  // Remaining objects are compacted in both spaces.
+  for (int i = 1; i < kNumObjects; i += 2) {
+    EXPECT_EQ(holder->first[i], first_references[i / 2]);
+    EXPECT_EQ(holder->second[i], second_references[i / 2]);
+  }
+}
+
 TEST_F(CompactorTest, OnStackSlotShouldBeFiltered) {
   StartGC();
   const CompactableGCed* compactable_object =
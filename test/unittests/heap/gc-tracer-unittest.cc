@@ -402,6 +402,35 @@ TEST_F(GCTracerTest, MutatorUtilization) {
                    tracer->AverageMarkCompactMutatorUtilization());
 }
 
+TEST_F(GCTracerTest, PauseBudgetExceeded) {
+  if (v8_flags.stress_incremental_marking) return;
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  tracer->SetPauseBudget(base::TimeDelta::FromMilliseconds(5));
+
+  // A 2ms pause stays within the budget.
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic,
+               base::TimeTicks::FromMsTicksForTesting(100));
+  StopTracing(tracer, GarbageCollector::SCAVENGER,
+              base::TimeTicks::FromMsTicksForTesting(102));
+  EXPECT_EQ(0u, tracer->pause_budget_exceeded_count());
+
+  // A 10ms pause exceeds the budget and is reported.
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic,
+               base::TimeTicks::FromMsTicksForTesting(200));
+  StopTracing(tracer, GarbageCollector::SCAVENGER,
+              base::TimeTicks::FromMsTicksForTesting(210));
+  EXPECT_EQ(1u, tracer->pause_budget_exceeded_count());
+
+  // Without a budget nothing is reported.
+  tracer->SetPauseBudget(std::nullopt);
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic,
+               base::TimeTicks::FromMsTicksForTesting(300));
+  StopTracing(tracer, GarbageCollector::SCAVENGER,
+              base::TimeTicks::FromMsTicksForTesting(310));
+  EXPECT_EQ(1u, tracer->pause_budget_exceeded_count());
+}
+
 TEST_F(GCTracerTest, BackgroundScavengerScope) {
   if (v8_flags.stress_incremental_marking) return;
   GCTracer* tracer = i_isolate()->heap()->tracer();
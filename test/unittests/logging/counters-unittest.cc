@@ -11,7 +11,7 @@
 #include "src/logging/counters.h"
 #include "src/objects/objects-inl.h"
 #include "src/tracing/tracing-category-observer.h"
-
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -223,5 +223,41 @@ TEST_F(SnapshotNativeCounterTest, WriteBarrier) {
   PrintAll();
 }
 
+TEST_F(SnapshotNativeCounterTest, ElementsKindTransitionCopiesOfLiterals) {
+  if (v8_flags.single_generation || !v8_flags.allocation_site_tracking) {
+    GTEST_SKIP() << "Literals don't get allocation mementos";
+  }
+  FlagScope<bool> no_lazy_feedback(&v8_flags.lazy_feedback_allocation, false);
+  RunJS("function f() { let a = [1, 2, 3]; a[0] = 1.5; return a; }");
+
+  // The first literal is created without a site and copies on the store.
+  int copies = elements_kind_transition_copies();
+  RunJS("f();");
+  EXPECT_EQ(copies + 1, elements_kind_transition_copies());
+
+  // The second literal copies as well and generalizes its site, which also
+  // transitions the boilerplate. Only the literal is counted.
+  RunJS("f();");
+  EXPECT_EQ(copies + 2, elements_kind_transition_copies());
+
+  // Later literals start out with double elements.
+  RunJS("f();");
+  EXPECT_EQ(copies + 2, elements_kind_transition_copies());
+}
+
+TEST_F(SnapshotNativeCounterTest, ElementsKindTransitionCopiesInStubs) {
+  // Slices have no allocation memento, so the store handler transitions them
+  // in the stub.
+  RunJS(
+      "function make() { return [1, 2, 3].slice(); }"
+      "function g(a) { a[0] = 1.5; }"
+      "g(make());");
+  int copies = elements_kind_transition_copies();
+  RunJS("for (let i = 0; i < 10; i++) g(make());");
+  if (SupportsNativeCounters()) {
+    EXPECT_EQ(copies + 10, elements_kind_transition_copies());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -201,6 +201,32 @@ TEST_F(RuntimeCallStatsTest, RuntimeCallTimerSubTimer) {
   EXPECT_EQ(nullptr, stats()->current_timer());
 }
 
+TEST_F(RuntimeCallStatsTest, RuntimeCallTimerSampling) {
+  FlagScope<int> sampling_rate(&v8_flags.runtime_call_stats_sampling_rate, 2);
+  RuntimeCallStats sampled_stats(RuntimeCallStats::kMainIsolateThread);
+  RuntimeCallCounter* sampled_counter = sampled_stats.GetCounter(counter_id());
+  RuntimeCallCounter* sampled_counter2 =
+      sampled_stats.GetCounter(counter_id2());
+
+  for (int i = 0; i < 4; i++) {
+    RuntimeCallTimer timer;
+    RuntimeCallTimer timer2;
+    sampled_stats.Enter(&timer, counter_id());
+    Sleep(50);
+    sampled_stats.Enter(&timer2, counter_id2());
+    Sleep(100);
+    sampled_stats.Leave(&timer2);
+    sampled_stats.Leave(&timer);
+    EXPECT_EQ(nullptr, sampled_stats.current_timer());
+  }
+
+  // Every other top-level scope is timed, including its nested scope.
+  EXPECT_EQ(2, sampled_counter->count());
+  EXPECT_EQ(2, sampled_counter2->count());
+  EXPECT_EQ(100, sampled_counter->time().InMicroseconds());
+  EXPECT_EQ(200, sampled_counter2->time().InMicroseconds());
+}
+
 TEST_F(RuntimeCallStatsTest, RuntimeCallTimerRecursive) {
   RuntimeCallTimer timer;
   RuntimeCallTimer timer2;
@@ -988,6 +988,86 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+// Writes the keys of objects with the same map only once.
+class ValueSerializerTestWithObjectShapes : public ValueSerializerTest {
+ protected:
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->SetUseObjectShapes(use_object_shapes_);
+  }
+
+  i::Tagged<i::Map> MapOfElement(Local<Value> array, uint32_t index) {
+    Local<Value> element = array.As<Array>()
+                               ->Get(deserialization_context(), index)
+                               .ToLocalChecked();
+    return Utils::OpenDirectHandle(Object::Cast(*element))->map();
+  }
+
+  bool use_object_shapes_ = true;
+};
+
+TEST_F(ValueSerializerTestWithObjectShapes, RoundTripArrayOfRecords) {
+  Local<Value> value =
+      RoundTripTest("[{x: 1, y: 'a'}, {x: 2, y: 'b'}, {x: 3, y: 'c'}]");
+  ExpectScriptTrue("result[2].x === 3 && result[2].y === 'c'");
+  EXPECT_EQ(MapOfElement(value, 0), MapOfElement(value, 2));
+
+  // Objects with different maps get different shapes.
+  RoundTripJSON(
+      "[{\"x\":1,\"y\":2},{\"y\":3,\"x\":4},{\"x\":5},"
+      "{\"x\":6,\"y\":7}]");
+
+  // Values which don't fit the fields of the previous object's map.
+  RoundTripJSON("[{\"a\":1},{\"a\":1.5},{\"a\":\"x\"},{\"a\":null}]");
+
+  // Nested objects and references to objects with a shape.
+  RoundTripTest(
+      "var p = {x: 1, y: 2};"
+      "[{p: p, q: {x: 3, y: 4}}, {p: p, q: p}]");
+  ExpectScriptTrue("result[0].p === result[1].p");
+  ExpectScriptTrue("result[1].q === result[1].p");
+  ExpectScriptTrue("result[0].q.y === 4");
+  RoundTripTest("var a = {b: 1}; a.self = a; [a, {b: 2, self: a}]");
+  ExpectScriptTrue("result[0].self === result[0]");
+  ExpectScriptTrue("result[1].self === result[0]");
+
+  // Non-enumerable properties, symbols and accessors are handled as before.
+  RoundTripTest(
+      "var x = {a: 1, [Symbol()]: 2};"
+      "Object.defineProperty(x, 'b', {value: 3, enumerable: false});"
+      "[x, {a: 4, get c() { return 5; }}]");
+  ExpectScriptTrue("Object.getOwnPropertyNames(result[0]).toString() === 'a'");
+  ExpectScriptTrue("result[1].c === 5");
+}
+
+TEST_F(ValueSerializerTestWithObjectShapes, ShapesReduceSize) {
+  const char* source =
+      "Array.from({length: 100}, (_, i) => ({id: i, name: 'n', flag: true}))";
+  size_t size_with_shapes = EncodeTest(source).size();
+  use_object_shapes_ = false;
+  size_t size_without_shapes = EncodeTest(source).size();
+  EXPECT_LT(2 * size_with_shapes, size_without_shapes);
+}
+
+TEST_F(ValueSerializerTestWithObjectShapes, DecodeShapedObject) {
+  DecodeTestFutureVersions(
+      {0xFF, 0x0F, 0x41, 0x02, 0x68, 0x00, 0x01, 0x22, 0x01, 0x61, 0x49, 0x02,
+       0x68, 0x00, 0x49, 0x04, 0x24, 0x00, 0x02},
+      [this](Local<Value> value) {
+        ASSERT_TRUE(value->IsArray());
+        ExpectScriptTrue("result.length === 2");
+        ExpectScriptTrue("result[0].a === 1 && result[1].a === 2");
+        ExpectScriptTrue(
+            "Object.getPrototypeOf(result[1]) === Object.prototype");
+      });
+  // Reference to a shape which was not defined.
+  InvalidDecodeTest({0xFF, 0x0F, 0x68, 0x01});
+  // Shape without keys.
+  InvalidDecodeTest({0xFF, 0x0F, 0x68, 0x00, 0x00});
+  // Shape with a duplicate key.
+  InvalidDecodeTest({0xFF, 0x0F, 0x68, 0x00, 0x02, 0x22, 0x01, 0x61, 0x22,
+                     0x01, 0x61, 0x49, 0x02, 0x49, 0x04});
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -2083,6 +2163,90 @@ TEST_F(ValueSerializerTestWithArrayBufferTransfer,
   ExpectScriptTrue("new Uint8Array(result.a).toString() === '0,1,128,255'");
 }
 
+// Passes ArrayBuffer backing stores out of band, so that the serialization and
+// deserialization contexts share the same memory.
+class ValueSerializerTestWithBackingStoreSharing : public ValueSerializerTest {
+ protected:
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(
+        ValueSerializerTestWithBackingStoreSharing* test)
+        : test_(test) {}
+    Maybe<bool> GetBackingStoreId(Isolate* isolate,
+                                  Local<ArrayBuffer> array_buffer,
+                                  uint32_t* backing_store_id) override {
+      *backing_store_id =
+          static_cast<uint32_t>(test_->backing_stores_.size());
+      test_->backing_stores_.push_back(array_buffer->GetBackingStore());
+      return Just(true);
+    }
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+
+   private:
+    ValueSerializerTestWithBackingStoreSharing* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(
+        ValueSerializerTestWithBackingStoreSharing* test)
+        : test_(test) {}
+    std::shared_ptr<BackingStore> GetBackingStoreFromId(
+        Isolate* isolate, uint32_t backing_store_id) override {
+      CHECK_LT(backing_store_id, test_->backing_stores_.size());
+      return test_->backing_stores_[backing_store_id];
+    }
+
+   private:
+    ValueSerializerTestWithBackingStoreSharing* test_;
+  };
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  void BeforeEncode(ValueSerializer* serializer) override {
+    backing_stores_.clear();
+  }
+
+  void* DataOf(Local<Value> value) {
+    return value.As<ArrayBufferView>()->Buffer()->GetBackingStore()->Data();
+  }
+
+  std::vector<std::shared_ptr<BackingStore>> backing_stores_;
+  SerializerDelegate serializer_delegate_{this};
+  DeserializerDelegate deserializer_delegate_{this};
+};
+
+TEST_F(ValueSerializerTestWithBackingStoreSharing, RoundTripTypedArray) {
+  Local<Value> input = EvaluateScriptForInput("new Uint8Array([1, 128, 255])");
+  Local<Value> value = RoundTripTest(input);
+  ASSERT_TRUE(value->IsUint8Array());
+  ExpectScriptTrue("result.toString() === '1,128,255'");
+  ASSERT_EQ(1u, backing_stores_.size());
+  EXPECT_EQ(DataOf(input), DataOf(value));
+
+  // The buffer is only passed once even if it is referenced several times.
+  value = RoundTripTest(
+      "(() => { var x = new Uint8Array([1, 2]);"
+      "         return {a: x, b: new Uint16Array(x.buffer)}; })()");
+  EXPECT_EQ(1u, backing_stores_.size());
+  ExpectScriptTrue("result.a.buffer === result.b.buffer");
+  ExpectScriptTrue("result.a.toString() === '1,2'");
+}
+
+TEST_F(ValueSerializerTestWithBackingStoreSharing, ResizableBufferIsCopied) {
+  RoundTripTest("new Uint8Array(new ArrayBuffer(2, {maxByteLength: 4}))");
+  EXPECT_EQ(0u, backing_stores_.size());
+  ExpectScriptTrue("result.buffer.resizable");
+}
+
 TEST_F(ValueSerializerTest, RoundTripTypedArray) {
   FLAG_SCOPE(js_float16array);
   // Check that the right type comes out the other side for every kind of typed
@@ -67,6 +67,27 @@ class ChunkSource : public v8::ScriptCompiler::ExternalSourceStream {
   size_t current_;
 };
 
+// Hands out pointers into its data instead of copies, like an embedder that
+// streams from a memory-mapped file.
+class BorrowedChunkSource : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  BorrowedChunkSource(const uint8_t* data, size_t len, size_t chunk_size)
+      : data_(data), len_(len), chunk_size_(chunk_size), pos_(0) {}
+  size_t GetMoreData(const uint8_t** src) override {
+    size_t len = std::min(chunk_size_, len_ - pos_);
+    *src = data_ + pos_;
+    pos_ += len;
+    return len;
+  }
+  bool TransfersChunkOwnership() const override { return false; }
+
+ private:
+  const uint8_t* data_;
+  size_t len_;
+  size_t chunk_size_;
+  size_t pos_;
+};
+
 // Checks that Lock() / Unlock() pairs are balanced. Not thread-safe.
 class LockChecker {
  public:
@@ -384,6 +405,33 @@ TEST_F(ScannerStreamsTest, Utf8ChunkBoundaries) {
   }
 }
 
+TEST_F(ScannerStreamsTest, BorrowedChunks) {
+  // The chunks point into unicode_utf8 itself, so V8 must not free them.
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(unicode_utf8);
+  size_t len = strlen(unicode_utf8);
+  for (size_t chunk_size = 1; chunk_size <= len; chunk_size++) {
+    BorrowedChunkSource utf8_source(data, len, chunk_size);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> utf8_stream(
+        v8::internal::ScannerStream::For(
+            &utf8_source, v8::ScriptCompiler::StreamedSource::UTF8));
+    for (size_t j = 0; unicode_ucs2[j]; j++) {
+      CHECK_EQ(unicode_ucs2[j], utf8_stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             utf8_stream->Advance());
+
+    BorrowedChunkSource one_byte_source(data, len, chunk_size);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> one_byte_stream(
+        v8::internal::ScannerStream::For(
+            &one_byte_source, v8::ScriptCompiler::StreamedSource::ONE_BYTE));
+    for (size_t j = 0; j < len; j++) {
+      CHECK_EQ(data[j], one_byte_stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             one_byte_stream->Advance());
+  }
+}
+
 TEST_F(ScannerStreamsTest, Utf8SingleByteChunks) {
   // Have each byte as a single-byte chunk.
   size_t len = strlen(unicode_utf8);
@@ -2348,6 +2348,25 @@ TEST_F(RegExpTestWithContext, UnicodePropertyEscapeCodeSize) {
   }
 }
 
+TEST_F(RegExpTestWithContext, SetRegExpTierUpTicks) {
+  if (!v8_flags.regexp_tier_up || v8_flags.regexp_interpret_all) return;
+  static constexpr bool kIsLatin1 = true;
+  isolate()->SetRegExpTierUpTicks(3);
+
+  v8::HandleScope scope(isolate());
+  i::DirectHandle<i::JSRegExp> re = Utils::OpenDirectHandle(
+      *RunJS("const r = /a+b/; r.exec('aab'); r.exec('aab'); r.exec('aab'); r;")
+           .As<v8::RegExp>());
+  Tagged<IrRegExpData> re_data = Cast<IrRegExpData>(re->data(i_isolate()));
+  CHECK(re_data->has_bytecode(kIsLatin1));
+  CHECK_EQ(re_data->ticks_until_tier_up(), 0);
+
+  RunJS("r.exec('aab');");
+  re_data = Cast<IrRegExpData>(re->data(i_isolate()));
+  CHECK(!re_data->has_bytecode(kIsLatin1));
+  CHECK_EQ(re_data->code(i_isolate(), kIsLatin1)->kind(), CodeKind::REGEXP);
+}
+
 namespace {
 
 struct RegExpExecData {
@@ -495,6 +495,49 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, AsciiRuns) {
+  // The decoder skips ASCII runs in bulk; check that runs of every length and
+  // alignment around multi-byte and invalid sequences still decode correctly.
+  const std::vector<std::vector<uint8_t>> kNonAscii = {
+      {0xC3, 0xA9}, {0xE2, 0x82, 0xAC}, {0xF0, 0x9F, 0x98, 0x8D}, {0xFF},
+      {0xE2, 0x82}};
+  for (const std::vector<uint8_t>& non_ascii : kNonAscii) {
+    for (size_t prefix = 0; prefix < 20; prefix++) {
+      for (size_t run = 0; run < 20; run++) {
+        std::vector<uint8_t> bytes(prefix, 'a');
+        bytes.insert(bytes.end(), non_ascii.begin(), non_ascii.end());
+        for (size_t i = 0; i < run; i++) bytes.push_back('0' + i % 10);
+        bytes.insert(bytes.end(), non_ascii.begin(), non_ascii.end());
+
+        std::vector<unibrow::uchar> output_incremental;
+        DecodeIncrementally(bytes, &output_incremental);
+        std::vector<unibrow::uchar> output_utf16;
+        DecodeUtf16(bytes, &output_utf16);
+        CHECK_EQ(output_utf16.size(), output_incremental.size());
+        for (size_t i = 0; i < output_utf16.size(); ++i) {
+          CHECK_EQ(output_utf16[i], output_incremental[i]);
+        }
+      }
+    }
+  }
+}
+
+TEST(UnicodeTest, TwoByteNonAsciiStart) {
+  std::vector<uint16_t> chars(40, 'a');
+  for (int offset = 0; offset < 4; offset++) {
+    const uint16_t* start = chars.data() + offset;
+    int length = static_cast<int>(chars.size()) - offset;
+    CHECK_EQ(length, NonAsciiStart(start, length));
+    for (int i = 0; i < length; i++) {
+      for (uint16_t c : {0x80, 0xFF, 0x100, 0xD800}) {
+        chars[offset + i] = c;
+        CHECK_EQ(i, NonAsciiStart(start, length));
+        chars[offset + i] = 'a';
+      }
+    }
+  }
+}
+
 class UnicodeWithGCTest : public TestWithHeapInternals {};
 
 #define GC_INSIDE_NEW_STRING_FROM_UTF8_SUB_STRING(NAME, STRING)               \
@@ -5,6 +5,7 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -25,5 +26,55 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentPoolReusesSegments) {
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 1024);
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+  }
+  size_t pooled = allocator.GetPooledMemoryUsage();
+  EXPECT_LT(0u, pooled);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetPooledSegmentHits());
+
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+    EXPECT_EQ(1u, allocator.GetPooledSegmentHits());
+    EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+    EXPECT_EQ(pooled, allocator.GetCurrentMemoryUsage());
+  }
+
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+}
+
+TEST_F(ZoneTest, SegmentPoolIsCapped) {
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 16);
+  AccountingAllocator allocator;
+  {
+    // Several zones, so that they give back several segments.
+    Zone zone1(&allocator, ZONE_NAME);
+    Zone zone2(&allocator, ZONE_NAME);
+    Zone zone3(&allocator, ZONE_NAME);
+    zone1.Allocate<ZoneTestTag>(1 * KB);
+    zone2.Allocate<ZoneTestTag>(1 * KB);
+    zone3.Allocate<ZoneTestTag>(1 * KB);
+  }
+  EXPECT_LT(0u, allocator.GetPooledMemoryUsage());
+  EXPECT_LE(allocator.GetPooledMemoryUsage(), 16 * KB);
+}
+
+TEST_F(ZoneTest, SegmentPoolDisabledByDefault) {
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 0);
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+  }
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+}
+
 }  // namespace internal
 }  // namespace v8
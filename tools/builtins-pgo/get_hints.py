@@ -22,7 +22,9 @@ Usage: get_hints.py [--min MIN] [--ratio RATIO] log_file output_file
 where:
     1. log_file is the file produced after running v8 with the
        --turbo-profiling-output=log_file flag after building with
-       v8_enable_builtins_profiling = true.
+       v8_enable_builtins_profiling = true, or by v8::Isolate::
+       WriteBuiltinsProfile. Logs from several runs can be concatenated into
+       one log_file; their counts are summed.
     2. output_file is the file which the hints and builtin hashes are written
        to.
     3. --min MIN provides the minimum count at which a basic block will be taken
@@ -85,13 +87,16 @@ def parse_log_file(log_file):
           builtin_name = fields[1]
           block_id = int(fields[2])
           count = float(fields[3])
-          if block_id == 0 and count > max_execution_count:
-            max_execution_count = count
           if builtin_name not in block_counts:
             block_counts[builtin_name] = []
           while len(block_counts[builtin_name]) <= block_id:
             block_counts[builtin_name].append(0)
           block_counts[builtin_name][block_id] += count
+          # Logs from several processes may have been concatenated, so use the
+          # summed count.
+          if block_id == 0:
+            max_execution_count = max(max_execution_count,
+                                      block_counts[builtin_name][0])
         elif fields[0] == BUILTIN_HASH_MARKER:
           builtin_name = fields[1]
           builtin_hash = int(fields[2])